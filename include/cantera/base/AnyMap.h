@@ -404,7 +404,8 @@ public:
     /*!
      *  Searches the directory containing the optionally-specified parent file
      *  first, followed by the current working directory and the Cantera include
-     *  path.
+     *  path. Files in the binary format generated by toBinaryString() are
+     *  detected automatically and loaded using fromBinaryString().
      */
     static AnyMap fromYamlFile(const std::string& name,
                                const std::string& parent_name="");
@@ -414,6 +415,30 @@ public:
 
     std::string toYamlString() const;
 
+    //! Create an AnyMap from a string containing the binary representation
+    //! generated by toBinaryString()
+    /*!
+     *  The data is decoded directly from the buffer, without YAML parsing, and
+     *  all values are taken to be in %Cantera's default (SI) unit system.
+     */
+    static AnyMap fromBinaryString(const std::string& data);
+
+    //! Return a compact binary representation of this AnyMap
+    /*!
+     *  Quantities with units are first converted to the default unit system.
+     *  Maps which use a different unit system cannot be represented, since the
+     *  binary format does not store unit declarations. Hidden keys (for
+     *  example, those used to control YAML output formatting) are omitted.
+     *
+     *  Binary files are recognized automatically by fromYamlFile(). Use
+     *  YamlWriter::toBinaryFile() to generate such a file from the definitions
+     *  of one or more Solution objects.
+     *
+     *  @warning This function is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    std::string toBinaryString() const;
+
     //! Get the value of the item stored in `key`.
     AnyValue& operator[](const std::string& key);
     const AnyValue& operator[](const std::string& key) const;
@@ -9,6 +9,7 @@
 #include "cantera/base/global.h"
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/ExtensionManager.h"
+#include "cantera/base/Units.h"
 #include <array>
 #include <list>
 
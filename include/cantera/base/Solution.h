@@ -32,6 +32,31 @@ public:
         return shared_ptr<Solution>( new Solution );
     }
 
+    //! Create a new Solution object with the same mechanism as this one.
+    /*!
+     *  The new object shares the Species and Reaction objects of this object,
+     *  including the species thermodynamic parameterizations, rather than
+     *  reading them from the input file again. The Kinetics and Transport
+     *  objects are created using Kinetics::clone() and Transport::clone(),
+     *  which copy the rate evaluators and the fitted transport properties
+     *  instead of processing the reactions and fitting the transport
+     *  properties again. The Reaction and ReactionRate objects of this
+     *  object are not modified. Transport models which do not implement
+     *  clone() are set up from the species data.
+     *
+     *  Each clone has its own ThermoPhase, Kinetics and Transport objects,
+     *  with an independent state and independent property caches and work
+     *  arrays, so clones can be used concurrently by different threads.
+     *  Adjacent phases are cloned as well.
+     *
+     *  The shared Species and Reaction objects should not be modified while
+     *  they are in use by more than one Solution.
+     *
+     *  @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    shared_ptr<Solution> clone();
+
     //! Return the name of this Solution object
     std::string name() const;
 
@@ -43,6 +43,21 @@ public:
     //! the specified file.
     void toYamlFile(const std::string& filename) const;
 
+    //! Return a string containing the definitions for the added phases,
+    //! species, and reactions in the binary format generated by
+    //! AnyMap::toBinaryString().
+    /*!
+     *  All values are stored in SI units, and the output units and precision
+     *  settings are ignored.
+     */
+    std::string toBinaryString() const;
+
+    //! Write the definitions for the added phases, species and reactions to
+    //! the specified file in a binary format which can be loaded without
+    //! parsing YAML. The resulting file can be used in place of a YAML input
+    //! file, for example with newSolution().
+    void toBinaryFile(const std::string& filename) const;
+
     //! For output floating point values, set the maximum number of digits to
     //! the right of the decimal point. The default is 15 digits.
     void setPrecision(long int n) {
@@ -70,6 +85,10 @@ public:
     void setUnitSystem(const UnitSystem& units=UnitSystem());
 
 protected:
+    //! Build the AnyMap containing the header, phase, species and reaction
+    //! definitions
+    AnyMap buildOutput() const;
+
     //! Top-level information used in YAML header block
     AnyMap m_header;
 
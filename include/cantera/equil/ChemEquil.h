@@ -122,6 +122,36 @@ public:
     int equilibrate(ThermoPhase& s, const char* XY, vector_fp& elMoles,
                     int loglevel = 0);
 
+    /*!
+     * Equilibrate a phase, starting from the solution for a similar state.
+     *
+     * The estimation of the initial element potentials done by equilibrate()
+     * is skipped, and the component basis determined by the last call to
+     * equilibrate() is reused. This is much faster when solving for many
+     * nearby states, for example when generating tables. The elemental
+     * composition and the two specified properties are obtained from the
+     * ThermoPhase object, as for equilibrate(ThermoPhase&, const char*, int).
+     *
+     * @param s phase object to be equilibrated. The phase must have the same
+     *     species and elements as the phase last equilibrated by this object.
+     * @param XY property pair to hold constant
+     * @param x On input, the starting estimate consisting of the dimensionless
+     *     element potentials followed by the logarithm of the temperature, as
+     *     returned by solution(). On output, the solution.
+     * @param loglevel Specify amount of debug logging (0 to disable)
+     * @return 0 on success. A CanteraError is thrown if the iteration fails, in
+     *     which case the original state of *s* is restored.
+     */
+    int equilibrateFrom(ThermoPhase& s, const char* XY, vector_fp& x,
+                        int loglevel = 0);
+
+    //! The solution of the last successful equilibrium calculation, consisting
+    //! of the dimensionless element potentials followed by the logarithm of
+    //! the temperature. Empty if no calculation has succeeded.
+    const vector_fp& solution() const {
+        return m_x;
+    }
+
     /**
      * Options controlling how the calculation is carried out.
      * @see EquilOpt
@@ -203,6 +233,16 @@ protected:
      */
     int estimateEP_Brinkley(ThermoPhase& s, vector_fp& lambda, vector_fp& elMoles);
 
+    //! Set the functions used to evaluate the two specified properties.
+    //! Returns true if the temperature is one of the specified properties.
+    bool setPropertyPair(ThermoPhase& s, const char* XY);
+
+    //! Solve for the element potentials and temperature using a damped Newton
+    //! iteration, starting from the estimate *x*. If the iteration fails, the
+    //! phase is restored to *state* and a CanteraError is thrown.
+    int iterate(ThermoPhase& s, vector_fp& x, vector_fp& elMolesGoal,
+                double xval, double yval, const vector_fp& state, int loglevel);
+
     //! Find an acceptable step size and take it.
     /*!
      * The original implementation employed a line search technique that
@@ -282,6 +322,9 @@ protected:
 
     vector_fp m_startSoln;
 
+    //! Solution of the last successful calculation. See solution().
+    vector_fp m_x;
+
     vector_fp m_grt;
     vector_fp m_mu_RT;
 
@@ -0,0 +1,167 @@
+//! @file ChemEquilBatch.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_CHEMEQUILBATCH_H
+#define CT_CHEMEQUILBATCH_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+class ChemEquil;
+
+//! Equilibrium calculations for a large number of gas-phase states.
+/*!
+ *  This class computes the chemical equilibrium of an ideal gas for many
+ *  independent states, for example the points of a table of equilibrium
+ *  properties as a function of enthalpy, pressure and mixture fraction. The
+ *  element potential method of ChemEquil is used.
+ *
+ *  The states are divided into chunks of consecutive states, which are
+ *  distributed dynamically over a set of worker threads. Each worker owns a
+ *  Solution object created using Solution::clone() and a ChemEquil object,
+ *  which is reused for all of its states. Within a chunk, the first state is
+ *  solved starting from the estimate computed by ChemEquil::equilibrate().
+ *  Each of the following states is solved using ChemEquil::equilibrateFrom(),
+ *  starting from the solution of the nearest previously solved state of the
+ *  chunk. The distance between two states is measured using the relative
+ *  difference of the initial temperatures, the difference of the logarithms
+ *  of the pressures, and the differences of the elemental mole fractions. If
+ *  the solution fails for a warm start, the state is solved again from the
+ *  estimate computed by ChemEquil::equilibrate(), and if this fails as well,
+ *  using the VCS solver.
+ *
+ *  Since the chunks do not depend on the number of threads, the results do
+ *  not depend on the number of threads either.
+ *
+ *  @warning  This class is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ *
+ * @ingroup equil
+ */
+class ChemEquilBatch
+{
+public:
+    //! Create a batch equilibrium solver
+    /*!
+     *  @param sol  Solution object defining the phase, which must be an ideal
+     *      gas.
+     *  @param nThreads  Number of worker threads. If zero, the number of
+     *      concurrent threads supported by the hardware is used.
+     */
+    ChemEquilBatch(shared_ptr<Solution> sol, size_t nThreads=0);
+    ~ChemEquilBatch();
+    ChemEquilBatch(const ChemEquilBatch&) = delete;
+    ChemEquilBatch& operator=(const ChemEquilBatch&) = delete;
+
+    //! Number of worker threads
+    size_t nThreads() const {
+        return m_workers.size();
+    }
+
+    //! Number of species in the phase
+    size_t nSpecies() const {
+        return m_nsp;
+    }
+
+    //! Set the states to be equilibrated
+    /*!
+     *  @param nStates  Number of states
+     *  @param T  Temperatures [K]. Length: nStates
+     *  @param P  Pressures [Pa]. Length: nStates
+     *  @param Y  Mass fractions, with the mass fractions for each state stored
+     *      consecutively. Length: nStates * nSpecies()
+     */
+    void setStates(size_t nStates, const double* T, const double* P,
+                   const double* Y);
+
+    //! Number of states
+    size_t nStates() const {
+        return m_T0.size();
+    }
+
+    //! Set the number of consecutive states in each chunk. The default is 256.
+    void setChunkSize(size_t n);
+
+    //! Set the relative tolerance of the equilibrium calculations. The default
+    //! is 1e-9.
+    void setTolerance(double rtol);
+
+    //! Equilibrate all states, holding the two properties `XY` (for example,
+    //! "HP") fixed
+    void equilibrate(const std::string& XY);
+
+    //! Equilibrium temperatures [K]
+    const vector_fp& temperatures() const {
+        return m_T;
+    }
+
+    //! Equilibrium pressures [Pa]
+    const vector_fp& pressures() const {
+        return m_P;
+    }
+
+    //! Equilibrium mass fractions. Length: nStates() * nSpecies()
+    const vector_fp& massFractions() const {
+        return m_Y;
+    }
+
+    //! Number of states in the last call to equilibrate() which were solved
+    //! starting from the solution for a neighboring state
+    size_t nWarmStarts() const {
+        return m_nWarm;
+    }
+
+    //! Number of states in the last call to equilibrate() which were solved
+    //! starting from the estimate computed by ChemEquil::equilibrate(),
+    //! including states for which a warm start failed
+    size_t nColdStarts() const {
+        return m_nCold;
+    }
+
+    //! Number of states in the last call to equilibrate() for which a warm
+    //! start failed
+    size_t nFailedWarmStarts() const {
+        return m_nFailedWarm;
+    }
+
+protected:
+    //! Objects used by a single worker thread
+    struct Worker {
+        shared_ptr<Solution> sol;
+        unique_ptr<ChemEquil> equil;
+        vector_fp features; //!< Features of the solved states of a chunk
+        vector_fp solutions; //!< Solutions of the solved states of a chunk
+        size_t nWarm; //!< Number of warm starts
+        size_t nCold; //!< Number of cold starts
+        size_t nFailedWarm; //!< Number of failed warm starts
+    };
+
+    //! Equilibrate the states of chunk `c` using worker `w`
+    void run(Worker& w, size_t c, const std::string& XY);
+
+    size_t m_nsp; //!< Number of species
+    size_t m_nel; //!< Number of elements
+    std::vector<Worker> m_workers;
+
+    size_t m_chunkSize; //!< Number of states in each chunk
+    double m_rtol; //!< Relative tolerance
+
+    //! Initial states
+    vector_fp m_T0, m_P0, m_Y0;
+
+    //! Equilibrium states
+    vector_fp m_T, m_P, m_Y;
+
+    size_t m_nWarm; //!< Number of warm starts
+    size_t m_nCold; //!< Number of cold starts
+    size_t m_nFailedWarm; //!< Number of failed warm starts
+};
+
+}
+
+#endif
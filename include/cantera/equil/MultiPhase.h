@@ -16,6 +16,7 @@ namespace Cantera
 {
 
 class ThermoPhase;
+class vcs_MultiPhaseEquil;
 
 //! @defgroup equilfunctions Classes and functions used for calculating
 //!     chemical equilibrium.
@@ -66,9 +67,9 @@ public:
      */
     MultiPhase();
 
-    //! Destructor. Does nothing. Class MultiPhase does not take "ownership"
-    //! (that is, responsibility for destroying) the phase objects.
-    virtual ~MultiPhase() {}
+    //! Destructor. Class MultiPhase does not take "ownership" (that is,
+    //! responsibility for destroying) the phase objects.
+    virtual ~MultiPhase();
 
     //! Add a vector of phases to the mixture
     /*!
@@ -365,6 +366,23 @@ public:
                      double rtol=1e-9, int max_steps=50000, int max_iter=100,
                      int estimate_equil=0, int log_level=0);
 
+    //! Keep the VCS solver between calls to equilibrate()
+    /*!
+     * If enabled, the vcs_MultiPhaseEquil object created by a successful
+     * calculation using the 'vcs' solver is kept and used for the following
+     * calculations. This avoids setting up the problem again, and allows the
+     * component basis of the previous calculation to be reused, which is
+     * useful for repeated calculations at nearby conditions. The solver is
+     * discarded if a calculation fails or if the option is disabled. The
+     * default is false.
+     */
+    void setReuseVcsSolver(bool reuse);
+
+    //! The VCS solver kept by setReuseVcsSolver(), or nullptr if there is none
+    const vcs_MultiPhaseEquil* vcsSolver() const {
+        return m_vcsSolver.get();
+    }
+
     //! Set the temperature [K].
     /*!
      * @param T   value of the temperature (Kelvin)
@@ -657,6 +675,12 @@ private:
      *      species in all phases.
      */
     mutable vector_fp m_elemAbundances;
+
+    //! True if the VCS solver is kept between calls to equilibrate()
+    bool m_reuseVcs;
+
+    //! VCS solver kept from the previous call to equilibrate()
+    unique_ptr<vcs_MultiPhaseEquil> m_vcsSolver;
 };
 
 //! Function to output a MultiPhase description to a stream
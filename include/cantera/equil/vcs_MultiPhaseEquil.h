@@ -58,10 +58,35 @@ public:
         return m_iter;
     }
 
+    //! Number of evaluations of the stoichiometric reaction matrix by solving
+    //! the linear system for the formula matrix of the components, summed over
+    //! all calculations done by this object
+    int nBasisFactorizations() const {
+        return m_vsolve.m_VCount->T_Basis_Factorizations;
+    }
+
+    //! Number of evaluations of the stoichiometric reaction matrix by rank-one
+    //! updates after an exchange of components, summed over all calculations
+    //! done by this object
+    int nBasisUpdates() const {
+        return m_vsolve.m_VCount->T_Basis_Updates;
+    }
+
+    //! Number of optimizations of the component basis which kept the set of
+    //! components, reusing the stoichiometric reaction matrix, summed over all
+    //! calculations done by this object
+    int nBasisReuses() const {
+        return m_vsolve.m_VCount->T_Basis_Reuses;
+    }
+
     //! Equilibrate the solution using the current element abundances
     //! stored in the MultiPhase object
     /*!
      * Use the vcs algorithm to equilibrate the current multiphase mixture.
+     * The initial mole numbers are taken from the MultiPhase object, so the
+     * same object can be used for repeated calculations after the state of
+     * the mixture has been changed. The workspace and the component basis of
+     * the previous calculation are reused in this case.
      *
      * @param XY       Integer representing what two thermo quantities are
      *                 held constant during the equilibration
@@ -77,6 +77,12 @@ namespace Cantera
 #define VCS_MAXSTEPS 50000
 #endif
 
+//! Maximum number of rank-one updates of the stoichiometric reaction matrix
+//! before it is recomputed from the formula matrix of the components
+#ifndef VCS_MAX_BASIS_UPDATES
+#define VCS_MAX_BASIS_UPDATES 20
+#endif
+
 //! @}
 
 //! @name  Species Categories used during the iteration
@@ -46,6 +46,30 @@ public:
     //! number of optimizations of the components basis set done
     int Basis_Opts;
 
+    //! Total number of evaluations of the stoichiometric reaction matrix by
+    //! solving the linear system for the formula matrix of the components
+    int T_Basis_Factorizations;
+
+    //! Current number of evaluations of the stoichiometric reaction matrix by
+    //! solving the linear system for the formula matrix of the components
+    int Basis_Factorizations;
+
+    //! Total number of rank-one updates of the stoichiometric reaction matrix
+    //! after exchanges of components
+    int T_Basis_Updates;
+
+    //! Current number of rank-one updates of the stoichiometric reaction
+    //! matrix after exchanges of components
+    int Basis_Updates;
+
+    //! Total number of basis optimizations which kept the set of components,
+    //! reusing the stoichiometric reaction matrix
+    int T_Basis_Reuses;
+
+    //! Current number of basis optimizations which kept the set of
+    //! components, reusing the stoichiometric reaction matrix
+    int Basis_Reuses;
+
     //! Current number of times the initial thermo equilibrium estimator has
     //! been called
     int T_Calls_Inest;
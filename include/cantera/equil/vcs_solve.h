@@ -159,6 +159,29 @@ public:
     int vcs_basopt(const bool doJustComponents, double aw[], double sa[], double sm[],
                    double ss[], double test, bool* const usedZeroedSpecies);
 
+    //! Evaluate the stoichiometric reaction matrix from the matrix stored for
+    //! a previous basis
+    /*!
+     * If the current components are the same species as those of the stored
+     * basis, the stored matrix is reused. If some components have been
+     * exchanged for other species, the stored matrix is updated by one
+     * rank-one update (a pivot of the reduced canonical form) for each
+     * exchanged component. The stored matrix is indexed by the species
+     * indices of the MultiPhase object, so that it is not affected by the
+     * rearrangement of the species vector.
+     *
+     * @returns false if there is no stored basis, if the number of components
+     *     has changed, if a pivot is too small, or if the number of updates
+     *     since the last evaluation by vcs_basopt() would exceed
+     *     #VCS_MAX_BASIS_UPDATES. In this case, `m_stoichCoeffRxnMatrix` is
+     *     not changed.
+     */
+    bool vcs_basisUpdate();
+
+    //! Store the current stoichiometric reaction matrix for reuse by
+    //! vcs_basisUpdate()
+    void vcs_basisSave();
+
     //!  Choose a species to test for the next component
     /*!
      * We make the choice based on testing (molNum[i] * spSize[i]) for its
@@ -628,6 +651,15 @@ public:
      */
     void vcs_elab();
 
+    //! Computes the element abundances to be satisfied, m_elemAbundancesGoal[],
+    //! from the current species mole numbers
+    /*!
+     * Abundances of lattice ratio constraints below 1.0E-10 and of charge
+     * neutrality constraints below 1.0E-9 are set to zero. Larger nonzero
+     * abundances of charge neutrality constraints are an error.
+     */
+    void vcs_elabGoal();
+
     /*!
      * Checks to see if the element abundances are in compliance. If they are,
      * then TRUE is returned. If not, FALSE is returned. Note the number of
@@ -742,6 +774,18 @@ public:
     //! Fully specify the problem to be solved
     void vcs_prob_specifyFully();
 
+    //! Reload the initial mole numbers and the element abundances from the
+    //! MultiPhase object
+    /*!
+     * This allows the same object to be used to solve a new problem for the
+     * same MultiPhase object after its state has been changed. The species are
+     * returned to their original order and the intermediate results of the
+     * previous calculation are discarded, so that the calculation starts as
+     * it would for a new object, while the workspace and the component basis
+     * stored by vcs_basisSave() are kept.
+     */
+    void vcs_prob_reload();
+
 private:
     //! Zero out the concentration of a species.
     /*!
@@ -1484,6 +1528,25 @@ public:
     //! Timing and iteration counters for the vcs object
     VCS_COUNTERS* m_VCount;
 
+    //! Components of the basis stored by vcs_basisSave(), as species indices
+    //! of the MultiPhase object. Empty if there is no stored basis.
+    std::vector<size_t> m_basisComponents;
+
+    //! Stoichiometric reaction matrix of the stored basis
+    /*!
+     * `m_basisStoich(j,k)` is the stoichiometric coefficient of component j of
+     * #m_basisComponents in the formation reaction of species k, where k is
+     * the species index of the MultiPhase object. The columns of the
+     * components are zero. Small coefficients are not zeroed.
+     *
+     * size = number of components x nspecies0
+     */
+    Array2D m_basisStoich;
+
+    //! Number of rank-one updates of #m_basisStoich since it was stored by
+    //! vcs_basisSave()
+    size_t m_basisNumUpdates;
+
     //! Debug printing lvl
     /*!
      *  Levels correspond to the following guidelines
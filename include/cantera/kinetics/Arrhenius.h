@@ -222,6 +222,12 @@ public:
     double ddTScaledFromStruct(const ArrheniusData& shared_data) const {
         return (m_Ea_R * shared_data.recipT + m_b) * shared_data.recipT;
     }
+
+    //! Return the activation energy divided by the gas constant (that is, the
+    //! activation temperature) [K]
+    double activationEnergy_R() const {
+        return m_Ea_R;
+    }
 };
 
 }
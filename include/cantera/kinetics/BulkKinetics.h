@@ -45,13 +45,29 @@ public:
     virtual void setMultiplier(size_t i, double f);
     virtual void invalidateCache();
 
+    virtual void setRateTabulation(double Tmin, double Tmax, double rtol=1e-6);
+    virtual void clearRateTabulation();
+    virtual void setActiveReactions(const std::vector<bool>& active);
+
     void addThirdBody(shared_ptr<Reaction> r);
 
 protected:
+    //! Copy constructor used to implement clone(). Rate handlers are copied,
+    //! while Reaction objects are shared with `other`.
+    BulkKinetics(const BulkKinetics& other);
+
     //! Vector of rate handlers
     std::vector<unique_ptr<MultiRateBase>> m_bulk_rates;
     std::map<std::string, size_t> m_bulk_types; //!< Mapping of rate handlers
 
+    //! Temperature range and tolerance for tabulated rate constants; see
+    //! setRateTabulation(). Tabulation is disabled if #m_tab_rtol is zero.
+    double m_tab_Tmin, m_tab_Tmax, m_tab_rtol;
+
+    //! Flags indicating whether each reaction is active; empty if all
+    //! reactions are active. See setActiveReactions().
+    std::vector<bool> m_active;
+
     std::vector<size_t> m_revindex; //!< Indices of reversible reactions
     std::vector<size_t> m_irrev; //!< Indices of irreversible reactions
 
@@ -27,9 +27,21 @@ public:
         m_nDim = 1;
     }
 
+    virtual shared_ptr<Kinetics> clone(
+            const std::vector<ThermoPhase*>& phases) const {
+        shared_ptr<EdgeKinetics> kin(new EdgeKinetics(*this));
+        kin->setClonePhases(phases);
+        kin->init();
+        return kin;
+    }
+
     virtual std::string kineticsType() const {
         return "Edge";
     }
+
+protected:
+    //! Copy constructor used to implement clone()
+    EdgeKinetics(const EdgeKinetics& other) = default;
 };
 }
 
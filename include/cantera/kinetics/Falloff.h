@@ -203,24 +203,42 @@ public:
         updateTemp(shared_data.temperature, m_work.data());
         m_rc_low = m_lowRate.evalRate(shared_data.logT, shared_data.recipT);
         m_rc_high = m_highRate.evalRate(shared_data.logT, shared_data.recipT);
-        double thirdBodyConcentration;
-        if (shared_data.ready) {
-            thirdBodyConcentration = shared_data.conc_3b[m_rate_index];
-        } else {
-            thirdBodyConcentration = shared_data.conc_3b[0];
-        }
-        double pr = thirdBodyConcentration * m_rc_low / (m_rc_high + SmallNumber);
+        return evalFalloff(shared_data, m_work.data());
+    }
 
-        // Apply falloff function
-        if (m_chemicallyActivated) {
-            // 1 / (1 + Pr) * F
-            pr = F(pr, m_work.data()) / (1.0 + pr);
-            return pr * m_rc_low;
+    //! Number of temperature-dependent terms used by evalFromTemperatureTerms()
+    size_t nTemperatureTerms() const {
+        return 2 + m_work.size();
+    }
+
+    //! Evaluate the terms of the rate expression which depend only on
+    //! temperature. These are the logarithms of the low- and high-pressure
+    //! limit rate constants, followed by the intermediate results of the
+    //! falloff function calculated by updateTemp(). Used for tabulation of
+    //! rate constants; see MultiRateBase::setTabulation().
+    //! @param shared_data  data shared by all reactions of a given type
+    //! @param[out] terms  array of length nTemperatureTerms()
+    //! @returns  `false` if the terms cannot be tabulated because one of the
+    //!     limiting rate constants is not positive
+    bool getTemperatureTerms(const FalloffData& shared_data, double* terms) const {
+        double k_low = m_lowRate.evalRate(shared_data.logT, shared_data.recipT);
+        double k_high = m_highRate.evalRate(shared_data.logT, shared_data.recipT);
+        if (k_low <= 0 || k_high <= 0) {
+            return false;
         }
+        terms[0] = std::log(k_low);
+        terms[1] = std::log(k_high);
+        updateTemp(shared_data.temperature, terms + 2);
+        return true;
+    }
 
-        // Pr / (1 + Pr) * F
-        pr *= F(pr, m_work.data()) / (1.0 + pr);
-        return pr * m_rc_high;
+    //! Evaluate reaction rate using temperature-dependent terms calculated by
+    //! getTemperatureTerms()
+    double evalFromTemperatureTerms(const FalloffData& shared_data,
+                                    const double* terms) {
+        m_rc_low = std::exp(terms[0]);
+        m_rc_high = std::exp(terms[1]);
+        return evalFalloff(shared_data, terms + 2);
     }
 
     virtual void check(const std::string& equation) override;
@@ -263,6 +281,30 @@ public:
     void setHighRate(const ArrheniusRate& high);
 
 protected:
+    //! Evaluate reaction rate from the current limiting rate constants
+    //! #m_rc_low and #m_rc_high, and the temperature-dependent intermediate
+    //! results `work` of the falloff function
+    double evalFalloff(const FalloffData& shared_data, const double* work) {
+        double thirdBodyConcentration;
+        if (shared_data.ready) {
+            thirdBodyConcentration = shared_data.conc_3b[m_rate_index];
+        } else {
+            thirdBodyConcentration = shared_data.conc_3b[0];
+        }
+        double pr = thirdBodyConcentration * m_rc_low / (m_rc_high + SmallNumber);
+
+        // Apply falloff function
+        if (m_chemicallyActivated) {
+            // 1 / (1 + Pr) * F
+            pr = F(pr, work) / (1.0 + pr);
+            return pr * m_rc_low;
+        }
+
+        // Pr / (1 + Pr) * F
+        pr *= F(pr, work) / (1.0 + pr);
+        return pr * m_rc_high;
+    }
+
     ArrheniusRate m_lowRate; //!< The reaction rate in the low-pressure limit
     ArrheniusRate m_highRate; //!< The reaction rate in the high-pressure limit
 
@@ -33,6 +33,9 @@ public:
      */
     GasKinetics(ThermoPhase* thermo = 0);
 
+    virtual shared_ptr<Kinetics> clone(
+        const std::vector<ThermoPhase*>& phases) const;
+
     virtual std::string kineticsType() const {
         return "Gas";
     }
@@ -49,6 +52,42 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(double* kfwd);
 
+    //! @}
+    //! @name Evaluation for Multiple States
+    //! @{
+
+    using Kinetics::getNetProductionRates;
+
+    //! Species net production rates [kmol/m^3/s] for a block of gas states.
+    /*!
+     * Evaluates net production rates for `nStates` independent states in a
+     * single call. Properties which require the state of the ThermoPhase
+     * object (concentrations, equilibrium constants, third-body concentrations
+     * and rate constants of types other than Arrhenius) are evaluated state by
+     * state. Arrhenius rate constants are evaluated for all states at once,
+     * and the remaining steps (third-body and concentration products, reverse
+     * rates and the net production rates) operate on all states together. All
+     * of these passes loop over states in their innermost loops, which allows
+     * them to be vectorized. The state of the underlying ThermoPhase object is
+     * restored on return.
+     *
+     * Mass fractions and production rates use a structure-of-arrays layout,
+     * where the value for species `k` in state `n` is stored at index
+     * `k * nStates + n`.
+     *
+     * @param nStates  Number of states
+     * @param T  Temperatures [K]. Length: nStates
+     * @param P  Pressures [Pa]. Length: nStates
+     * @param Y  Mass fractions. Length: nTotalSpecies() * nStates
+     * @param wdot  Output array of net production rates. Length:
+     *     nTotalSpecies() * nStates
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    void getNetProductionRates(size_t nStates, const double* T, const double* P,
+                               const double* Y, double* wdot);
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
@@ -89,6 +128,9 @@ public:
     virtual void update_rates_C();
 
 protected:
+    //! Copy constructor used to implement clone()
+    GasKinetics(const GasKinetics& other) = default;
+
     //! @name Internal service methods
     //!
     //! @note These methods are for internal use, and seek to avoid code duplication
@@ -159,6 +201,22 @@ protected:
     vector_fp m_sbuf0;
     vector_fp m_state;
 
+    //! @name Work arrays for the evaluation of multiple states
+    //! The value for species or reaction `i` in state `n` is stored at index
+    //! `i * nStates + n`.
+    //! @{
+
+    vector_fp m_blk_ropf; //!< Forward (and net) rates of progress
+    vector_fp m_blk_ropr; //!< Reverse rates of progress
+    vector_fp m_blk_concm; //!< Third-body concentrations
+    vector_fp m_blk_conc; //!< Activity concentrations
+    vector_fp m_blk_logT; //!< Logarithms of the temperatures
+    vector_fp m_blk_recipT; //!< Inverse temperatures
+    std::vector<bool> m_blk_rates; //!< Rate handlers evaluated for all states
+    std::vector<size_t> m_blk_rxns; //!< Reactions evaluated for each state
+
+    //! @}
+
     //! Derivative settings
     bool m_jac_skip_third_bodies;
     bool m_jac_skip_falloff;
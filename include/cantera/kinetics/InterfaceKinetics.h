@@ -68,6 +68,9 @@ public:
 
     virtual ~InterfaceKinetics();
 
+    virtual shared_ptr<Kinetics> clone(
+        const std::vector<ThermoPhase*>& phases) const;
+
     virtual void resizeReactions();
 
     virtual std::string kineticsType() const {
@@ -122,6 +125,32 @@ public:
     virtual void getRevRateConstants(doublereal* krev,
                                      bool doIrreversible = false);
 
+    //! @}
+    //! @name Routines to Calculate Derivatives (Jacobians)
+    //!
+    //! Temperature derivatives are evaluated at constant species
+    //! concentrations, where the temperatures of all phases are perturbed.
+    //! Derivatives with respect to species concentrations are evaluated
+    //! analytically, including the dependence of rate constants on surface
+    //! coverages. Here, the coverage of a surface species is \f$ \theta_k =
+    //! C_k \sigma_k / \Gamma \f$, where \f$ \sigma_k \f$ is the number of
+    //! sites occupied by the species and \f$ \Gamma \f$ is the site density.
+    //! For the law of mass action, species concentrations are taken to be equal
+    //! to activity concentrations, which limits the evaluation to ideal phases.
+    //! Corrections applied to rates of progress for phases that do not exist
+    //! are not considered.
+    //! @{
+
+    virtual void getDerivativeSettings(AnyMap& settings) const;
+    virtual void setDerivativeSettings(const AnyMap& settings);
+    virtual void getFwdRateConstants_ddT(double* dkfwd);
+    virtual void getFwdRatesOfProgress_ddT(double* drop);
+    virtual void getRevRatesOfProgress_ddT(double* drop);
+    virtual void getNetRatesOfProgress_ddT(double* drop);
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddCi();
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddCi();
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddCi();
+
     //! @}
     //! @name Reaction Mechanism Construction
     //! @{
@@ -288,6 +317,11 @@ public:
     int phaseStability(const size_t iphase) const;
 
 protected:
+    //! Copy constructor used to implement clone(). Rate handlers are copied,
+    //! while Reaction objects are shared with `other`. The surface phase of
+    //! the copy is set by init().
+    InterfaceKinetics(const InterfaceKinetics& other);
+
     //! Temporary work vector of length m_kk
     vector_fp m_grt;
 
@@ -443,6 +477,31 @@ protected:
 
     int m_ioFlag;
 
+    //! @name Internal routines and data used for derivative evaluation
+    //! @{
+
+    //! Evaluate derivatives of forward and reverse rate constants with respect
+    //! to temperature using finite differences
+    void processRateConstants_ddT(double* dkfwd, double* dkrev);
+
+    //! Evaluate derivatives of rates of progress with respect to species
+    //! concentrations, for rates of progress `rop` obtained by multiplying the
+    //! rate constants `kf` with the activity concentration products of `stoich`
+    Eigen::SparseMatrix<double> process_ddCi(StoichManagerN& stoich,
+        const vector_fp& kf, const vector_fp& rop);
+
+    //! Helper function ensuring that all phases use ideal thermo models
+    void assertDerivativesValid(const std::string& name);
+
+    bool m_jac_skip_coverage_dependence; //!< Skip coverage-dependent rate constants
+    double m_jac_rtol_delta; //!< Relative temperature perturbation
+    vector_fp m_rbuf0; //!< Work array of length nReactions()
+    vector_fp m_rbuf1; //!< Work array of length nReactions()
+    SparseTriplets m_jac_trips; //!< Work array for coverage derivatives
+    std::vector<vector_fp> m_jac_states; //!< Saved states of all phases
+
+    //! @}
+
     //! Number of dimensions of reacting phase (2 for InterfaceKinetics, 1 for
     //! EdgeKinetics)
     size_t m_nDim;
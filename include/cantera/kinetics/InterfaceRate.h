@@ -136,6 +136,17 @@ public:
     //! @param shared_data  data shared by all reactions of a given type
     void updateFromStruct(const InterfaceData& shared_data);
 
+    //! Evaluate derivatives of the coverage-dependent terms of the reaction rate
+    //! with respect to surface coverages, divided by the reaction rate
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     *  @param[in,out] ddCov  pairs of species index within the surface phase and
+     *      scaled derivative, to which entries are appended for all species
+     *      the rate depends on
+     */
+    void ddCoverageScaledFromStruct(const InterfaceData& shared_data,
+        std::vector<std::pair<size_t, double>>& ddCov) const;
+
     //! Calculate modifications for the forward reaction rate for interfacial charge
     //! transfer reactions.
     /*!
@@ -564,6 +575,29 @@ public:
         throw NotImplementedError("StickingRate<>::ddTScaledFromStruct");
     }
 
+    //! Evaluate derivatives of reaction rate with respect to surface coverages
+    //! divided by reaction rate
+    //! @param shared_data  data shared by all reactions of a given type
+    //! @param[in,out] ddCov  pairs of species index and scaled derivative
+    void ddCoverageScaledFromStruct(const DataType& shared_data,
+        std::vector<std::pair<size_t, double>>& ddCov) const
+    {
+        size_t n0 = ddCov.size();
+        InterfaceRateBase::ddCoverageScaledFromStruct(shared_data, ddCov);
+        if (m_motzWise) {
+            // derivative of the Motz-Wise correction k / (1 - k / 2)
+            double k = RateType::evalRate(shared_data.logT, shared_data.recipT) *
+                std::exp(std::log(10.0) * m_acov - m_ecov * shared_data.recipT + m_mcov);
+            if (m_chargeTransfer) {
+                k *= voltageCorrection();
+            }
+            double factor = 1. / (1 - 0.5 * k);
+            for (size_t i = n0; i < ddCov.size(); i++) {
+                ddCov[i].second *= factor;
+            }
+        }
+    }
+
     virtual double preExponentialFactor() const override {
         return RateType::preExponentialFactor() *
             std::exp(std::log(10.0) * m_acov + m_mcov);
@@ -121,8 +121,8 @@ public:
 
     virtual ~Kinetics();
 
-    //! Kinetics objects are not copyable or assignable
-    Kinetics(const Kinetics&) = delete;
+    //! Kinetics objects are not assignable. Copies for a different set of
+    //! phases are created using clone().
     Kinetics& operator=(const Kinetics&)= delete;
 
     //! Identifies the Kinetics manager type.
@@ -140,6 +140,22 @@ public:
         return m_reactions.size();
     }
 
+    //! Create a copy of this Kinetics object for a different set of phases.
+    /*!
+     *  The copy shares the Reaction objects of this object, and has its own
+     *  copies of the rate evaluators, stoichiometric coefficients and work
+     *  arrays, so the reactions do not need to be processed again. The
+     *  Reaction and ReactionRate objects are not modified.
+     *
+     *  @param phases  Phases of the new object, which must contain the same
+     *      species as the phases of this object, in the same order.
+     *
+     *  @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual shared_ptr<Kinetics> clone(
+        const std::vector<ThermoPhase*>& phases) const;
+
     //! Check that the specified reaction index is in range
     //! Throws an exception if i is greater than nReactions()
     void checkReactionIndex(size_t m) const;
@@ -579,6 +595,7 @@ public:
     //!  - `_ddP`: derivative with respect to pressure (a vector)
     //!  - `_ddC`: derivative with respect to molar concentration (a vector)
     //!  - `_ddX`: derivative with respect to species mole fractions (a matrix)
+    //!  - `_ddCi`: derivative with respect to species concentrations (a matrix)
     //!
     //! Settings for derivative evaluation are set by keyword/value pairs using
     //! the methods getDerivativeSettings() and setDerivativeSettings().
@@ -591,6 +608,14 @@ public:
     //!  - `rtol-delta` (double) ... relative tolerance used to perturb properties
     //!    when calculating numerical derivatives. The default value is 1e-8.
     //!
+    //! For InterfaceKinetics, the following keyword/value pairs are supported:
+    //!  - `skip-coverage-dependence` (boolean) ... if `false` (default), rate
+    //!    constants that depend on surface coverages are considered for the
+    //!    evaluation of derivatives.
+    //!  - `rtol-delta` (double) ... relative tolerance used to perturb the
+    //!    temperature when calculating numerical derivatives. The default value
+    //!    is 1e-8.
+    //!
     //! @warning  The calculation of derivatives is an experimental part of the
     //!      %Cantera API and may be changed or removed without notice.
     //! @{
@@ -706,6 +731,22 @@ public:
             "Not implemented for kinetics type '{}'.", kineticsType());
     }
 
+    /**
+     * Calculate derivatives for forward rates-of-progress with respect to species
+     * concentrations at constant temperature and concentrations of all other
+     * species.
+     *
+     * The method returns a matrix with nReactions rows and nTotalSpecies columns.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddCi()
+    {
+        throw NotImplementedError("Kinetics::fwdRatesOfProgress_ddCi",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
     /**
      * Calculate derivatives for reverse rates-of-progress with respect to temperature
      * at constant pressure, molar concentration and mole fractions.
@@ -759,6 +800,22 @@ public:
             "Not implemented for kinetics type '{}'.", kineticsType());
     }
 
+    /**
+     * Calculate derivatives for reverse rates-of-progress with respect to species
+     * concentrations at constant temperature and concentrations of all other
+     * species.
+     *
+     * The method returns a matrix with nReactions rows and nTotalSpecies columns.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddCi()
+    {
+        throw NotImplementedError("Kinetics::revRatesOfProgress_ddCi",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
     /**
      * Calculate derivatives for net rates-of-progress with respect to temperature
      * at constant pressure, molar concentration and mole fractions.
@@ -812,6 +869,22 @@ public:
             "Not implemented for kinetics type '{}'.", kineticsType());
     }
 
+    /**
+     * Calculate derivatives for net rates-of-progress with respect to species
+     * concentrations at constant temperature and concentrations of all other
+     * species.
+     *
+     * The method returns a matrix with nReactions rows and nTotalSpecies columns.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddCi()
+    {
+        throw NotImplementedError("Kinetics::netRatesOfProgress_ddCi",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
     /**
      * Calculate derivatives for species creation rates with respect to temperature
      * at constant pressure, molar concentration and mole fractions.
@@ -923,6 +996,18 @@ public:
      */
     Eigen::SparseMatrix<double> netProductionRates_ddX();
 
+    /**
+     * Calculate derivatives for species net production rates with respect to
+     * species concentrations at constant temperature and concentrations of all
+     * other species.
+     *
+     * The method returns a matrix with nTotalSpecies rows and nTotalSpecies columns.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    Eigen::SparseMatrix<double> netProductionRates_ddCi();
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
@@ -1202,6 +1287,51 @@ public:
 
     virtual void invalidateCache() {};
 
+    //! Evaluate rate constants by interpolation in tables of log(k) for
+    //! temperatures between `Tmin` and `Tmax`.
+    /*!
+     * Tabulation applies to rate types which depend on temperature only, such
+     * as Arrhenius rates, and to the temperature-dependent parts of falloff
+     * rates; other rate types are evaluated directly. See
+     * MultiRateBase::setTabulation() for details.
+     *
+     * @param Tmin  lower limit of the tabulated temperature range [K]
+     * @param Tmax  upper limit of the tabulated temperature range [K]
+     * @param rtol  relative tolerance for the interpolated rate constants
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual void setRateTabulation(double Tmin, double Tmax, double rtol=1e-6) {
+        throw NotImplementedError("Kinetics::setRateTabulation",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    //! Evaluate all rate constants directly. Undoes the effect of
+    //! setRateTabulation().
+    virtual void clearRateTabulation() {
+        throw NotImplementedError("Kinetics::clearRateTabulation",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    //! Restrict the evaluation of reaction rates to a subset of reactions.
+    /*!
+     * The rate constants, and therefore the rates of progress, of inactive
+     * reactions are set to zero. This is used to integrate with a reduced
+     * mechanism which is adapted to the local conditions, without changing
+     * the species or reactions of the Kinetics object.
+     *
+     * @param active  flags indicating whether each reaction is active. If
+     *     empty, all reactions are active.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual void setActiveReactions(const std::vector<bool>& active) {
+        throw NotImplementedError("Kinetics::setActiveReactions",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
     //! @}
     //! Check for unmarked duplicate reactions and unmatched marked duplicates
     /**
@@ -1239,6 +1369,14 @@ public:
                                     const Composition& products);
 
 protected:
+    //! Copy constructor used to implement clone(). The copy refers to the
+    //! phases of `other` until they are replaced using setClonePhases().
+    Kinetics(const Kinetics& other) = default;
+
+    //! Replace the phases of a copy created by the copy constructor, and
+    //! invalidate data depending on the state of the original phases.
+    void setClonePhases(const std::vector<ThermoPhase*>& phases);
+
     //! Cache for saved calculations within each Kinetics object.
     ValueCache m_cache;
 
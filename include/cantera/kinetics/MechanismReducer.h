@@ -0,0 +1,143 @@
+/**
+ * @file MechanismReducer.h
+ *  Declarations for the MechanismReducer class, which determines the set of
+ *  reactions needed at the current state of a Kinetics object
+ *  (see \ref kineticsmgr and class
+ *  \link Cantera::MechanismReducer MechanismReducer\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_MECHANISMREDUCER_H
+#define CT_MECHANISMREDUCER_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Kinetics;
+
+//! Determines a reduced set of reactions for the current state of a Kinetics
+//! object using the directed relation graph with error propagation (DRGEP)
+//! method.
+/*!
+ * The direct interaction coefficient of species *A* with species *B* is
+ *
+ * \f[
+ *     r_{AB} = \frac{\left| \sum_i \nu_{A,i} \omega_i \delta_{B,i} \right|}
+ *                   {\max(P_A, C_A)}
+ * \f]
+ *
+ * where \f$ \nu_{A,i} \f$ is the net stoichiometric coefficient of species *A*
+ * in reaction *i*, \f$ \omega_i \f$ is the net rate of progress of reaction
+ * *i*, \f$ \delta_{B,i} \f$ is one if species *B* participates in reaction *i*
+ * and zero otherwise, and \f$ P_A \f$ and \f$ C_A \f$ are the total production
+ * and consumption rates of species *A*. The importance of each species is the
+ * maximum over all paths from any of the target species of the product of the
+ * direct interaction coefficients along the path. Species with an importance
+ * of at least the threshold are retained, and reactions are active if all
+ * of their reactants and products are retained.
+ *
+ * Reactions are not removed from the Kinetics object. Instead, the rate
+ * constants of inactive reactions are set to zero using
+ * Kinetics::setActiveReactions().
+ *
+ * @warning  This class is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ *
+ * @ingroup kineticsmgr
+ */
+class MechanismReducer
+{
+public:
+    //! Constructor
+    //! @param kin  Kinetics object to be reduced. The reactions of the Kinetics
+    //!     object must not change while it is used by the MechanismReducer.
+    explicit MechanismReducer(Kinetics& kin);
+
+    //! Set the species which are retained in any case. The importance of
+    //! other species is determined from their coupling with these species.
+    void setTargets(const std::vector<std::string>& names);
+
+    //! Set the minimum importance of retained species
+    void setThreshold(double threshold);
+
+    //! Get the minimum importance of retained species
+    double threshold() const {
+        return m_threshold;
+    }
+
+    //! Determine the set of active reactions at the current state of the
+    //! Kinetics object and apply it using Kinetics::setActiveReactions().
+    //! The rates of progress used in the analysis are evaluated for all
+    //! reactions. Returns the number of active reactions.
+    size_t update();
+
+    //! Restore all reactions of the Kinetics object
+    void clear();
+
+    //! Flags indicating whether each reaction is active, as determined by the
+    //! last call to update()
+    const std::vector<bool>& activeReactions() const {
+        return m_active;
+    }
+
+    //! Number of active reactions, as determined by the last call to update()
+    size_t nActiveReactions() const {
+        return m_nActive;
+    }
+
+    //! Importance of each species, as determined by the last call to update()
+    const vector_fp& importance() const {
+        return m_importance;
+    }
+
+protected:
+    Kinetics& m_kin;
+
+    //! Indices of the target species
+    std::vector<size_t> m_targets;
+
+    //! Minimum importance of retained species
+    double m_threshold;
+
+    //! @name Reaction participants
+    //! Species participating in reaction `i` are stored at positions
+    //! `m_rxnStart[i]` to `m_rxnStart[i+1] - 1`.
+    //! @{
+    std::vector<size_t> m_rxnStart;
+    std::vector<size_t> m_rxnSpecies; //!< Species indices
+    vector_fp m_rxnNu; //!< Net stoichiometric coefficients
+    //! @}
+
+    //! @name Species pairs
+    //! Pairs of species *(A, B)* where *A* has a nonzero net stoichiometric
+    //! coefficient in a reaction in which *B* participates. The pairs
+    //! contributed by reaction `i` are stored at positions `m_pairStart[i]` to
+    //! `m_pairStart[i+1] - 1` of #m_rxnPairs and #m_rxnPairNu, and the pairs
+    //! with source species `A` are stored at positions `m_edgeStart[A]` to
+    //! `m_edgeStart[A+1] - 1` of #m_edgeTarget and #m_edgePair.
+    //! @{
+    std::vector<size_t> m_pairStart;
+    std::vector<size_t> m_rxnPairs; //!< Pair indices for each reaction
+    vector_fp m_rxnPairNu; //!< Net stoichiometric coefficient of species A
+    std::vector<size_t> m_edgeStart;
+    std::vector<size_t> m_edgeTarget; //!< Species B of each pair
+    std::vector<size_t> m_edgePair; //!< Pair index
+    //! @}
+
+    std::vector<bool> m_active; //!< Active reactions
+    size_t m_nActive; //!< Number of active reactions
+    vector_fp m_importance; //!< Importance of each species
+
+    vector_fp m_ropnet; //!< Net rates of progress
+    vector_fp m_interaction; //!< Numerators of the interaction coefficients
+    vector_fp m_prod; //!< Total production rates
+    vector_fp m_cons; //!< Total consumption rates
+};
+
+}
+
+#endif
@@ -15,6 +15,9 @@
 namespace Cantera
 {
 
+class ArrheniusRate;
+struct ArrheniusData;
+
 //! A class template handling ReactionRate specializations.
 template <class RateType, class DataType>
 class MultiRate final : public MultiRateBase
@@ -23,6 +26,8 @@ class MultiRate final : public MultiRateBase
     CT_DEFINE_HAS_MEMBER(has_ddT, ddTScaledFromStruct)
     CT_DEFINE_HAS_MEMBER(has_ddP, perturbPressure)
     CT_DEFINE_HAS_MEMBER(has_ddM, perturbThirdBodies)
+    CT_DEFINE_HAS_MEMBER(has_ddCov, ddCoverageScaledFromStruct)
+    CT_DEFINE_HAS_MEMBER(has_terms, evalFromTemperatureTerms)
 
 public:
     virtual std::string type() override {
@@ -33,10 +38,23 @@ public:
         return m_rxn_rates.at(0).second.type();
     }
 
+    virtual unique_ptr<MultiRateBase> clone() const override {
+        unique_ptr<MultiRate<RateType, DataType>> copy(
+            new MultiRate<RateType, DataType>(*this));
+        copy->m_shared.invalidateCache();
+        return copy;
+    }
+
     virtual void add(size_t rxn_index, ReactionRate& rate) override {
         m_indices[rxn_index] = m_rxn_rates.size();
         m_rxn_rates.emplace_back(rxn_index, dynamic_cast<RateType&>(rate));
+        _storeParameters(m_rxn_rates.size() - 1);
+        if (m_masked) {
+            // new reactions are active
+            m_active.push_back(m_rxn_rates.size() - 1);
+        }
         m_shared.invalidateCache();
+        m_tab_ok = false;
     }
 
     virtual bool replace(size_t rxn_index, ReactionRate& rate) override {
@@ -54,6 +72,8 @@ public:
         if (m_indices.find(rxn_index) != m_indices.end()) {
             size_t j = m_indices[rxn_index];
             m_rxn_rates.at(j).second = dynamic_cast<RateType&>(rate);
+            _storeParameters(j);
+            m_tab_ok = false;
             return true;
         }
         return false;
@@ -65,9 +85,32 @@ public:
     }
 
     virtual void getRateConstants(double* kf) override {
-        for (auto& rxn : m_rxn_rates) {
-            kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+        if (m_masked) {
+            for (size_t j : m_inactive) {
+                kf[m_rxn_rates[j].first] = 0.0;
+            }
+            for (size_t j : m_active) {
+                auto& rxn = m_rxn_rates[j];
+                kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+            }
+            return;
+        }
+        if (m_tabulate && m_shared.temperature >= m_tab_Tmin
+            && m_shared.temperature <= m_tab_Tmax)
+        {
+            _getTabulatedRateConstants(kf);
+            return;
         }
+        // call helper function: implementation depends on whether rate parameters
+        // are stored in contiguous arrays
+        _getRateConstants(kf);
+    }
+
+    virtual bool getRateConstants(size_t nStates, const double* logT,
+                                  const double* recipT, double* kf) override {
+        // call helper function: only implemented for rates stored in contiguous
+        // parameter arrays
+        return _getRateConstants(nStates, logT, recipT, kf);
     }
 
     virtual void processRateConstants_ddT(double* rop,
@@ -98,6 +141,14 @@ public:
         _process_ddM(rop, kf, deltaM, overwrite);
     }
 
+    virtual void processRateConstants_ddCov(const double* rop,
+                                            SparseTriplets& jac) override
+    {
+        // call helper function: implementation of derivative depends on whether
+        // ReactionRate::ddCoverageScaledFromStruct is defined
+        _process_ddCov(rop, jac);
+    }
+
     virtual void update(double T) override {
         m_shared.update(T);
         _update();
@@ -123,13 +174,158 @@ public:
         return changed;
     }
 
+    virtual bool setTabulation(double Tmin, double Tmax, double rtol) override {
+        // Only rates which depend on temperature alone, or which provide the
+        // temperature-dependent terms of the rate expression, can be tabulated
+        if (!std::is_same<DataType, ArrheniusData>::value
+            && !has_terms<RateType>::value) {
+            return false;
+        }
+        if (Tmin <= 0 || Tmax <= Tmin || rtol <= 0) {
+            throw CanteraError("MultiRate::setTabulation", "Invalid temperature "
+                "range [{}, {}] or tolerance {}.", Tmin, Tmax, rtol);
+        }
+        m_tab_Tmin = Tmin;
+        m_tab_Tmax = Tmax;
+        m_tab_rtol = rtol;
+        m_tabulate = true;
+        _buildTable();
+        // Rate constants and any rate-specific data are recomputed on the next
+        // update
+        m_shared.invalidateCache();
+        return true;
+    }
+
+    virtual void clearTabulation() override {
+        m_tabulate = false;
+        m_tab_ok = false;
+        m_tab_data.clear();
+        m_shared.invalidateCache();
+    }
+
+    virtual void setActiveReactions(const std::vector<bool>& active) override {
+        m_active.clear();
+        m_inactive.clear();
+        for (size_t j = 0; j < m_rxn_rates.size(); j++) {
+            size_t i = m_rxn_rates[j].first;
+            if (active.empty() || active.at(i)) {
+                m_active.push_back(j);
+            } else {
+                m_inactive.push_back(j);
+            }
+        }
+        m_masked = !m_inactive.empty();
+        m_shared.invalidateCache();
+    }
+
     virtual double evalSingle(ReactionRate& rate) override {
         RateType& R = static_cast<RateType&>(rate);
-        _updateRate(R);
+        _updateRate(R, m_shared);
         return R.evalFromStruct(m_shared);
     }
 
 protected:
+    //! Helper function evaluating ArrheniusRate objects from contiguous parameter
+    //! arrays.
+    /*!
+     * Evaluation is split into separate passes for the exponent, the exponential
+     * and the scatter into the output array. The first two passes operate on
+     * unit-stride data without any per-reaction function calls, which allows the
+     * compiler to vectorize them.
+     */
+    template <typename T=RateType,
+        typename std::enable_if<std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    void _getRateConstants(double* kf) {
+        size_t nRates = m_rxn_index.size();
+        const double logT = m_shared.logT;
+        const double recipT = m_shared.recipT;
+        const double* A = m_A.data();
+        const double* b = m_b.data();
+        const double* Ea_R = m_Ea_R.data();
+        double* buf = m_kbuf.data();
+        for (size_t j = 0; j < nRates; j++) {
+            buf[j] = b[j] * logT - Ea_R[j] * recipT;
+        }
+        for (size_t j = 0; j < nRates; j++) {
+            buf[j] = A[j] * std::exp(buf[j]);
+        }
+        for (size_t j = 0; j < nRates; j++) {
+            kf[m_rxn_index[j]] = buf[j];
+        }
+    }
+
+    //! Helper function evaluating rate types that are not stored in contiguous
+    //! parameter arrays.
+    template <typename T=RateType,
+        typename std::enable_if<!std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    void _getRateConstants(double* kf) {
+        for (auto& rxn : m_rxn_rates) {
+            kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+        }
+    }
+
+    //! Helper function evaluating ArrheniusRate objects for a block of
+    //! temperatures. The inner loop over temperatures has unit stride and can be
+    //! vectorized.
+    template <typename T=RateType,
+        typename std::enable_if<std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    bool _getRateConstants(size_t nStates, const double* logT,
+                           const double* recipT, double* kf) {
+        if (m_masked) {
+            for (size_t j : m_inactive) {
+                std::fill_n(kf + m_rxn_index[j] * nStates, nStates, 0.0);
+            }
+        }
+        size_t nRates = m_masked ? m_active.size() : m_rxn_index.size();
+        for (size_t jj = 0; jj < nRates; jj++) {
+            size_t j = m_masked ? m_active[jj] : jj;
+            const double A = m_A[j];
+            const double b = m_b[j];
+            const double Ea_R = m_Ea_R[j];
+            double* k = kf + m_rxn_index[j] * nStates;
+            for (size_t n = 0; n < nStates; n++) {
+                k[n] = A * std::exp(b * logT[n] - Ea_R * recipT[n]);
+            }
+        }
+        return true;
+    }
+
+    //! Helper function for rate types which depend on properties other than
+    //! the temperature. Does nothing; these rates are evaluated for each state.
+    template <typename T=RateType,
+        typename std::enable_if<!std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    bool _getRateConstants(size_t nStates, const double* logT,
+                           const double* recipT, double* kf) {
+        return false;
+    }
+
+    //! Helper function copying parameters of the ArrheniusRate object at position
+    //! *j* of #m_rxn_rates to contiguous parameter arrays.
+    template <typename T=RateType,
+        typename std::enable_if<std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    void _storeParameters(size_t j) {
+        if (j == m_rxn_index.size()) {
+            m_rxn_index.push_back(npos);
+            m_A.push_back(NAN);
+            m_b.push_back(NAN);
+            m_Ea_R.push_back(NAN);
+            m_kbuf.push_back(0.);
+        }
+        const auto& rxn = m_rxn_rates[j];
+        m_rxn_index[j] = rxn.first;
+        m_A[j] = rxn.second.preExponentialFactor();
+        m_b[j] = rxn.second.temperatureExponent();
+        m_Ea_R[j] = rxn.second.activationEnergy_R();
+    }
+
+    //! Helper function for rate types that are not stored in contiguous parameter
+    //! arrays. Does nothing, but exists to allow generic implementations of add()
+    //! and replace().
+    template <typename T=RateType,
+        typename std::enable_if<!std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    void _storeParameters(size_t j) {
+    }
+
     //! Helper function to process updates for rate types that implement the
     //! `updateFromStruct` method.
     template <typename T=RateType,
@@ -150,15 +346,232 @@ protected:
     //! Helper function to update a single rate that has an `updateFromStruct` method`.
     template <typename T=RateType,
         typename std::enable_if<has_update<T>::value, bool>::type = true>
-    void _updateRate(RateType& rate) {
-        rate.updateFromStruct(m_shared);
+    void _updateRate(RateType& rate, const DataType& data) {
+        rate.updateFromStruct(data);
     }
 
     //! Helper function for single rate that does not implement `updateFromStruct`.
     //! Exists to allow generic implementations of `evalSingle` and `ddTSingle`.
     template <typename T=RateType,
         typename std::enable_if<!has_update<T>::value, bool>::type = true>
-    void _updateRate(RateType& rate) {
+    void _updateRate(RateType& rate, const DataType& data) {
+    }
+
+    //! Number of tabulated terms for rate types which implement
+    //! `evalFromTemperatureTerms`
+    template <typename T=RateType,
+        typename std::enable_if<has_terms<T>::value, bool>::type = true>
+    size_t _nTerms(const RateType& rate) const {
+        return rate.nTemperatureTerms();
+    }
+
+    //! Number of tabulated terms for rate types which depend on temperature
+    //! only, where log(k) is tabulated
+    template <typename T=RateType,
+        typename std::enable_if<!has_terms<T>::value, bool>::type = true>
+    size_t _nTerms(const RateType& rate) const {
+        return 1;
+    }
+
+    //! Evaluate tabulated terms for rate types which implement
+    //! `evalFromTemperatureTerms`
+    template <typename T=RateType,
+        typename std::enable_if<has_terms<T>::value, bool>::type = true>
+    bool _getTerms(RateType& rate, const DataType& data, double* terms) {
+        return rate.getTemperatureTerms(data, terms);
+    }
+
+    //! Evaluate log(k) for rate types which depend on temperature only
+    template <typename T=RateType,
+        typename std::enable_if<!has_terms<T>::value, bool>::type = true>
+    bool _getTerms(RateType& rate, const DataType& data, double* terms) {
+        _updateRate(rate, data);
+        double k = rate.evalFromStruct(data);
+        if (k <= 0) {
+            return false;
+        }
+        terms[0] = std::log(k);
+        return true;
+    }
+
+    //! Evaluate a rate from interpolated terms for rate types which implement
+    //! `evalFromTemperatureTerms`
+    template <typename T=RateType,
+        typename std::enable_if<has_terms<T>::value, bool>::type = true>
+    double _evalFromTerms(RateType& rate, const double* terms) {
+        return rate.evalFromTemperatureTerms(m_shared, terms);
+    }
+
+    //! Evaluate a rate from interpolated log(k) for rate types which depend on
+    //! temperature only
+    template <typename T=RateType,
+        typename std::enable_if<!has_terms<T>::value, bool>::type = true>
+    double _evalFromTerms(RateType& rate, const double* terms) {
+        return std::exp(terms[0]);
+    }
+
+    //! Helper function evaluating rate constants by interpolation in the table
+    //! generated by _buildTable().
+    void _getTabulatedRateConstants(double* kf) {
+        if (!m_tab_ok) {
+            _buildTable();
+            // restore rate-specific data for the current state
+            _update();
+        }
+        _interpolateTable(m_shared.temperature, m_tab_work.data());
+        for (size_t j = 0; j < m_tab_index.size(); j++) {
+            auto& rxn = m_rxn_rates[m_tab_index[j]];
+            kf[rxn.first] = _evalFromTerms(rxn.second, &m_tab_work[m_tab_offset[j]]);
+        }
+        for (size_t j : m_tab_direct) {
+            auto& rxn = m_rxn_rates[j];
+            kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+        }
+    }
+
+    //! Interpolate all tabulated terms at temperature *T*, using the cubic
+    //! polynomial through the four nearest grid points.
+    void _interpolateTable(double T, double* terms) const {
+        size_t nTerms = m_tab_offset.back();
+        if (nTerms == 0) {
+            return;
+        }
+        double x = (T - m_tab_Tmin) / m_tab_dT;
+        // index of the first of the four grid points, chosen such that T is in
+        // the central interval except at the ends of the table
+        size_t i = std::min(static_cast<size_t>(std::max(x - 1.0, 0.0)),
+                            m_tab_nPoints - 4);
+        double t = x - i;
+        double w0 = -(t - 1) * (t - 2) * (t - 3) / 6;
+        double w1 = t * (t - 2) * (t - 3) / 2;
+        double w2 = -t * (t - 1) * (t - 3) / 2;
+        double w3 = t * (t - 1) * (t - 2) / 6;
+        // rows of the table are stored consecutively for each grid point
+        const double* y0 = &m_tab_data[i * nTerms];
+        const double* y1 = y0 + nTerms;
+        const double* y2 = y1 + nTerms;
+        const double* y3 = y2 + nTerms;
+        for (size_t n = 0; n < nTerms; n++) {
+            terms[n] = w0 * y0[n] + w1 * y1[n] + w2 * y2[n] + w3 * y3[n];
+        }
+    }
+
+    //! Compute the table of temperature-dependent terms used when tabulation
+    //! is enabled.
+    /*!
+     * The number of grid points is doubled until the tolerance specified in
+     * setTabulation() is met at the midpoints between all grid points. Rates
+     * where the terms cannot be evaluated at all grid points, for example
+     * because the rate constant is not positive, are evaluated directly.
+     */
+    void _buildTable() {
+        size_t nRates = m_rxn_rates.size();
+        const size_t maxPoints = 1 << 17;
+        DataType data;
+
+        // Offsets of the terms for each rate, including those which may turn
+        // out not to be tabulated
+        std::vector<size_t> offsets(nRates + 1, 0);
+        for (size_t j = 0; j < nRates; j++) {
+            offsets[j + 1] = offsets[j] + _nTerms(m_rxn_rates[j].second);
+        }
+        vector_fp terms(offsets.back());
+        std::vector<bool> ok(nRates);
+        auto evalTerms = [&](double T) {
+            // Only the temperature-dependent members are needed
+            data.temperature = T;
+            data.logT = std::log(T);
+            data.recipT = 1. / T;
+            for (size_t j = 0; j < nRates; j++) {
+                ok[j] = _getTerms(m_rxn_rates[j].second, data, &terms[offsets[j]]);
+            }
+        };
+
+        size_t nBins = 3;
+        while (nBins < (m_tab_Tmax - m_tab_Tmin) / 10.0) {
+            nBins *= 2;
+        }
+        while (true) {
+            m_tab_nPoints = nBins + 1;
+            m_tab_dT = (m_tab_Tmax - m_tab_Tmin) / nBins;
+            vector_fp allTerms(m_tab_nPoints * offsets.back());
+            std::vector<bool> allOk(nRates, true);
+            for (size_t i = 0; i < m_tab_nPoints; i++) {
+                evalTerms(m_tab_Tmin + i * m_tab_dT);
+                std::copy(terms.begin(), terms.end(),
+                          allTerms.begin() + i * offsets.back());
+                for (size_t j = 0; j < nRates; j++) {
+                    allOk[j] = allOk[j] && ok[j];
+                }
+            }
+
+            m_tab_index.clear();
+            m_tab_offset.assign(1, 0);
+            m_tab_direct.clear();
+            for (size_t j = 0; j < nRates; j++) {
+                if (allOk[j]) {
+                    m_tab_index.push_back(j);
+                    m_tab_offset.push_back(m_tab_offset.back() + offsets[j + 1]
+                                           - offsets[j]);
+                } else {
+                    m_tab_direct.push_back(j);
+                }
+            }
+            size_t nTerms = m_tab_offset.back();
+            m_tab_data.resize(m_tab_nPoints * nTerms);
+            m_tab_work.resize(nTerms);
+            for (size_t i = 0; i < m_tab_nPoints; i++) {
+                const double* src = &allTerms[i * offsets.back()];
+                double* dest = &m_tab_data[i * nTerms];
+                for (size_t j = 0; j < m_tab_index.size(); j++) {
+                    size_t k = m_tab_index[j];
+                    std::copy(src + offsets[k], src + offsets[k + 1],
+                              dest + m_tab_offset[j]);
+                }
+            }
+
+            // Check the interpolation error between the grid points
+            double maxErr = 0.0;
+            for (size_t i = 0; i < nBins; i++) {
+                double T = m_tab_Tmin + (i + 0.5) * m_tab_dT;
+                evalTerms(T);
+                _interpolateTable(T, m_tab_work.data());
+                for (size_t j = 0; j < m_tab_index.size(); j++) {
+                    size_t k = m_tab_index[j];
+                    for (size_t n = 0; n < offsets[k + 1] - offsets[k]; n++) {
+                        double err = m_tab_work[m_tab_offset[j] + n]
+                                     - terms[offsets[k] + n];
+                        maxErr = std::max(maxErr, std::abs(err));
+                    }
+                }
+            }
+            if (maxErr <= m_tab_rtol) {
+                break;
+            } else if (2 * nBins + 1 > maxPoints) {
+                m_tabulate = false;
+                throw CanteraError("MultiRate::setTabulation", "Unable to meet "
+                    "the tolerance of {} for tabulated rates of type '{}' using "
+                    "{} grid points. The maximum error is {}.",
+                    m_tab_rtol, type(), m_tab_nPoints, maxErr);
+            }
+            nBins *= 2;
+        }
+        m_tab_ok = true;
+    }
+
+    //! Store the unperturbed rate constants used for finite difference
+    //! derivatives in #m_kbase. If tabulation is enabled, the rate constants
+    //! are evaluated directly, since the interpolation error would otherwise
+    //! dominate the finite difference.
+    void _storeBaseRates(const double* kf) {
+        m_kbase.resize(m_rxn_rates.size());
+        for (size_t j = 0; j < m_rxn_rates.size(); j++) {
+            auto& rxn = m_rxn_rates[j];
+            m_kbase[j] = kf[rxn.first];
+            if (m_tabulate && m_kbase[j] != 0.) {
+                m_kbase[j] = rxn.second.evalFromStruct(m_shared);
+            }
+        }
     }
 
     //! Helper function to process temperature derivatives for rate types that
@@ -175,6 +588,7 @@ protected:
     template <typename T=RateType,
         typename std::enable_if<!has_ddT<T>::value, bool>::type = true>
     void _process_ddT(double* rop, const double* kf, double deltaT) {
+        _storeBaseRates(kf);
 
         // perturb conditions
         double dTinv = 1. / (m_shared.temperature * deltaT);
@@ -182,10 +596,11 @@ protected:
         _update();
 
         // apply numerical derivative
-        for (auto& rxn : m_rxn_rates) {
-            if (kf[rxn.first] != 0.) {
+        for (size_t j = 0; j < m_rxn_rates.size(); j++) {
+            auto& rxn = m_rxn_rates[j];
+            if (m_kbase[j] != 0.) {
                 double k1 = rxn.second.evalFromStruct(m_shared);
-                rop[rxn.first] *= dTinv * (k1 / kf[rxn.first] - 1.);
+                rop[rxn.first] *= dTinv * (k1 / m_kbase[j] - 1.);
             } // else not needed: derivative is already zero
         }
 
@@ -199,14 +614,16 @@ protected:
     template <typename T=RateType, typename D=DataType,
         typename std::enable_if<has_ddM<D>::value, bool>::type = true>
     void _process_ddM(double* rop, const double* kf, double deltaM, bool overwrite) {
+        _storeBaseRates(kf);
         double dMinv = 1. / deltaM;
         m_shared.perturbThirdBodies(deltaM);
         _update();
 
-        for (auto& rxn : m_rxn_rates) {
-            if (kf[rxn.first] != 0. && m_shared.conc_3b[rxn.first] > 0.) {
+        for (size_t j = 0; j < m_rxn_rates.size(); j++) {
+            auto& rxn = m_rxn_rates[j];
+            if (m_kbase[j] != 0. && m_shared.conc_3b[rxn.first] > 0.) {
                 double k1 = rxn.second.evalFromStruct(m_shared);
-                rop[rxn.first] *= dMinv * (k1 / kf[rxn.first] - 1.);
+                rop[rxn.first] *= dMinv * (k1 / m_kbase[j] - 1.);
                 rop[rxn.first] /= m_shared.conc_3b[rxn.first];
             } else {
                 rop[rxn.first] = 0.;
@@ -236,14 +653,16 @@ protected:
     template <typename T=RateType, typename D=DataType,
         typename std::enable_if<has_ddP<D>::value, bool>::type = true>
     void _process_ddP(double* rop, const double* kf, double deltaP) {
+        _storeBaseRates(kf);
         double dPinv = 1. / (m_shared.pressure * deltaP);
         m_shared.perturbPressure(deltaP);
         _update();
 
-        for (auto& rxn : m_rxn_rates) {
-            if (kf[rxn.first] != 0.) {
+        for (size_t j = 0; j < m_rxn_rates.size(); j++) {
+            auto& rxn = m_rxn_rates[j];
+            if (m_kbase[j] != 0.) {
                 double k1 = rxn.second.evalFromStruct(m_shared);
-                rop[rxn.first] *= dPinv * (k1 / kf[rxn.first] - 1.);
+                rop[rxn.first] *= dPinv * (k1 / m_kbase[j] - 1.);
             } // else not needed: derivative is already zero
         }
 
@@ -261,10 +680,85 @@ protected:
         }
     }
 
+    //! Helper function to process coverage derivatives for rate types that
+    //! implement the `ddCoverageScaledFromStruct` method.
+    template <typename T=RateType,
+        typename std::enable_if<has_ddCov<T>::value, bool>::type = true>
+    void _process_ddCov(const double* rop, SparseTriplets& jac) {
+        for (const auto& rxn : m_rxn_rates) {
+            if (rop[rxn.first] == 0.) {
+                continue;
+            }
+            m_ddCov.clear();
+            rxn.second.ddCoverageScaledFromStruct(m_shared, m_ddCov);
+            for (const auto& item : m_ddCov) {
+                jac.emplace_back(static_cast<int>(rxn.first),
+                                 static_cast<int>(item.first),
+                                 rop[rxn.first] * item.second);
+            }
+        }
+    }
+
+    //! Helper function for rate types that do not depend on coverages
+    template <typename T=RateType,
+        typename std::enable_if<!has_ddCov<T>::value, bool>::type = true>
+    void _process_ddCov(const double* rop, SparseTriplets& jac) {
+    }
+
     //! Vector of pairs of reaction rates indices and reaction rates
     std::vector<std::pair<size_t, RateType>> m_rxn_rates;
     std::map<size_t, size_t> m_indices; //! Mapping of indices
     DataType m_shared;
+
+    //! @name Contiguous parameter arrays
+    //! Rate parameters stored in structure-of-arrays layout; only used for
+    //! ArrheniusRate. Entries are in the same order as #m_rxn_rates.
+    //! @{
+    std::vector<size_t> m_rxn_index; //!< Reaction indices
+    vector_fp m_A; //!< Pre-exponential factors
+    vector_fp m_b; //!< Temperature exponents
+    vector_fp m_Ea_R; //!< Activation energies (in temperature units)
+    vector_fp m_kbuf; //!< Work array for evaluation of rate constants
+    //! @}
+
+    //! @name Tabulated rate constants
+    //! Data used when tabulation is enabled; see setTabulation().
+    //! @{
+    bool m_tabulate = false; //!< `true` if tabulation is enabled
+    bool m_tab_ok = false; //!< `true` if the table is up to date
+    double m_tab_Tmin = NAN; //!< Lower limit of tabulated temperature range [K]
+    double m_tab_Tmax = NAN; //!< Upper limit of tabulated temperature range [K]
+    double m_tab_rtol = NAN; //!< Tolerance for tabulated terms
+    double m_tab_dT = NAN; //!< Spacing of the temperature grid [K]
+    size_t m_tab_nPoints = 0; //!< Number of grid points
+    //! Positions in #m_rxn_rates of tabulated rates
+    std::vector<size_t> m_tab_index;
+    //! Offset of the first term of each tabulated rate within a row of the
+    //! table. The last element is the total number of terms in a row.
+    std::vector<size_t> m_tab_offset{0};
+    //! Positions in #m_rxn_rates of rates which are evaluated directly
+    std::vector<size_t> m_tab_direct;
+    //! Table of temperature-dependent terms. The terms for all tabulated rates
+    //! at grid point `i` are stored consecutively, starting at index
+    //! `i * m_tab_offset.back()`.
+    vector_fp m_tab_data;
+    vector_fp m_tab_work; //!< Work array for interpolated terms
+    //! @}
+
+    //! @name Active reactions
+    //! Data used when evaluation is restricted to a subset of reactions; see
+    //! setActiveReactions().
+    //! @{
+    bool m_masked = false; //!< `true` if some reactions are inactive
+    std::vector<size_t> m_active; //!< Positions in #m_rxn_rates of active rates
+    std::vector<size_t> m_inactive; //!< Positions in #m_rxn_rates of inactive rates
+    //! @}
+
+    //! Unperturbed rate constants used for numerical derivatives
+    vector_fp m_kbase;
+
+    //! Work array holding coverage derivatives of a single reaction rate
+    std::vector<std::pair<size_t, double>> m_ddCov;
 };
 
 }
@@ -9,6 +9,7 @@
 #define CT_MULTIRATEBASE_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -31,6 +32,13 @@ public:
     //! Identifier of reaction rate type
     virtual std::string type() = 0;
 
+    //! Create a copy of the evaluator, including copies of the rate objects,
+    //! tabulated data and the set of active reactions. Data depending on the
+    //! state of the phase are invalidated.
+    //! @warning  This method is an experimental part of the %Cantera API and
+    //!     may be changed or removed without notice.
+    virtual unique_ptr<MultiRateBase> clone() const = 0;
+
     //! Add reaction rate object to the evaluator
     //! @param rxn_index  index of reaction
     //! @param rate  reaction rate object
@@ -51,6 +59,29 @@ public:
     //! @param kf  array of rate constants
     virtual void getRateConstants(double* kf) = 0;
 
+    //! Evaluate all rate constants handled by the evaluator for a block of
+    //! temperatures, if the rate type depends on temperature only.
+    /*!
+     * Rate constants are evaluated directly from the rate expressions, even if
+     * tabulation is enabled. Rate constants of inactive reactions are set to
+     * zero.
+     *
+     * @param nStates  number of temperatures
+     * @param logT  natural logarithms of the temperatures. Length: nStates
+     * @param recipT  inverse temperatures [1/K]. Length: nStates
+     * @param[out] kf  rate constants, where the value for reaction `i` at
+     *     temperature `n` is stored at `kf[i * nStates + n]`
+     * @returns  `true` if the rate constants were evaluated. `false` if the
+     *     rate type depends on other properties of the state, in which case
+     *     `kf` is not modified and rate constants need to be evaluated for
+     *     each state using update() and getRateConstants().
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual bool getRateConstants(size_t nStates, const double* logT,
+                                  const double* recipT, double* kf) = 0;
+
     //! Evaluate all rate constant temperature derivatives handled by the evaluator;
     //! which are multiplied with the array of rate-of-progress variables.
     //! Depending on the implementation of a rate object, either an exact derivative or
@@ -85,6 +116,15 @@ public:
                                           double deltaM,
                                           bool overwrite=true) = 0;
 
+    //! Evaluate all rate constant coverage derivatives handled by the evaluator;
+    //! which are multiplied with the array of rate-of-progress variables.
+    //! Only rate types depending on surface coverages contribute entries.
+    //! @param rop  array of rop
+    //! @param[in,out] jac  triplets (reaction index, index of the species within
+    //!     the surface phase, d(rop)/d(coverage)), to which entries are appended
+    virtual void processRateConstants_ddCov(const double* rop,
+                                            SparseTriplets& jac) = 0;
+
     //! Update common reaction rate data based on temperature.
     //! Only used in conjunction with evalSingle and ReactionRate::eval
     //! @param T  temperature [K]
@@ -111,6 +151,52 @@ public:
     //! @returns  flag indicating whether reaction rates need to be re-evaluated
     virtual bool update(const ThermoPhase& phase, const Kinetics& kin) = 0;
 
+    //! Evaluate rate constants by interpolation in a table of log(k) instead of
+    //! evaluating the rate expressions directly.
+    /*!
+     * For rate types which depend on temperature only, log(k) is tabulated. For
+     * falloff rates, the logarithms of the low- and high-pressure limits and
+     * the temperature-dependent parts of the falloff function are tabulated,
+     * and the dependence on the third-body concentration is evaluated directly.
+     *
+     * The table is computed on a uniform temperature grid which is refined until
+     * the error of the interpolated terms at the midpoints between grid points
+     * is less than `rtol`, which approximately corresponds to the relative
+     * error of the rate constants. Values are interpolated using cubic
+     * polynomials, and the terms for all reactions at each grid point are
+     * stored consecutively. Rate constants at temperatures outside the tabulated
+     * range are evaluated directly.
+     *
+     * @param Tmin  lower limit of the tabulated temperature range [K]
+     * @param Tmax  upper limit of the tabulated temperature range [K]
+     * @param rtol  tolerance for the interpolated terms
+     * @returns  `true` if tabulation is supported by this rate type
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual bool setTabulation(double Tmin, double Tmax, double rtol) = 0;
+
+    //! Evaluate rate constants directly from the rate expressions. Undoes the
+    //! effect of setTabulation().
+    virtual void clearTabulation() = 0;
+
+    //! Restrict the evaluation of rate constants to a subset of reactions.
+    /*!
+     * Rate constants of inactive reactions are set to zero by
+     * getRateConstants(), and only the rate constants of active reactions are
+     * evaluated. While a subset is set, rate constants are evaluated directly
+     * from the rate expressions, even if tabulation is enabled.
+     *
+     * @param active  flags indicating whether each reaction of the Kinetics
+     *     object is active, indexed by the global reaction index. If empty, all
+     *     reactions are active.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual void setActiveReactions(const std::vector<bool>& active) = 0;
+
     //! Get the rate for a single reaction. Used to implement ReactionRate::eval,
     //! which allows for the evaluation of a reaction rate expression outside of
     //! Kinetics reaction rate evaluators. Mainly used for testing purposes.
@@ -146,6 +146,14 @@ public:
         R[m_rxn] *= S[m_ic0];
     }
 
+    void multiply(const double* S, double* R, size_t nStates) const {
+        const double* S0 = S + m_ic0 * nStates;
+        double* Rn = R + m_rxn * nStates;
+        for (size_t n = 0; n < nStates; n++) {
+            Rn[n] *= S0[n];
+        }
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0];
     }
@@ -208,6 +216,15 @@ public:
         }
     }
 
+    void multiply(const double* S, double* R, size_t nStates) const {
+        const double* S0 = S + m_ic0 * nStates;
+        const double* S1 = S + m_ic1 * nStates;
+        double* Rn = R + m_rxn * nStates;
+        for (size_t n = 0; n < nStates; n++) {
+            Rn[n] = (S0[n] < 0 && S1[n] < 0) ? 0.0 : Rn[n] * S0[n] * S1[n];
+        }
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1];
     }
@@ -279,6 +296,18 @@ public:
         }
     }
 
+    void multiply(const double* S, double* R, size_t nStates) const {
+        const double* S0 = S + m_ic0 * nStates;
+        const double* S1 = S + m_ic1 * nStates;
+        const double* S2 = S + m_ic2 * nStates;
+        double* Rn = R + m_rxn * nStates;
+        for (size_t n = 0; n < nStates; n++) {
+            bool zero = (S0[n] < 0 && (S1[n] < 0 || S2[n] < 0)) ||
+                        (S1[n] < 0 && S2[n] < 0);
+            Rn[n] = zero ? 0.0 : Rn[n] * S0[n] * S1[n] * S2[n];
+        }
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1] + S[m_ic2];
     }
@@ -364,6 +393,19 @@ public:
         }
     }
 
+    void multiply(const double* input, double* output, size_t nStates) const {
+        double* out = output + m_rxn * nStates;
+        for (size_t i = 0; i < m_n; i++) {
+            double order = m_order[i];
+            if (order != 0.0) {
+                const double* c = input + m_ic[i] * nStates;
+                for (size_t n = 0; n < nStates; n++) {
+                    out[n] = (c[n] > 0.0) ? out[n] * std::pow(c[n], order) : 0.0;
+                }
+            }
+        }
+    }
+
     void incrementSpecies(const doublereal* input,
                           doublereal* output) const {
         doublereal x = input[m_rxn];
@@ -490,6 +532,15 @@ inline static void _multiply(InputIter begin, InputIter end,
     }
 }
 
+template<class InputIter, class Vec1, class Vec2>
+inline static void _multiply(InputIter begin, InputIter end,
+                             const Vec1& input, Vec2& output, size_t nStates)
+{
+    for (; begin != end; ++begin) {
+        begin->multiply(input, output, nStates);
+    }
+}
+
 template<class InputIter, class Vec1, class Vec2>
 inline static void _incrementSpecies(InputIter begin,
                                      InputIter end, const Vec1& input, Vec2& output)
@@ -729,6 +780,16 @@ public:
         _multiply(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
+    //! Multiply rates of progress for a block of states by the concentration
+    //! products. The value for species or reaction `i` in state `n` is stored
+    //! at index `i * nStates + n` of `input` and `output`, respectively.
+    void multiply(const double* input, double* output, size_t nStates) const {
+        _multiply(m_c1_list.begin(), m_c1_list.end(), input, output, nStates);
+        _multiply(m_c2_list.begin(), m_c2_list.end(), input, output, nStates);
+        _multiply(m_c3_list.begin(), m_c3_list.end(), input, output, nStates);
+        _multiply(m_cn_list.begin(), m_cn_list.end(), input, output, nStates);
+    }
+
     void incrementSpecies(const doublereal* input, doublereal* output) const {
         _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
@@ -89,6 +89,18 @@ public:
         }
     }
 
+    //! Multiply output with effective third-body concentration for a block of
+    //! states. The values for reaction `i` in state `n` are stored at index
+    //! `i * nStates + n` of `output` and `concm`.
+    void multiply(double* output, const double* concm, size_t nStates) const {
+        for (size_t i = 0; i < m_mass_action_index.size(); i++) {
+            size_t ix = m_reaction_index[m_mass_action_index[i]] * nStates;
+            for (size_t n = 0; n < nStates; n++) {
+                output[ix + n] *= concm[ix + n];
+            }
+        }
+    }
+
     //! Calculate derivatives with respect to species concentrations.
     /*!
      *  @param product   Product of law of mass action and rate terms.
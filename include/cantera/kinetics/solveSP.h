@@ -292,7 +292,8 @@ private:
      *  @param resid   output Vector of residuals, length = m_neq
      *  @param CSolnSP  Vector of species concentrations, unknowns in the
      *                  problem, length = m_neq. These are tweaked in order
-     *                  to derive the columns of the Jacobian.
+     *                  to derive the columns of the Jacobian if finite
+     *                  differences are used.
      *  @param CSolnSPOld Old Vector of species concentrations, unknowns in the
      *                  problem, length = m_neq
      *  @param do_time Calculate a time dependent residual
@@ -503,6 +504,12 @@ private:
     //! Newton's method.
     DenseMatrix m_Jac;
 
+    //! If true, the Jacobian columns of surface species are evaluated from
+    //! analytical derivatives of the net production rates. Otherwise, finite
+    //! differences are used, which is the case for bulk deposition problems and
+    //! non-ideal phases.
+    bool m_analyticJac;
+
 public:
     int m_ioflag;
 };
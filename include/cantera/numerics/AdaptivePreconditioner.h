@@ -31,7 +31,6 @@ public:
     void initialize(size_t networkSize) override;
 
     void reset() override {
-        m_precon_matrix.setZero();
         m_jac_trips.clear();
     };
 
@@ -48,6 +47,13 @@ public:
     //! Prune preconditioner elements
     void prunePreconditioner();
 
+    //! Number of times the sparsity pattern of the Jacobian was analyzed.
+    //! As long as the pattern of elements set by setValue() does not change,
+    //! values are updated in place and the pattern is not analyzed again.
+    size_t nPatternUpdates() const {
+        return m_pattern_updates;
+    }
+
     //! Function used to return semi-analytical jacobian matrix
     Eigen::SparseMatrix<double> jacobian() {
         Eigen::SparseMatrix<double> jacobian_mat(m_dim, m_dim);
@@ -98,6 +104,21 @@ public:
     void printJacobian();
 
 protected:
+    //! Update the compressed Jacobian #m_jac from #m_jac_trips
+    /*!
+     * If the row and column indices of #m_jac_trips are unchanged from the previous
+     * call, values are scattered into the existing compressed storage in O(nnz).
+     * Otherwise, the sparsity pattern and the index maps used for in-place updates
+     * are rebuilt.
+     *
+     * @returns  `true` if the sparsity pattern was rebuilt
+     */
+    bool updateJacobian();
+
+    //! Rebuild the sparsity patterns of the Jacobian and preconditioner matrices
+    //! together with the index maps used for in-place updates.
+    void updatePattern();
+
     //! ilut fill factor
     double m_fill_factor = 0;
 
@@ -107,8 +128,28 @@ protected:
     //! Vector of triples representing the jacobian used in preconditioning
     std::vector<Eigen::Triplet<double>> m_jac_trips;
 
-    //! Storage of appropriately sized identity matrix for making the preconditioner
-    Eigen::SparseMatrix<double> m_identity;
+    //! Jacobian in compressed storage; the sparsity pattern is retained between
+    //! updates
+    Eigen::SparseMatrix<double> m_jac;
+
+    //! Row and column indices of #m_jac_trips used to build the current pattern
+    std::vector<std::pair<int, int>> m_pattern;
+
+    //! Position of each element of #m_jac_trips in the value array of #m_jac
+    std::vector<int> m_jac_index;
+
+    //! Position of each element of #m_jac in the value array of #m_precon_matrix
+    std::vector<int> m_precon_index;
+
+    //! Positions of diagonal elements in the value array of #m_precon_matrix
+    std::vector<int> m_diag_index;
+
+    //! Flag indicating that the pattern of #m_precon_matrix needs to be analyzed by
+    //! the ILUT solver
+    bool m_analyze = true;
+
+    //! Number of times the sparsity pattern was rebuilt
+    size_t m_pattern_updates = 0;
 
     //! Container that is the sparse preconditioner
     Eigen::SparseMatrix<double> m_precon_matrix;
@@ -73,6 +73,17 @@ public:
     virtual double sensitivity(size_t k, size_t p);
     virtual void setProblemType(int probtype);
 
+    //! Enable checkpointing of the forward solution using the adjoint module
+    //! of CVODES. Forward integration then uses CVodeF instead of CVode.
+    virtual void initializeAdjoint(int nsteps);
+
+    //! Integrate the adjoint system backward in time using CVodeB. The adjoint
+    //! system uses the same method and maximum number of steps as the forward
+    //! problem, and a dense linear solver with the Jacobian provided by
+    //! FuncEval::evalAdjointJacobian(). The adjoint variables and the
+    //! quadratures are integrated using the sensitivity tolerances.
+    virtual void solveAdjoint(double tB0, double tB1, double* yB, double* qB);
+
     //! Returns a string listing the weighted error estimates associated
     //! with each solution component.
     //! This information can be used to identify which variables are
@@ -117,6 +128,10 @@ private:
     //! Indicates whether the sensitivities stored in m_yS have been updated
     //! for at the current integrator time.
     bool m_sens_ok;
+
+    //! Number of steps between checkpoints of the forward solution for the
+    //! adjoint problem. Zero if checkpointing is not enabled.
+    int m_adjointSteps;
 };
 
 } // namespace
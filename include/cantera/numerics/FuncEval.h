@@ -12,6 +12,8 @@
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/global.h"
 
+#include <functional>
+
 namespace Cantera
 {
 
@@ -97,6 +99,68 @@ public:
      */
     int preconditioner_solve_nothrow(double* rhs, double* output);
 
+    /**
+     * Evaluate the right-hand side of the adjoint system, which is integrated
+     * backward in time for adjoint sensitivity analysis.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] yB adjoint solution vector, length neq()
+     * @param[out] yBdot rate of change of the adjoint solution vector, length
+     *     neq()
+     * @warning This function is an experimental part of the %Cantera API and may be
+     * changed or removed without notice.
+     */
+    virtual void evalAdjoint(double t, double* y, double* yB, double* yBdot) {
+        throw NotImplementedError("FuncEval::evalAdjoint");
+    }
+
+    /**
+     * Evaluate the Jacobian of the right-hand side of the adjoint system with
+     * respect to the adjoint solution vector.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[out] jac Jacobian matrix, stored in column-major order, size
+     *     neq() by neq()
+     * @warning This function is an experimental part of the %Cantera API and may be
+     * changed or removed without notice.
+     */
+    virtual void evalAdjointJacobian(double t, double* y, double* jac) {
+        throw NotImplementedError("FuncEval::evalAdjointJacobian");
+    }
+
+    /**
+     * Evaluate the integrands of the quadratures of the adjoint system, which
+     * yield the gradient of the output with respect to the problem parameters.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] yB adjoint solution vector, length neq()
+     * @param[out] qBdot integrands, length nAdjointQuadratures()
+     * @warning This function is an experimental part of the %Cantera API and may be
+     * changed or removed without notice.
+     */
+    virtual void evalAdjointQuadrature(double t, double* y, double* yB,
+                                       double* qBdot) {
+        throw NotImplementedError("FuncEval::evalAdjointQuadrature");
+    }
+
+    //! Number of quadratures of the adjoint system
+    virtual size_t nAdjointQuadratures() {
+        return 0;
+    }
+
+    //! Evaluate the right-hand side of the adjoint system using a return code
+    //! to indicate status. See eval_nothrow().
+    int evalAdjoint_nothrow(double t, double* y, double* yB, double* yBdot);
+
+    //! Evaluate the Jacobian of the adjoint system using a return code to
+    //! indicate status. See eval_nothrow().
+    int evalAdjointJacobian_nothrow(double t, double* y, double* jac);
+
+    //! Evaluate the quadrature integrands of the adjoint system using a return
+    //! code to indicate status. See eval_nothrow().
+    int evalAdjointQuadrature_nothrow(double t, double* y, double* yB,
+                                      double* qBdot);
+
     //! Fill in the vector *y* with the current state of the system
     virtual void getState(double* y) {
         throw NotImplementedError("FuncEval::getState");
@@ -137,6 +201,10 @@ public:
     vector_fp m_paramScales;
 
 protected:
+    //! Call `func`, storing or printing any exception thrown by it and
+    //! returning a CVODES-style status code. See eval_nothrow().
+    int callNothrow(const std::string& method, const std::function<void()>& func);
+
     // If true, errors are accumulated in m_errors. Otherwise, they are printed
     bool m_suppress_errors;
 
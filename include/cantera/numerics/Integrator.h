@@ -281,6 +281,39 @@ public:
         return 0.0;
     }
 
+    //! Enable checkpointing of the forward solution for a subsequent call to
+    //! solveAdjoint(). Must be called after initialize() or reinitialize()
+    //! and before integrating forward.
+    /*!
+     * @param nsteps  Number of integrator steps between checkpoints
+     * @warning This function is an experimental part of the %Cantera API and
+     *     may be changed or removed without notice.
+     */
+    virtual void initializeAdjoint(int nsteps) {
+        throw NotImplementedError("Integrator::initializeAdjoint");
+    }
+
+    //! Integrate the adjoint system of the checkpointed forward solution
+    //! backward in time. The right-hand side and the quadratures of the
+    //! adjoint system are evaluated by FuncEval::evalAdjoint() and
+    //! FuncEval::evalAdjointQuadrature(). The checkpoints are discarded
+    //! afterwards, and the integrator must be reinitialized before it is used
+    //! for further forward integration.
+    /*!
+     * @param tB0  Time at which the backward integration starts, which may
+     *     not be later than the time reached by the forward integration
+     * @param tB1  Time at which the backward integration ends
+     * @param[in,out] yB  Adjoint solution vector at `tB0` on input and at
+     *     `tB1` on output, length nEquations()
+     * @param[out] qB  Values of the quadratures at `tB1`, length
+     *     FuncEval::nAdjointQuadratures()
+     * @warning This function is an experimental part of the %Cantera API and
+     *     may be changed or removed without notice.
+     */
+    virtual void solveAdjoint(double tB0, double tB1, double* yB, double* qB) {
+        throw NotImplementedError("Integrator::solveAdjoint");
+    }
+
     //! Get solver stats from integrator
     virtual AnyMap solverStats() const {
         AnyMap stats;
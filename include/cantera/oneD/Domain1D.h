@@ -309,6 +309,18 @@ public:
 
     virtual void setJac(MultiJac* jac) {}
 
+    //! Add contributions to the Jacobian which are evaluated analytically.
+    /*!
+     *  Called by MultiJac::eval after the finite difference approximation of
+     *  the Jacobian has been formed. Derived classes which hold some terms of
+     *  the residual fixed during the finite difference perturbations must add
+     *  the corresponding derivatives here.
+     *
+     *  @param[in] xg  Global solution vector at which the Jacobian is evaluated
+     *  @param jac  Jacobian matrix to be updated
+     */
+    virtual void evalJacobian(double* xg, MultiJac& jac) {}
+
     //! Save the state of this domain as an AnyMap
     /*!
      * @param soln local solution vector for this domain
@@ -474,6 +486,16 @@ public:
         m_force_full_update = update;
     }
 
+    /**
+     * Set to `true` while the residual is evaluated at all grid points as part
+     * of a finite difference Jacobian evaluation, where several grid points
+     * are perturbed at once (see MultiJac::eval). Properties which are not
+     * updated during Jacobian evaluations should be held fixed in this case.
+     */
+    void setColoredJacobian(bool colored) {
+        m_colored_jac = colored;
+    }
+
 protected:
     doublereal m_rdt;
     size_t m_nv;
@@ -505,6 +527,7 @@ protected:
     std::vector<std::string> m_name;
     int m_bw;
     bool m_force_full_update;
+    bool m_colored_jac;
 
     //! Composite thermo/kinetics/transport handler
     std::shared_ptr<Solution> m_solution;
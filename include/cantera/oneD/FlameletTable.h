@@ -0,0 +1,256 @@
+//! @file FlameletTable.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_FLAMELETTABLE_H
+#define CT_FLAMELETTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+class AnyMap;
+
+//! Generator for tables of counterflow diffusion flamelets.
+/*!
+ *  This class computes libraries of steady counterflow diffusion flames, as
+ *  used by flamelet/progress variable (FPV) models of turbulent combustion.
+ *  Each branch of the table corresponds to one pressure. A branch starts from
+ *  a flamelet computed with the mass fluxes set using setMassFluxes(), and is
+ *  continued by increasing both mass fluxes by a common strain factor
+ *  \f$ s \f$. The continuation uses Sim1D::arcLengthStep() with the parameter
+ *  \f$ \ln s \f$, which passes the extinction point and continues along the
+ *  unstable middle branch of the S-shaped curve until the maximum temperature
+ *  is within a given margin of the inlet temperatures, or until the ignition
+ *  point at the end of the middle branch is reached.
+ *
+ *  Branches are independent and are distributed dynamically over a set of
+ *  worker threads. Each worker owns a Solution object created using
+ *  Solution::clone(), and creates its own domains and Sim1D object for each
+ *  branch.
+ *
+ *  Each flamelet is interpolated onto a common mixture fraction grid, using the
+ *  Bilger mixture fraction, and is characterized by the progress variable
+ *  \f$ \Lambda \f$, defined as the value of the progress variable \f$ C =
+ *  \sum_k Y_k \f$ at the stoichiometric mixture fraction. Along a branch,
+ *  \f$ \Lambda \f$ decreases from the burning to the extinguished state.
+ *  Flamelets which do not continue this trend are discarded, and the remaining
+ *  flamelets are stored in reverse order, such that the table can be indexed by
+ *  a strictly increasing progress variable.
+ *
+ *  @warning  This class is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ *
+ * @ingroup onedim
+ */
+class FlameletTable
+{
+public:
+    //! Create a flamelet table generator
+    /*!
+     *  @param sol  Solution object defining the mechanism and the transport
+     *      model. The phase must be an ideal gas.
+     *  @param nThreads  Number of worker threads. If zero, the number of
+     *      concurrent threads supported by the hardware is used.
+     */
+    FlameletTable(shared_ptr<Solution> sol, size_t nThreads=0);
+    ~FlameletTable();
+    FlameletTable(const FlameletTable&) = delete;
+    FlameletTable& operator=(const FlameletTable&) = delete;
+
+    //! Number of worker threads
+    size_t nThreads() const {
+        return m_workers.size();
+    }
+
+    //! Set the mole fractions and temperature [K] of the fuel stream
+    void setFuel(const std::string& X, double T);
+
+    //! Set the mole fractions and temperature [K] of the oxidizer stream
+    void setOxidizer(const std::string& X, double T);
+
+    //! Set the mass fluxes [kg/m^2/s] of the fuel and oxidizer streams for the
+    //! first flamelet of each branch. The defaults are 0.2 and 0.6.
+    void setMassFluxes(double mdotFuel, double mdotOx);
+
+    //! Set the distance [m] between the fuel and oxidizer inlets. The default
+    //! is 0.02 m.
+    void setWidth(double width);
+
+    //! Set the pressures [Pa] of the branches of the table
+    void setPressures(const vector_fp& P);
+
+    //! Set the species defining the progress variable. The default is all
+    //! species out of CO2, CO, H2O and H2 which are present in the mechanism.
+    void setProgressVariable(const std::vector<std::string>& species);
+
+    //! Set the mixture fraction grid of the table. The values must be
+    //! increasing. The default is 101 uniformly spaced points between 0 and 1.
+    void setMixtureFractionGrid(const vector_fp& Z);
+
+    //! Set the initial, minimum and maximum arc length of the continuation
+    //! steps. The arc length is measured in the plane of \f$ \ln s \f$ and
+    //! the maximum temperature scaled by the temperature scale (see
+    //! Sim1D::arcLengthStep()). The defaults are 0.1, 0.001 and 0.5.
+    void setArcLength(double ds, double dsMin, double dsMax);
+
+    //! Set the temperature scale [K] used to measure arc lengths. The default
+    //! is 100 K.
+    void setTemperatureScale(double Tscale);
+
+    //! Set the margin [K] between the maximum flame temperature and the
+    //! highest inlet temperature at which the continuation of a branch is
+    //! stopped. The default is 100 K.
+    void setExtinctionMargin(double deltaT);
+
+    //! Set the maximum number of flamelets computed for each branch. The
+    //! default is 200.
+    void setMaxFlamelets(size_t nmax);
+
+    //! Set the grid refinement criteria for the flow domain (see
+    //! Sim1D::setRefineCriteria()). The defaults are 3.0, 0.1, 0.2 and 0.05.
+    void setRefineCriteria(double ratio, double slope, double curve,
+                           double prune);
+
+    //! Set the maximum number of grid points of the flow domain. The default
+    //! is 1000.
+    void setMaxGridPoints(size_t npoints);
+
+    //! Compute all branches of the table
+    /*!
+     *  @param loglevel  If greater than zero, a summary of each branch is
+     *      written. Larger values also enable the output of the solver, which
+     *      is only useful with a single worker thread.
+     */
+    void build(int loglevel=0);
+
+    //! Number of branches
+    size_t nBranches() const {
+        return m_branches.size();
+    }
+
+    //! Number of points of the mixture fraction grid
+    size_t nMixtureFractions() const {
+        return m_Z.size();
+    }
+
+    //! Mixture fraction grid of the table
+    const vector_fp& mixtureFractionGrid() const {
+        return m_Z;
+    }
+
+    //! Stoichiometric mixture fraction
+    double stoichMixtureFraction() const {
+        return m_Zst;
+    }
+
+    //! Number of flamelets of branch `b`
+    size_t nFlamelets(size_t b) const;
+
+    //! Pressure [Pa] of branch `b`
+    double pressure(size_t b) const {
+        return branch(b).P;
+    }
+
+    //! Progress variable \f$ \Lambda \f$ of each flamelet of branch `b`,
+    //! which is strictly increasing
+    const vector_fp& progress(size_t b) const {
+        return branch(b).Lambda;
+    }
+
+    //! Strain factor \f$ s \f$ of each flamelet of branch `b`
+    const vector_fp& strainFactors(size_t b) const {
+        return branch(b).strain;
+    }
+
+    //! Maximum temperature [K] of each flamelet of branch `b`
+    const vector_fp& maxTemperatures(size_t b) const {
+        return branch(b).Tmax;
+    }
+
+    //! Temperatures [K] of branch `b`. The entry for flamelet `i` and
+    //! mixture fraction `m` is at index `i * nMixtureFractions() + m`.
+    const vector_fp& temperatures(size_t b) const {
+        return branch(b).T;
+    }
+
+    //! Mass fractions of branch `b`. The mass fraction of species `k` for
+    //! flamelet `i` and mixture fraction `m` is at index
+    //! `(i * nMixtureFractions() + m) * nSpecies + k`.
+    const vector_fp& massFractions(size_t b) const {
+        return branch(b).Y;
+    }
+
+    //! Net production rates [kg/m^3/s] of the progress variable of branch `b`,
+    //! stored like temperatures()
+    const vector_fp& progressSources(size_t b) const {
+        return branch(b).omegaC;
+    }
+
+    //! Return the table as an AnyMap. Arrays with data for all flamelets of a
+    //! branch are flattened in the same order as the accessor methods.
+    AnyMap table() const;
+
+    //! Write the table to a file. Files with the extension `.yaml` or `.yml`
+    //! are written in YAML format; other files use the binary format of
+    //! AnyMap::toBinaryString().
+    void save(const std::string& fname) const;
+
+protected:
+    //! Data of one branch of the table
+    struct Branch {
+        double P; //!< Pressure [Pa]
+        vector_fp Lambda; //!< Progress variable of each flamelet
+        vector_fp strain; //!< Strain factor of each flamelet
+        vector_fp Tmax; //!< Maximum temperature of each flamelet
+        vector_fp T; //!< Temperatures
+        vector_fp Y; //!< Mass fractions
+        vector_fp omegaC; //!< Production rates of the progress variable
+    };
+
+    //! Objects used by a single worker thread
+    struct Worker {
+        shared_ptr<Solution> sol;
+    };
+
+    //! Get branch `b`, checking the index
+    const Branch& branch(size_t b) const;
+
+    //! Compute branch `b` using worker `w`
+    void run(Worker& w, Branch& b, int loglevel);
+
+    size_t m_nsp; //!< Number of species
+    std::vector<Worker> m_workers;
+
+    std::string m_fuelX; //!< Fuel composition
+    std::string m_oxX; //!< Oxidizer composition
+    double m_Tfuel; //!< Fuel temperature [K]
+    double m_Tox; //!< Oxidizer temperature [K]
+    double m_mdotFuel; //!< Initial fuel mass flux [kg/m^2/s]
+    double m_mdotOx; //!< Initial oxidizer mass flux [kg/m^2/s]
+    double m_width; //!< Distance between the inlets [m]
+    vector_fp m_pressures; //!< Pressures of the branches [Pa]
+    std::vector<size_t> m_progressSpecies; //!< Species in the progress variable
+    vector_fp m_Z; //!< Mixture fraction grid
+    double m_Zst; //!< Stoichiometric mixture fraction
+
+    double m_ds; //!< Initial arc length
+    double m_dsMin; //!< Minimum arc length
+    double m_dsMax; //!< Maximum arc length
+    double m_Tscale; //!< Temperature scale for arc lengths [K]
+    double m_deltaT; //!< Extinction margin [K]
+    size_t m_maxFlamelets; //!< Maximum number of flamelets per branch
+
+    //! Grid refinement criteria
+    double m_ratio, m_slope, m_curve, m_prune;
+    size_t m_maxPoints; //!< Maximum number of grid points
+
+    std::vector<Branch> m_branches;
+};
+
+}
+
+#endif
@@ -7,6 +7,7 @@
 #define CT_MULTIJAC_H
 
 #include "cantera/numerics/BandMatrix.h"
+#include "cantera/numerics/eigen_sparse.h"
 #include "OneDim.h"
 
 namespace Cantera
@@ -17,12 +18,24 @@ namespace Cantera
  * residual function supplied by an instance of class OneDim. The residual
  * function may consist of several linked 1D domains, with different variables
  * in each domain.
+ *
+ * By default, the Jacobian is stored as a banded matrix and factored using a
+ * banded LU decomposition. Alternatively, it can be stored as a sparse matrix
+ * containing only the nonzero elements, which is factored using a sparse LU
+ * decomposition. The sparsity pattern is determined by the first Jacobian
+ * evaluation, and is only extended (and analyzed again) if later evaluations
+ * produce nonzero elements outside of it. A new MultiJac object is created
+ * whenever the grid changes.
  * @ingroup onedim
  */
 class MultiJac : public BandMatrix
 {
 public:
-    MultiJac(OneDim& r);
+    //! Constructor
+    //! @param r  residual evaluator
+    //! @param sparse  if `true`, use a sparse matrix and a sparse LU
+    //!     decomposition instead of a banded matrix
+    MultiJac(OneDim& r, bool sparse=false);
 
     /**
      * Evaluate the Jacobian at x0. The unperturbed residual function is resid0,
@@ -65,7 +78,57 @@ public:
 
     void incrementDiagonal(int j, doublereal d);
 
+    //! Return `true` if the Jacobian is stored as a sparse matrix
+    bool sparse() const {
+        return m_sparse;
+    }
+
+    //! Return a changeable reference to element (i,j). For a sparse Jacobian,
+    //! elements which are not part of the current sparsity pattern are added
+    //! to it.
+    double& value(size_t i, size_t j);
+
+    //! Return the value of element (i,j)
+    double value(size_t i, size_t j) const;
+
+    virtual double& operator()(size_t i, size_t j) {
+        return value(i, j);
+    }
+
+    virtual double operator()(size_t i, size_t j) const {
+        return value(i, j);
+    }
+
+    virtual void zero();
+    virtual int factor();
+    using BandMatrix::solve;
+    virtual int solve(double* b, size_t nrhs=1, size_t ldb=0);
+
+    //! Return the sparse Jacobian matrix. Only valid if sparse() is `true`.
+    const Eigen::SparseMatrix<double>& sparseMatrix() const {
+        return m_mat;
+    }
+
+    //! Number of times the sparsity pattern has been analyzed for the sparse
+    //! LU decomposition
+    int nPatternUpdates() const {
+        return m_npatterns;
+    }
+
 protected:
+    //! Store the elements of column `ipt` of a sparse Jacobian, corresponding
+    //! to a component at grid point `j`, from the perturbed residual #m_r1.
+    //! Elements outside of the sparsity pattern are added to #m_trips.
+    void setSparseColumn(size_t j, size_t ipt, const double* resid0, double rdx);
+
+    //! Return a pointer to element (i,j) of #m_mat, or `nullptr` if it is not
+    //! part of the sparsity pattern
+    double* sparseElement(size_t i, size_t j);
+
+    //! Add the elements in #m_trips and #m_pending and the diagonal elements to
+    //! the sparsity pattern of #m_mat
+    void updatePattern();
+
     //! Residual evaluator for this Jacobian
     /*!
      * This is a pointer to the residual evaluator. This object isn't owned by
@@ -74,6 +137,10 @@ protected:
     OneDim* m_resid;
 
     vector_fp m_r1;
+
+    //! Unperturbed values of the solution components perturbed at each grid
+    //! point during the current residual evaluation
+    vector_fp m_xsave;
     doublereal m_rtol, m_atol;
     doublereal m_elapsed;
     vector_fp m_ssdiag;
@@ -82,6 +149,31 @@ protected:
     int m_age;
     size_t m_size;
     size_t m_points;
+
+    //! If `true`, the Jacobian is stored in #m_mat instead of the banded storage
+    bool m_sparse;
+
+    //! Sparse Jacobian matrix
+    Eigen::SparseMatrix<double> m_mat;
+
+    //! Nonzero elements computed by finite differences which are not part of
+    //! the sparsity pattern of #m_mat
+    SparseTriplets m_trips;
+
+    //! Elements set using value() which are not part of the sparsity pattern
+    //! of #m_mat
+    std::map<std::pair<size_t, size_t>, double> m_pending;
+
+    //! Sparse LU decomposition of #m_mat
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> m_solver;
+
+    //! Number of nonzero elements of the sparsity pattern analyzed by
+    //! #m_solver. Since the pattern is never reduced, a change in the number
+    //! of nonzero elements indicates a change of the pattern.
+    size_t m_nnz_analyzed;
+
+    //! Number of times the sparsity pattern has been analyzed
+    int m_npatterns;
 };
 }
 
@@ -29,7 +29,8 @@ public:
     }
 
     //! Compute the undamped Newton step.  The residual function is evaluated
-    //! at `x`, but the Jacobian is not recomputed.
+    //! at `x`, but the Jacobian is not recomputed. Any Broyden updates of the
+    //! Jacobian made since it was last evaluated are applied to the step.
     void step(doublereal* x, doublereal* step,
               OneDim& r, MultiJac& jac, int loglevel);
 
@@ -69,10 +70,47 @@ public:
         m_maxAge = maxJacAge;
     }
 
+    //! Set the maximum number of Broyden updates of the Jacobian.
+    /*!
+     * If this number is greater than zero, the approximate inverse of the
+     * Jacobian is updated after each successful damped step \f$ s = x_1 - x_0
+     * \f$ such that it satisfies the secant condition \f$ H_{k+1} (F(x_1) -
+     * F(x_0)) = s \f$. The updates use Broyden's "good" method in product form,
+     * \f$ H_{k+1} = (I + u_k v_k^T) H_k \f$, where \f$ v_k \f$ is the step
+     * scaled by the squared error weights used in norm2(). This allows the
+     * Newton iteration to continue with an old Jacobian, for example after a
+     * parameter of the problem has been changed, instead of evaluating a new
+     * Jacobian. The updates are discarded whenever the Jacobian is evaluated,
+     * and at the start of each call to solve(). Once the maximum number of
+     * updates is reached, the iteration continues without further updates.
+     * The default is 0, which disables the updates.
+     */
+    void setBroydenUpdates(size_t nmax) {
+        m_maxBroyden = nmax;
+    }
+
+    //! Maximum number of Broyden updates of the Jacobian
+    size_t broydenUpdates() const {
+        return m_maxBroyden;
+    }
+
+    //! Total number of Broyden updates made by this object
+    size_t nBroydenUpdates() const {
+        return m_nBroyden;
+    }
+
     //! Change the problem size.
     void resize(size_t points);
 
 protected:
+    //! Add a Broyden update for the step from `x0` to `x1`. On entry,
+    //! #m_g0 and #m_g contain the Newton steps at `x0` and `x1` computed
+    //! using the Jacobian without updates.
+    void updateBroyden(const double* x0, const double* x1, OneDim& r);
+
+    //! Apply the Broyden updates to the step `s` computed with the Jacobian
+    void applyBroyden(double* s) const;
+
     //! Work arrays of size #m_n used in solve().
     vector_fp m_x, m_stp, m_stp1;
 
@@ -82,6 +120,22 @@ protected:
     size_t m_n;
 
     doublereal m_elapsed;
+
+    //! Newton step computed by the last call to step(), before the Broyden
+    //! updates are applied
+    vector_fp m_g;
+
+    //! Value of #m_g at the start of the current damped step
+    vector_fp m_g0;
+
+    //! Vectors \f$ u_k \f$ and \f$ v_k \f$ defining the Broyden updates
+    std::vector<vector_fp> m_broydenU, m_broydenV;
+
+    //! Maximum number of Broyden updates
+    size_t m_maxBroyden;
+
+    //! Total number of Broyden updates
+    size_t m_nBroyden;
 };
 }
 
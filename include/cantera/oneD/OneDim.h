@@ -252,6 +252,16 @@ public:
 
     void setJacAge(int ss_age, int ts_age=-1);
 
+    //! Set whether the Jacobian is stored as a sparse matrix and factored using
+    //! a sparse LU decomposition, instead of a banded LU decomposition. See
+    //! MultiJac.
+    void setSparseJacobian(bool sparse);
+
+    //! Return `true` if a sparse Jacobian is used
+    bool sparseJacobian() const {
+        return m_sparse_jac;
+    }
+
     /**
      * Save statistics on function and Jacobian evaluation, and reset the
      * counters. Statistics are saved only if the number of Jacobian
@@ -335,6 +345,7 @@ protected:
     std::unique_ptr<MultiNewton> m_newt; //!< Newton iterator
     doublereal m_rdt; //!< reciprocal of time step
     bool m_jac_ok; //!< if true, Jacobian is current
+    bool m_sparse_jac; //!< if true, use a sparse Jacobian
 
     size_t m_bw; //!< Jacobian bandwidth
     size_t m_size; //!< solution vector size
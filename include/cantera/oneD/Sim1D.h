@@ -113,6 +113,14 @@ public:
 
     /**
      * Save the current solution to a container file.
+     *
+     * Files with the extension `.ctsol` are binary containers, where solutions
+     * are appended to the end of the file in the format generated by
+     * AnyMap::toBinaryString(). Saving a solution with an existing id
+     * supersedes the earlier solution without rewriting the file. Other files
+     * are written in YAML format, which requires reading and rewriting the
+     * entire file.
+     *
      * @param fname  Name of output container file
      * @param id  Identifier of solution within the container file
      * @param desc  Description of the solution
@@ -132,7 +140,8 @@ public:
                       const std::string& desc, int loglevel=1);
 
     /**
-     * Initialize the solution with a previously-saved solution.
+     * Initialize the solution with a previously-saved solution. For binary
+     * containers (see save()), only the requested solution is read.
      * @param fname  Name of container file
      * @param id  Identifier of solution within the container file
      * @param loglevel  Level of diagnostic output
@@ -152,6 +161,92 @@ public:
 
     void solve(int loglevel = 0, bool refine_grid = true);
 
+    //! Solve the problem for a sequence of values of a parameter.
+    /*!
+     * For each value, `setParameter` is called with the value to modify the
+     * problem, and the problem is then solved using the solution for the
+     * previous value as the initial estimate. Instead of evaluating a new
+     * Jacobian after each change of the parameter, the Newton iteration is
+     * first attempted with the Jacobian of the previous solution, which is
+     * corrected using Broyden updates (see MultiNewton::setBroydenUpdates). A
+     * new Jacobian is evaluated if this iteration fails, after which the solver
+     * proceeds as in solve().
+     *
+     * The parameter should only affect values used by the governing equations,
+     * such as boundary conditions or the pressure, and not the structure of
+     * the problem.
+     *
+     * @param values  Parameter values, in the order in which they are solved
+     * @param setParameter  Function called with each parameter value before
+     *     the problem is solved. The return value is ignored.
+     * @param callback  Optional function called with each parameter value
+     *     after the problem has been solved, which may be used to store the
+     *     solution. The return value is ignored.
+     * @param loglevel  Amount of diagnostic output
+     * @param refine_grid  If `true`, enable grid refinement
+     * @returns  Number of parameter values for which the problem was solved
+     *     without evaluating a new Jacobian before the first converged
+     *     solution. Each of these saves at least one Jacobian evaluation
+     *     compared to calling solve() after changing the parameter.
+     */
+    size_t solveContinuation(const vector_fp& values, Func1* setParameter,
+                             Func1* callback=nullptr, int loglevel=0,
+                             bool refine_grid=true);
+
+    //! Set the maximum number of Broyden updates of the Jacobian used by
+    //! solveContinuation(). The default is 10.
+    void setContinuationBroydenUpdates(size_t nmax) {
+        m_continuation_broyden = nmax;
+    }
+
+    //! Take a step of pseudo-arclength continuation in a parameter.
+    /*!
+     * The solution branch is parameterized by its arc length in the plane of
+     * the parameter \f$ p \f$ and the scaled maximum temperature
+     * \f$ \theta = T_{max} / T_s \f$ (see maxTemperature()). Unlike
+     * integral measures of the solution, the maximum temperature remains a
+     * sensitive measure of the flame state close to extinction, where the
+     * flame is thin. Starting from
+     * the current solution \f$ (p_0, \theta_0) \f$, the new solution
+     * satisfies the governing equations together with the condition
+     * \f[
+     *     t_p (p - p_0) + t_\theta (\theta - \theta_0) = \Delta s
+     * \f]
+     * where \f$ (t_p, t_\theta) \f$ is the unit tangent of the branch.
+     * Since the parameter is an unknown of this augmented system, the
+     * continuation can pass turning points of the branch, such as the
+     * extinction point of a counterflow flame. The augmented system is solved
+     * by Newton iteration, using block elimination with the Jacobian of the
+     * governing equations. The derivative of the residual with respect to the
+     * parameter is computed by finite differences.
+     *
+     * @param[in,out] param  Parameter value, updated to the value of the new
+     *     solution if the step is successful
+     * @param[in,out] tangent  Array of length 2 containing the unit tangent
+     *     \f$ (t_p, t_\theta) \f$. If the step is successful, it is replaced
+     *     by the direction of the secant through the old and the new solution.
+     * @param ds  Arc length of the step
+     * @param setParameter  Function used to set the parameter value. The
+     *     parameter should only affect values used by the governing equations,
+     *     such as the mass flux of an inlet. The return value is ignored.
+     * @param Tscale  Temperature scale \f$ T_s \f$ [K]
+     * @param loglevel  Amount of diagnostic output
+     * @param refine_grid  If `true`, the grid is refined after the new solution
+     *     has been found, and the solution is recomputed on the new grid.
+     * @returns  `true` if the step was successful. Otherwise, the solution,
+     *     the grid and the parameter value are restored to their values at
+     *     the start of the step, and the step should be repeated using a
+     *     smaller value of `ds`.
+     */
+    bool arcLengthStep(double& param, double* tangent, double ds,
+                       Func1* setParameter, double Tscale=1000.0,
+                       int loglevel=0, bool refine_grid=true);
+
+    //! Maximum temperature [K] of all flow domains
+    double maxTemperature() {
+        return maxTemperature(m_x.data());
+    }
+
     void eval(doublereal rdt=-1.0, int count = 1) {
         OneDim::eval(npos, m_x.data(), m_xnew.data(), rdt, count);
     }
@@ -293,10 +388,24 @@ protected:
     //! User-supplied function called after a successful steady-state solve.
     Func1* m_steady_callback;
 
+    //! Maximum number of Broyden updates used by solveContinuation()
+    size_t m_continuation_broyden;
+
 private:
     //! Calls method _finalize in each domain.
     void finalize();
 
+    //! Maximum temperature of the solution `x`. If `weights` is given, it is
+    //! set to the derivatives of the maximum temperature with respect to the
+    //! components of `x`.
+    double maxTemperature(const double* x, double* weights=nullptr);
+
+    //! Solve the augmented system of arcLengthStep() on the current grid,
+    //! starting from the solution in #m_x.
+    bool arcLengthCorrector(double& param, double p0, double theta0,
+                            const double* tangent, double ds,
+                            Func1* setParameter, double Tscale, int loglevel);
+
     //! Wrapper around the Newton solver
     /*!
      * @return 0 if successful, -1 on failure
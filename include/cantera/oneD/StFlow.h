@@ -206,6 +206,27 @@ public:
         return m_do_radiation;
     }
 
+    //! Turn analytical evaluation of the chemistry Jacobian on / off.
+    /*!
+     *  If enabled, the net production rates are held fixed at their values for
+     *  the unperturbed solution while the Jacobian is evaluated by finite
+     *  differences, and the derivatives of the chemical source terms in the
+     *  species and energy equations are instead added using the analytical
+     *  derivatives provided by the Kinetics object. This avoids evaluating the
+     *  reaction rates once for every perturbed solution component.
+     *
+     *  @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    void setAnalyticChemistryJacobian(bool analytic) {
+        m_analytic_chem_jac = analytic;
+    }
+
+    //! Returns `true` if the chemistry Jacobian is evaluated analytically
+    bool analyticChemistryJacobian() const {
+        return m_analytic_chem_jac;
+    }
+
     //! Return radiative heat loss at grid point j
     double radiativeHeatLoss(size_t j) const {
         return m_qdotRadiation[j];
@@ -262,6 +283,11 @@ public:
     virtual void eval(size_t j, doublereal* x, doublereal* r,
                       integer* mask, doublereal rdt);
 
+    //! Add the derivatives of the chemical source terms at all interior grid
+    //! points to the Jacobian, if analytical evaluation of the chemistry
+    //! Jacobian is enabled.
+    virtual void evalJacobian(double* xg, MultiJac& jac);
+
     //! Evaluate all residual components at the right boundary.
     virtual void evalRightBoundary(double* x, double* res, int* diag,
                                    double rdt);
@@ -463,6 +489,13 @@ protected:
     //! flag for the radiative heat loss
     bool m_do_radiation;
 
+    //! flag for analytical evaluation of the chemistry Jacobian
+    bool m_analytic_chem_jac;
+
+    //! `true` while the net production rates are held fixed during a finite
+    //! difference Jacobian evaluation
+    bool m_freeze_chem;
+
     //! radiative heat loss vector
     vector_fp m_qdotRadiation;
 
@@ -492,6 +525,11 @@ public:
 
 private:
     vector_fp m_ybar;
+
+    //! Temperatures, pressures and mole fractions at the midpoints between
+    //! grid points, used for evaluating the mixture-averaged transport
+    //! properties
+    vector_fp m_Tbar, m_Pbar, m_Xbar;
 };
 
 }
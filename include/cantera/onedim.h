@@ -19,5 +19,6 @@
 #include "oneD/Boundary1D.h"
 #include "oneD/StFlow.h"
 #include "oneD/refine.h"
+#include "oneD/FlameletTable.h"
 
 #endif
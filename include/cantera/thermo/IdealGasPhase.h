@@ -552,6 +552,20 @@ public:
     virtual bool addSpecies(shared_ptr<Species> spec);
     virtual void setToEquilState(const doublereal* mu_RT);
 
+    //! Set the temperature from the specific enthalpy or internal energy.
+    /*!
+     * Since the enthalpy of an ideal gas depends only on temperature and
+     * composition, the temperature is found using a Newton iteration with the
+     * analytic heat capacity. Each iteration requires a single evaluation of
+     * the species reference state properties, which provides both the
+     * enthalpies and the heat capacities. Newton steps which leave the
+     * bracket formed by the previous iterates are replaced by bisection.
+     *
+     * @see ThermoPhase::setTemperatureFromEnergy
+     */
+    virtual bool setTemperatureFromEnergy(double target, double rtol,
+                                          bool doUV);
+
 protected:
     //! Reference state pressure
     /*!
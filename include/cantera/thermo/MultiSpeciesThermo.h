@@ -29,6 +29,12 @@ namespace Cantera
  * the same parameterization are grouped together in order to minimize the
  * operation count and achieve better efficiency.
  *
+ * Species using the NASA 7-coefficient polynomials (NasaPoly2) are further
+ * grouped by their midpoint temperature. The coefficients for each group are
+ * stored in arrays with one row per coefficient and one column per species, so
+ * that the properties of all species in a group are evaluated in a single loop
+ * without calls to the individual SpeciesThermoInterpType objects.
+ *
  * The most important member function for the MultiSpeciesThermo class is the
  * member function MultiSpeciesThermo::update(). The function calculates the
  * values of Cp/R, H/RT, and S/R for all of the species at once at the specified
@@ -97,6 +103,18 @@ public:
     virtual void update(doublereal T, doublereal* cp_R,
                         doublereal* h_RT, doublereal* s_R) const;
 
+    //! Number of calls to update() since this object was created or since the
+    //! last call to resetUpdateCount(). Used to measure how often the species
+    //! properties are evaluated.
+    size_t nUpdates() const {
+        return m_nUpdates;
+    }
+
+    //! Reset the counter returned by nUpdates()
+    void resetUpdateCount() {
+        m_nUpdates = 0;
+    }
+
     //! Minimum temperature.
     /*!
      * If no argument is supplied, this method returns the minimum temperature
@@ -201,6 +219,42 @@ protected:
     //! Mark species *k* as having its thermodynamic data installed
     void markInstalled(size_t k);
 
+    //! Add the coefficients of the NasaPoly2 parameterization of species *k*
+    //! to the group with the corresponding midpoint temperature
+    void addNasa(size_t k, const SpeciesThermoInterpType& stit);
+
+    //! Remove the coefficients of species *k* from its NasaPoly2 group
+    void removeNasa(size_t k);
+
+    //! Update the NasaPoly2 coefficients of species *k* after its
+    //! parameterization has been modified
+    void modifyNasa(size_t k);
+
+    //! Evaluate properties of all NasaPoly2 species
+    void updateNasa(double T, double* cp_R, double* h_RT, double* s_R) const;
+
+    //! Coefficients of a group of NasaPoly2 species with the same midpoint
+    //! temperature
+    struct NasaGroup {
+        double Tmid; //!< Midpoint temperature [K]
+        std::vector<size_t> species; //!< Indices of the species in the group
+        //! Coefficients for the low temperature range. `low[i][j]` is
+        //! coefficient `i` for species `species[j]`.
+        std::vector<vector_fp> low;
+        //! Coefficients for the high temperature range, stored like #low
+        std::vector<vector_fp> high;
+    };
+
+    //! Groups of species using the NasaPoly2 parameterization
+    std::vector<NasaGroup> m_nasa;
+
+    //! Map from species index to group within #m_nasa and position within the
+    //! group
+    std::map<size_t, std::pair<size_t, size_t>> m_nasaLoc;
+
+    //! Work arrays for properties of NasaPoly2 species
+    mutable vector_fp m_nasa_cp, m_nasa_h, m_nasa_s;
+
     typedef std::pair<size_t, shared_ptr<SpeciesThermoInterpType> > index_STIT;
     typedef std::map<int, std::vector<index_STIT> > STIT_map;
     typedef std::map<int, vector_fp> tpoly_map;
@@ -230,6 +284,9 @@ protected:
 
     //! indicates if data for species has been installed
     std::vector<bool> m_installed;
+
+    //! Number of calls to update()
+    mutable size_t m_nUpdates;
 };
 
 }
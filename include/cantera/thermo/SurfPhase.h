@@ -110,6 +110,11 @@ public:
         return "Surf";
     }
 
+    //! Boolean indicating whether phase is ideal
+    virtual bool isIdeal() const {
+        return true;
+    }
+
     virtual bool isCompressible() const {
         return false;
     }
@@ -915,6 +915,29 @@ public:
      */
     virtual void setState_UV(double u, double v, double tol=1e-9);
 
+    //! Set the temperature such that the specific enthalpy or internal energy
+    //! has the given value, using a method specialized for this phase.
+    /*!
+     * The pressure (if `doUV` is false) or the density (if `doUV` is true) and
+     * the composition are held constant. This is used by setState_HP() and
+     * setState_UV() before the general iteration, and by reactors to recover
+     * the temperature from the energy equation. The base class does not
+     * provide a specialized method and returns false without changing the
+     * state.
+     *
+     * @param target  Specific enthalpy or internal energy (J/kg)
+     * @param rtol    Relative tolerance of the temperature
+     * @param doUV    True to solve for the internal energy at constant
+     *                density, false to solve for the enthalpy at constant
+     *                pressure.
+     * @returns  True if the temperature was found. If false, the original
+     *     state of the phase is restored.
+     */
+    virtual bool setTemperatureFromEnergy(double target, double rtol,
+                                          bool doUV) {
+        return false;
+    }
+
     //! Set the specific entropy (J/kg/K) and pressure (Pa).
     /*!
      * This function fixes the internal state of the phase so that the specific
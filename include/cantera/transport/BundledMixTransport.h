@@ -0,0 +1,163 @@
+/**
+ *  @file BundledMixTransport.h
+ *    Headers for the BundledMixTransport object, which models mixture-averaged
+ *    transport properties in ideal gas solutions using groups of species with
+ *    similar binary diffusion coefficients
+ *    (see \ref tranprops and \link Cantera::BundledMixTransport BundledMixTransport \endlink) .
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BUNDLEDMIXTRAN_H
+#define CT_BUNDLEDMIXTRAN_H
+
+#include "MixTransport.h"
+
+namespace Cantera
+{
+//! Class BundledMixTransport implements the mixture-averaged transport model
+//! using species bundles to reduce the cost of the mixture rules for
+//! mechanisms with many species.
+/*!
+ * When the transport model is initialized, the species are partitioned into
+ * bundles. A species is added to the bundle of a representative species if
+ * its binary diffusion coefficients with all other species, its
+ * self-diffusion coefficient and its viscosity differ from those of the
+ * representative species by a factor of at most `exp(tol)` at a set of
+ * temperatures spanning the temperature range of the phase, where `tol` is the
+ * bundling tolerance set using setBundleTolerance().
+ *
+ * The binary diffusion coefficients and the weighting functions of the Wilke
+ * mixture rule for the viscosity are then evaluated only for each pair of
+ * bundles, using the fits for the representative species. The
+ * mixture-averaged diffusion coefficient of species *k* in bundle *A* is
+ * computed as
+ *
+ * \f[
+ *     D_{km}^\prime = \frac{1 - Y_k}{\sum_{B \ne A} X_B / \mathcal{D}_{AB}
+ *         + (X_A - X_k) / \mathcal{D}_{AA}}
+ * \f]
+ *
+ * where \f$ X_B \f$ is the sum of the mole fractions of the species in bundle
+ * *B*. The cost of evaluating the diffusion coefficients and the viscosity
+ * therefore scales with the square of the number of bundles rather than the
+ * square of the number of species. The pure species viscosities and thermal
+ * conductivities are evaluated for each species, as in MixTransport. With a
+ * tolerance of zero, only species with identical fits are combined, and the
+ * results are the same as those of MixTransport.
+ *
+ * @warning  This class is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ *
+ * @ingroup tranprops
+ */
+class BundledMixTransport : public MixTransport
+{
+public:
+    BundledMixTransport();
+
+    virtual std::string transportModel() const {
+        return (m_mode == CK_Mode) ? "CK_BundledMix" : "BundledMix";
+    }
+
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo) const;
+
+    virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
+
+    //! Set the tolerance used to group species into bundles and recompute the
+    //! bundles. The default is 0.01.
+    //! @param tol  maximum difference of the logarithms of the diffusion
+    //!     coefficients and viscosities of species in the same bundle
+    void setBundleTolerance(double tol);
+
+    //! Get the tolerance used to group species into bundles
+    double bundleTolerance() const {
+        return m_bundleTol;
+    }
+
+    //! Number of species bundles
+    size_t nBundles() const {
+        return m_bundleRep.size();
+    }
+
+    //! Index of the bundle containing species `k`
+    size_t bundleIndex(size_t k) const {
+        return m_bundle[k];
+    }
+
+    //! Index of the representative species of bundle `b`
+    size_t bundleRepresentative(size_t b) const {
+        return m_bundleRep[b];
+    }
+
+    virtual double viscosity();
+    virtual void getMixDiffCoeffs(double* const d);
+
+    //! Uses the generic implementation, which evaluates the bundled mixture
+    //! rules for each state.
+    virtual void getMixTransportProperties(size_t nPoints, const double* T,
+                                           const double* P, const double* X,
+                                           double* visc, double* cond,
+                                           double* Dmix) {
+        Transport::getMixTransportProperties(nPoints, T, P, X, visc, cond, Dmix);
+    }
+
+    virtual void setViscosityPolynomial(size_t i, double* coeffs);
+    virtual void setBinDiffusivityPolynomial(size_t i, size_t j, double* coeffs);
+
+protected:
+    //! Copy constructor used to implement clone()
+    BundledMixTransport(const BundledMixTransport& other) = default;
+
+    //! Partition the species into bundles and set up the polynomial fits for
+    //! the binary diffusion coefficients of each pair of bundles
+    void setupBundles();
+
+    //! Update the binary diffusion coefficients for each pair of bundles
+    void updateBundleDiff_T();
+
+    //! Update the binary diffusion coefficients for each pair of species,
+    //! which are set to the values for the corresponding pair of bundles
+    virtual void updateDiff_T();
+
+    //! Index of the pair of bundles `(a, b)` in #m_bundleDiff
+    size_t bundlePair(size_t a, size_t b) const {
+        if (a > b) {
+            std::swap(a, b);
+        }
+        return a * (2 * nBundles() - a + 1) / 2 + b - a;
+    }
+
+    //! Tolerance used to group species into bundles
+    double m_bundleTol;
+
+    //! Index of the bundle containing each species. Length: m_nsp
+    std::vector<size_t> m_bundle;
+
+    //! Representative species of each bundle. Length: nBundles()
+    std::vector<size_t> m_bundleRep;
+
+    //! Polynomial fits to the binary diffusion coefficients for each pair of
+    //! bundles, with rows ordered like those of #m_diffcoeffs
+    DenseMatrix m_bundleDiffCoeffs;
+
+    //! Binary diffusion coefficients for each pair of bundles at unit
+    //! pressure
+    vector_fp m_bundleDiff;
+
+    //! Temperature at which #m_bundleDiff was evaluated
+    double m_bundleDiffTemp;
+
+    //! Weighting functions of the viscosity mixture rule for each pair of
+    //! bundles
+    DenseMatrix m_bundlePhi;
+
+    //! Sum of the mole fractions of the species in each bundle
+    vector_fp m_bundleX;
+
+    //! Work array of length nBundles()
+    vector_fp m_bundleWork;
+};
+}
+#endif
@@ -163,6 +163,7 @@ public:
 
 protected:
     GasTransport(ThermoPhase* thermo=0);
+    GasTransport(const GasTransport& other) = default;
 
     virtual void update_T();
     virtual void update_C() = 0;
@@ -193,6 +194,27 @@ protected:
      */
     virtual void updateDiff_T();
 
+    //! Evaluate a set of polynomial fits in log(T)
+    /*!
+     * The coefficients for each fit are stored in one row of `coeffs`, so
+     * that each column holds one coefficient for all fits. The fits are
+     * evaluated together, one coefficient at a time, in loops over contiguous
+     * arrays which can be vectorized by the compiler.
+     *
+     * @param coeffs  matrix of polynomial coefficients, with one row per fit
+     * @param logtPowers  powers of log(T), starting with the zeroth power, as
+     *     stored in #m_polytempvec
+     * @param prefactor  factor multiplying the polynomial (not used in
+     *     CK_Mode, where the polynomial is a fit to the logarithm)
+     * @param[out] values  values of the fits. Length: `coeffs.nRows()`
+     */
+    void evalPolynomials(const DenseMatrix& coeffs, const double* logtPowers,
+                         double prefactor, double* values) const;
+
+    //! Compute the factors depending on the molecular weights which are used
+    //! in the Wilke mixture rule for the viscosity
+    void setupWilkeFactors();
+
     //! @name Initialization
     //! @{
 
@@ -324,26 +346,23 @@ protected:
     //! rule to calculate the viscosity of the solution. length = m_kk.
     vector_fp m_visc;
 
-    //! Polynomial fits to the viscosity of each species. m_visccoeffs[k] is
-    //! the vector of polynomial coefficients for species k that fits the
-    //! viscosity as a function of temperature.
-    std::vector<vector_fp> m_visccoeffs;
+    //! Polynomial fits to the viscosity of each species. Row `k` holds the
+    //! polynomial coefficients for species k that fit the viscosity as a
+    //! function of temperature. Size is nsp x (degree+1).
+    DenseMatrix m_visccoeffs;
 
     //! Local copy of the species molecular weights.
     vector_fp m_mw;
 
-    //! Holds square roots of molecular weight ratios
+    //! Holds fourth roots of molecular weight ratios
     /*!
-     *  @code
-     *  m_wratjk(j,k)  = sqrt(mw[j]/mw[k])        j < k
-     *  m_wratjk(k,j)  = sqrt(sqrt(mw[j]/mw[k]))  j < k
-     *  @endcode
+     *  `m_wratjk(k,j) = (mw[j]/mw[k])^(1/4)`
      */
     DenseMatrix m_wratjk;
 
-    //! Holds square roots of molecular weight ratios
+    //! Holds the denominator of the Wilke mixture rule
     /*!
-     *  `m_wratjk1(j,k)  = sqrt(1.0 + mw[k]/mw[j])        j < k`
+     *  `m_wratkj1(k,j) = 1.0 / sqrt(8.0 * (1.0 + mw[k]/mw[j]))`
      */
     DenseMatrix m_wratkj1;
 
@@ -380,8 +399,8 @@ protected:
 
     //! Polynomial fits to the binary diffusivity of each species
     /*!
-     * m_diffcoeff[ic] is vector of polynomial coefficients for species i
-     * species j that fits the binary diffusion coefficient. The relationship
+     * Row `ic` of m_diffcoeffs holds the polynomial coefficients for species i
+     * and species j that fit the binary diffusion coefficient. The relationship
      * between i j and ic is determined from the following algorithm:
      *
      *      int ic = 0;
@@ -391,7 +410,11 @@ protected:
      *         }
      *      }
      */
-    std::vector<vector_fp> m_diffcoeffs;
+    DenseMatrix m_diffcoeffs;
+
+    //! Work array holding the binary diffusion coefficients for each species
+    //! pair, ordered like the rows of #m_diffcoeffs
+    vector_fp m_bdiff_pairs;
 
     //! Matrix of binary diffusion coefficients at the reference pressure and
     //! the current temperature Size is nsp x nsp.
@@ -399,10 +422,10 @@ protected:
 
     //! temperature fits of the heat conduction
     /*!
-     *  Dimensions are number of species (nsp) polynomial order of the collision
-     *  integral fit (degree+1).
+     *  Dimensions are number of species (nsp) by polynomial order of the
+     *  collision integral fit (degree+1).
      */
-    std::vector<vector_fp> m_condcoeffs;
+    DenseMatrix m_condcoeffs;
 
     //! Indices for the (i,j) interaction in collision integral fits
     /*!
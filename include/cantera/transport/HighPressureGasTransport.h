@@ -44,11 +44,16 @@ protected:
      */
     HighPressureGasTransport(ThermoPhase* thermo=0);
 
+    //! Copy constructor used to implement clone()
+    HighPressureGasTransport(const HighPressureGasTransport& other) = default;
+
 public:
     virtual std::string transportModel() const {
         return "HighPressureGas";
     }
 
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo) const;
+
     //! Return the thermal diffusion coefficients (kg/m/s)
     /*!
      *  Currently not implemented for this model
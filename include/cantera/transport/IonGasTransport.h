@@ -55,6 +55,8 @@ public:
         return "Ion";
     }
 
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo) const;
+
     virtual void init(ThermoPhase* thermo, int mode, int log_level);
 
     //! Viscosity of the mixture  (kg/m/s).
@@ -73,6 +75,15 @@ public:
     //! The binary transport between two charged species is neglected.
     virtual void getMixDiffCoeffs(double* const d);
 
+    //! Uses the generic implementation, since the mixture rules of
+    //! MixTransport do not apply to charged species.
+    virtual void getMixTransportProperties(size_t nPoints, const double* T,
+                                           const double* P, const double* X,
+                                           double* visc, double* cond,
+                                           double* Dmix) {
+        Transport::getMixTransportProperties(nPoints, T, P, X, visc, cond, Dmix);
+    }
+
     /*! The electrical conductivity (Siemens/m).
      * \f[
      *     \sigma = \sum_k{\left|C_k\right| \mu_k \frac{X_k P}{k_b T}}
@@ -81,6 +92,9 @@ public:
     virtual double electricalConductivity();
 
 protected:
+    //! Copy constructor used to implement clone()
+    IonGasTransport(const IonGasTransport& other) = default;
+
     //! setup parameters for n64 model
     void setupN64();
 
@@ -63,6 +63,8 @@ public:
         return (m_mode == CK_Mode) ? "CK_Mix" : "Mix";
     }
 
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo) const;
+
     //! Return the thermal diffusion coefficients
     /*!
      * For this approximation, these are all zero.
@@ -149,9 +151,26 @@ public:
                                   size_t ldx, const doublereal* const grad_X,
                                   size_t ldf, doublereal* const fluxes);
 
+    //! Compute the mixture-averaged transport properties for a set of states
+    /*!
+     * The properties are evaluated directly from the polynomial fits and the
+     * mixture rules, without modifying the state of the phase or the cached
+     * properties of this object. Different sets of states can therefore be
+     * evaluated concurrently from multiple threads.
+     *
+     * @see Transport::getMixTransportProperties
+     */
+    virtual void getMixTransportProperties(size_t nPoints, const double* T,
+                                           const double* P, const double* X,
+                                           double* visc, double* cond,
+                                           double* Dmix);
+
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
 protected:
+    //! Copy constructor used to implement clone()
+    MixTransport(const MixTransport& other) = default;
+
     //! Update the temperature dependent parts of the species thermal
     //! conductivities
     /*!
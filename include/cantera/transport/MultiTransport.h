@@ -36,6 +36,8 @@ public:
         return (m_mode == CK_Mode) ? "CK_Multi" : "Multi";
     }
 
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo) const;
+
     //! Return the thermal diffusion coefficients (kg/m/s)
     /*!
      * Eqn. (12.126) displays how they are calculated. The reference work is
@@ -110,6 +112,9 @@ public:
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
 protected:
+    //! Copy constructor used to implement clone()
+    MultiTransport(const MultiTransport& other) = default;
+
     //! Update basic temperature-dependent quantities if the temperature has
     //! changed.
     void update_T();
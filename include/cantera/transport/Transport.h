@@ -152,10 +152,23 @@ public:
 
     virtual ~Transport() {}
 
-    // Transport objects are not copyable or assignable
-    Transport(const Transport&) = delete;
+    // Transport objects are not assignable. Copies for a different phase are
+    // created using clone().
     Transport& operator=(const Transport&) = delete;
 
+    //! Create a copy of this Transport object for a different phase.
+    /*!
+     * The copy has its own copies of the fitted transport property polynomials
+     * and collision parameters, so these do not need to be computed again.
+     *
+     * @param thermo  Phase of the new object, which must contain the same
+     *     species as the phase of this object, in the same order.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo) const;
+
     //! Identifies the model represented by this Transport object. Each derived class
     //! should override this method to return a meaningful identifier.
     //! @since  New in Cantera 3.0.
@@ -620,6 +633,38 @@ public:
             "Not implemented for transport model '{}'.", transportModel());
     }
 
+    //! Compute the mixture-averaged transport properties for a set of states
+    /*!
+     * This method is equivalent to setting the state of the phase to each of
+     * the specified states in turn and calling viscosity(),
+     * thermalConductivity() and getMixDiffCoeffs(). Transport models may
+     * implement it more efficiently by evaluating the properties for all
+     * states together, without modifying the state of the phase.
+     *
+     * The default implementation sets the state of the phase for each point,
+     * which is left in the last of the specified states.
+     *
+     * @param nPoints  Number of states
+     * @param T  Temperatures [K]. Length: nPoints
+     * @param P  Pressures [Pa]. Length: nPoints
+     * @param X  Mole fractions, with the mole fractions for each state stored
+     *     consecutively. The mole fractions for each state are normalized
+     *     to sum to one. Length: nPoints * nSpecies()
+     * @param[out] visc  Mixture viscosities [Pa-s]. Length: nPoints
+     * @param[out] cond  Mixture thermal conductivities [W/m/K].
+     *     Length: nPoints
+     * @param[out] Dmix  Mixture-averaged diffusion coefficients [m^2/s], as
+     *     returned by getMixDiffCoeffs(), stored consecutively for each
+     *     state. Length: nPoints * nSpecies()
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual void getMixTransportProperties(size_t nPoints, const double* T,
+                                           const double* P, const double* X,
+                                           double* visc, double* cond,
+                                           double* Dmix);
+
     //! Return the polynomial fits to the viscosity of species i
     virtual void getViscosityPolynomial(size_t i, double* coeffs) const{
         throw NotImplementedError("Transport::getViscosityPolynomial",
@@ -767,6 +812,11 @@ public:
     }
 
 protected:
+    //! Copy constructor used to implement clone(). The copy refers to the
+    //! phase of `other` until it is replaced using setThermo(), and is not
+    //! associated with a Solution object.
+    Transport(const Transport& other);
+
     //! Enable the transport object for use.
     /*!
      * Once finalize() has been called, the transport manager should be ready to
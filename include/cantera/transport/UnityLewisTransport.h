@@ -25,12 +25,18 @@ namespace Cantera
 class UnityLewisTransport : public MixTransport
 {
 public:
-//    UnityLewisTransport() {}
+    UnityLewisTransport() {}
 
     virtual std::string transportModel() const {
         return "UnityLewis";
     }
 
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo) const {
+        shared_ptr<UnityLewisTransport> tr(new UnityLewisTransport(*this));
+        tr->setThermo(*thermo);
+        return tr;
+    }
+
     //! Returns the unity Lewis number approximation based diffusion
     //! coefficients [m^2/s].
     /*!
@@ -60,6 +66,15 @@ public:
         }
     }
 
+    //! Uses the generic implementation, since the diffusion coefficients
+    //! depend on the heat capacity of the mixture.
+    virtual void getMixTransportProperties(size_t nPoints, const double* T,
+                                           const double* P, const double* X,
+                                           double* visc, double* cond,
+                                           double* Dmix) {
+        Transport::getMixTransportProperties(nPoints, T, P, X, visc, cond, Dmix);
+    }
+
     //! Not implemented for unity Lewis number approximation
     virtual void getMixDiffCoeffsMole(double* const d){
         throw NotImplementedError("UnityLewisTransport::getMixDiffCoeffsMole");
@@ -84,6 +99,10 @@ public:
             d[k] = Dm;
         }
     }
+
+protected:
+    //! Copy constructor used to implement clone()
+    UnityLewisTransport(const UnityLewisTransport& other) = default;
 };
 }
 #endif
@@ -38,6 +38,8 @@ public:
     virtual void updateState(double* y);
 
 protected:
+    virtual void getProductionRateAdjoint(const double* lambda, double* mu);
+
     const size_t m_sidx = 1;
 };
 
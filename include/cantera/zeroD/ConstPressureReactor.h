@@ -41,6 +41,9 @@ public:
     //! species.
     virtual size_t componentIndex(const std::string& nm) const;
     std::string componentName(size_t k);
+
+protected:
+    virtual void getProductionRateAdjoint(const double* lambda, double* mu);
 };
 
 }
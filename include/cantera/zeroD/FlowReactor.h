@@ -47,6 +47,8 @@ public:
     virtual size_t componentIndex(const std::string& nm) const;
 
 protected:
+    virtual void getProductionRateAdjoint(const double* lambda, double* mu);
+
     doublereal m_speed, m_dist, m_T;
     doublereal m_fctr;
     doublereal m_rho0, m_speed0, m_P0, m_h0;
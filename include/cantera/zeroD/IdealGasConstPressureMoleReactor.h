@@ -46,6 +46,8 @@ public:
     virtual Eigen::SparseMatrix<double> jacobian();
 
 protected:
+    virtual void getProductionRateAdjoint(const double* lambda, double* mu);
+
     vector_fp m_hk; //!< Species molar enthalpies
 };
 
@@ -44,6 +44,8 @@ public:
     std::string componentName(size_t k);
 
 protected:
+    virtual void getProductionRateAdjoint(const double* lambda, double* mu);
+
     vector_fp m_hk; //!< Species molar enthalpies
 };
 }
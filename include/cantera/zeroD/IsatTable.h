@@ -0,0 +1,215 @@
+//! @file IsatTable.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ISATTABLE_H
+#define CT_ISATTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+namespace Cantera
+{
+
+class Solution;
+class Reactor;
+class ReactorNet;
+class AnyMap;
+
+//! In-situ adaptive tabulation (ISAT) of the reaction mapping of a reactor.
+/*!
+ *  This class computes the state of a reactor after a fixed time step for a
+ *  given initial state, which is the operation needed for the chemistry
+ *  substep of operator-split reacting flow simulations. Instead of
+ *  integrating the reactor for every state, the mapping from the initial state
+ *  to the final state is tabulated as it is encountered, following the
+ *  method of Pope (Combust. Theory Modelling 1:41-63, 1997).
+ *
+ *  The state is represented by the scaled composition vector
+ *  \f$ x = (T / T_s, P / P_s, Y_1, \ldots, Y_K) \f$, where \f$ T_s \f$ and
+ *  \f$ P_s \f$ are set using setScales(). Each record of the table stores an
+ *  initial state \f$ x_0 \f$, the corresponding final state \f$ x_1 \f$, the
+ *  mapping gradient \f$ A = \partial x_1 / \partial x_0 \f$ computed by
+ *  finite differences, and an ellipsoid of accuracy (EOA)
+ *  \f$ (x - x_0)^T B (x - x_0) \le 1 \f$ within which the linear
+ *  approximation \f$ x_1 + A (x - x_0) \f$ is assumed to have an error of at
+ *  most the tolerance \f$ \epsilon \f$. The initial EOA is the region where
+ *  \f$ |A (x - x_0)| \le \epsilon \f$, with the singular values of \f$ A \f$
+ *  bounded below by 1/2.
+ *
+ *  For each query state, advance() uses one of the following:
+ *  - **retrieve**: if the query lies within the EOA of a record, the
+ *    linear approximation is returned. Records are found using a binary tree
+ *    of cutting planes between records, followed by a scan of the most
+ *    recently added records.
+ *  - **grow**: otherwise the reactor is integrated directly. If the error of
+ *    the linear approximation of the closest record is within the tolerance,
+ *    its EOA is enlarged to include the query.
+ *  - **add**: otherwise the mapping gradient is computed and a new record is
+ *    added, as long as the maximum number of records has not been reached.
+ *
+ *  advance() may be called concurrently from multiple threads. Lookups use a
+ *  shared lock on the table, which is only locked exclusively while records
+ *  are grown or added. Direct integrations are performed without holding the
+ *  lock, using Solution, Reactor and ReactorNet objects from a pool which is
+ *  enlarged as needed. The Solution objects are created using
+ *  Solution::clone(). The other methods of this class are not thread-safe.
+ *
+ *  @warning  This class is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ *
+ * @ingroup ZeroD
+ */
+class IsatTable
+{
+public:
+    //! Create an empty table
+    /*!
+     *  @param sol  Solution object defining the mechanism. The phase must be an
+     *      ideal gas with a single-phase kinetics model.
+     *  @param reactorType  Type of reactor, as used by newReactor()
+     */
+    IsatTable(shared_ptr<Solution> sol,
+              const std::string& reactorType="IdealGasConstPressureReactor");
+    ~IsatTable();
+    IsatTable(const IsatTable&) = delete;
+    IsatTable& operator=(const IsatTable&) = delete;
+
+    //! Set the time step [s] of the tabulated mapping and remove all records
+    void setTimeStep(double dt);
+
+    //! Get the time step [s] of the tabulated mapping
+    double timeStep() const {
+        return m_dt;
+    }
+
+    //! Set the error tolerance for the scaled composition vector. The default
+    //! is 1e-4.
+    void setTolerance(double tol);
+
+    //! Set the temperature and pressure scales used to form the scaled
+    //! composition vector. The defaults are 1000 K and one atmosphere.
+    void setScales(double Tscale, double Pscale);
+
+    //! Set the relative and absolute tolerances for direct integration and
+    //! remove all records. Must not be called while advance() or integrate()
+    //! are running in other threads, since workers in use by those calls are
+    //! not updated.
+    void setIntegratorTolerances(double rtol, double atol);
+
+    //! Set the maximum number of records. Once it is reached, records are
+    //! still grown, but states which can be neither retrieved nor grown are
+    //! integrated directly without adding records. The default is 2000.
+    void setMaxRecords(size_t nmax);
+
+    //! Set the maximum number of records which are checked after the search
+    //! of the binary tree fails. The default is 50.
+    void setMaxSearch(size_t nmax);
+
+    //! Number of records in the table
+    size_t nRecords() const;
+
+    //! Remove all records and reset the statistics
+    void clear();
+
+    //! Advance a state by the time step of the table.
+    /*!
+     *  @param[in,out] T  temperature [K]
+     *  @param[in,out] P  pressure [Pa]
+     *  @param[in,out] Y  mass fractions. Length: number of species
+     */
+    void advance(double& T, double& P, double* Y);
+
+    //! Integrate the reactor directly, without using or modifying the table
+    void integrate(double& T, double& P, double* Y);
+
+    //! Statistics of the table, containing the number of queries
+    //! (`queries`), retrieves (`retrieves`), grows (`grows`), adds (`adds`),
+    //! direct integrations without adding records (`direct`), and records
+    //! (`records`)
+    AnyMap stats() const;
+
+protected:
+    //! A record of the table
+    struct Record;
+
+    //! A node of the binary tree. Leaf nodes refer to a record, while other
+    //! nodes hold a cutting plane `v . x = a` separating their children.
+    struct Node {
+        size_t record; //!< Index of the record for leaf nodes; `npos` otherwise
+        size_t left; //!< Child node for `v . x <= a`
+        size_t right; //!< Child node for `v . x > a`
+        vector_fp v; //!< Normal vector of the cutting plane
+        double a; //!< Offset of the cutting plane
+    };
+
+    //! Objects used for direct integration by a single thread
+    struct Worker {
+        shared_ptr<Solution> sol;
+        unique_ptr<Reactor> reactor;
+        unique_ptr<ReactorNet> net;
+    };
+
+    //! Get a worker from the pool, creating a new one if none is available
+    unique_ptr<Worker> acquireWorker();
+
+    //! Return a worker to the pool
+    void releaseWorker(unique_ptr<Worker> w);
+
+    //! Integrate the scaled composition vector `x0` using worker `w`
+    void integrate(Worker& w, const double* x0, double* x1);
+
+    //! Find a record whose EOA contains `x`. Returns `npos` if there is none.
+    //! If `closest` is given, it is set to the record checked during the search
+    //! with the smallest value of the EOA quadratic form.
+    size_t retrieve(const double* x, size_t* closest=nullptr) const;
+
+    //! Insert record `r` into the binary tree
+    void insert(size_t r);
+
+    size_t m_nsp; //!< Number of species
+    size_t m_nv; //!< Length of the scaled composition vector
+    std::string m_reactorType;
+    shared_ptr<Solution> m_sol; //!< Template for the Solution objects of workers
+
+    double m_dt; //!< Time step [s]
+    double m_tol; //!< Error tolerance
+    double m_Tscale; //!< Temperature scale [K]
+    double m_Pscale; //!< Pressure scale [Pa]
+    double m_rtol; //!< Relative integration tolerance
+    double m_atol; //!< Absolute integration tolerance
+    size_t m_maxRecords; //!< Maximum number of records
+    size_t m_maxSearch; //!< Maximum number of records checked after the tree
+
+    //! Records of the table, in order of addition
+    std::vector<unique_ptr<Record>> m_records;
+
+    //! Nodes of the binary tree. Node 0 is the root.
+    std::vector<Node> m_nodes;
+
+    //! Lock protecting #m_records and #m_nodes
+    mutable std::shared_timed_mutex m_tableMutex;
+
+    //! Workers which are not currently in use
+    std::vector<unique_ptr<Worker>> m_pool;
+
+    //! Lock protecting #m_pool, #m_sol and the integrator tolerances
+    std::mutex m_poolMutex;
+
+    //! @name Statistics
+    //! @{
+    std::atomic<size_t> m_nQueries;
+    std::atomic<size_t> m_nRetrieves;
+    std::atomic<size_t> m_nGrows;
+    std::atomic<size_t> m_nAdds;
+    std::atomic<size_t> m_nDirect;
+    //! @}
+};
+
+}
+
+#endif
@@ -37,6 +37,8 @@ public:
     std::string componentName(size_t k);
 
 protected:
+    virtual void getProductionRateAdjoint(const double* lambda, double* mu);
+
     //! Get moles of the system from mass fractions stored by thermo object
     //! @param y vector for moles to be put into
     virtual void getMoles(double* y);
@@ -51,6 +53,16 @@ protected:
 
     virtual void getSurfaceInitialConditions(double* y);
 
+    //! Add Jacobian terms related to reactor surfaces, which are evaluated from
+    //! analytical derivatives of the surface net production rates with respect
+    //! to species concentrations. Terms related to the dependence of the
+    //! gas-phase concentrations on the reactor volume are neglected.
+    //! @param sidx  index of the first gas-phase species in the state vector,
+    //!     which is followed by the surface species
+    //! @param trips  triplets to which Jacobian elements are appended
+    void addSurfaceJacobian(size_t sidx,
+                            std::vector<Eigen::Triplet<double>>& trips);
+
     //! const value for the species start index
     const size_t m_sidx = 2;
 };
@@ -15,6 +15,7 @@ namespace Cantera
 
 class Solution;
 class AnyMap;
+class MechanismReducer;
 
 /**
  * Class Reactor is a general-purpose class for stirred reactors. The reactor
@@ -179,6 +180,44 @@ public:
     //! Use this to set the kinetics objects derivative settings
     virtual void setDerivativeSettings(AnyMap& settings);
 
+    //! Enable dynamic adaptive chemistry.
+    /*!
+     * The homogeneous reactions are periodically reduced to the set of
+     * reactions needed at the current state of the reactor using the DRGEP
+     * method (see MechanismReducer), and the reactor is integrated using only
+     * these reactions. The set of active reactions is updated by
+     * updateActiveReactions(), which is called by the ReactorNet during
+     * integration. While adaptive chemistry is enabled, the Kinetics object
+     * evaluates only the active reactions.
+     *
+     * @param targets  names of species which are retained in any case, for
+     *     example the fuel, the oxidizer and the major products
+     * @param threshold  minimum importance of retained species
+     * @param maxDeltaT  change in temperature [K] since the last update after
+     *     which the set of active reactions is updated
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    void setAdaptiveChemistry(const std::vector<std::string>& targets,
+                              double threshold=1e-3, double maxDeltaT=10.0);
+
+    //! Disable dynamic adaptive chemistry and restore all reactions
+    void clearAdaptiveChemistry();
+
+    //! Returns `true` if dynamic adaptive chemistry is enabled
+    bool adaptiveChemistryEnabled() const {
+        return !m_dacTargets.empty();
+    }
+
+    //! Number of active homogeneous reactions
+    size_t nActiveReactions() const;
+
+    //! Update the set of active reactions if the temperature has changed by
+    //! more than the limit set by setAdaptiveChemistry() since the last
+    //! update, or if *force* is `true`. Returns `true` if the set was updated.
+    virtual bool updateActiveReactions(bool force=false);
+
     //! Set reaction rate multipliers based on the sensitivity variables in
     //! *params*.
     virtual void applySensitivity(double* params);
@@ -186,7 +225,31 @@ public:
     //! Reset the reaction rate multipliers
     virtual void resetSensitivity(double* params);
 
+    //! Number of parameters used for adjoint sensitivity analysis, which are
+    //! the rate multipliers of all reactions of the homogeneous phase. Zero if
+    //! chemistry is disabled.
+    size_t nAdjointParams() const;
+
+    //! Evaluate the derivatives of the governing equations with respect to the
+    //! logarithms of the rate multipliers of all reactions of the homogeneous
+    //! phase, multiplied by the adjoint variables. Used by
+    //! ReactorNet::solveAdjoint(). The state of the reactor must have been
+    //! set by updateState().
+    //! @param[in] lambda  adjoint variables of this reactor, length neq()
+    //! @param[out] dfdp  products of the adjoint variables with the
+    //!     derivatives, length nAdjointParams()
+    void getAdjointParamDerivatives(const double* lambda, double* dfdp);
+
 protected:
+    //! Evaluate the derivatives of the time derivatives of the state variables
+    //! with respect to the net production rates of the homogeneous phase
+    //! species, multiplied by the adjoint variables. The time derivatives
+    //! depend linearly on the production rates, and implementations must match
+    //! the governing equations evaluated by eval().
+    //! @param[in] lambda  adjoint variables of this reactor, length neq()
+    //! @param[out] mu  length nSpecies()
+    virtual void getProductionRateAdjoint(const double* lambda, double* mu);
+
     //! Return the index in the solution vector for this reactor of the species
     //! named *nm*, in either the homogeneous phase or a surface phase, relative
     //! to the start of the species terms. Used to implement componentIndex for
@@ -247,6 +310,19 @@ protected:
 
     //! Vector of triplets representing the jacobian
     std::vector<Eigen::Triplet<double>> m_jac_trips;
+
+    //! Net stoichiometric coefficients of the homogeneous reactions, used by
+    //! getAdjointParamDerivatives()
+    Eigen::SparseMatrix<double> m_netStoich;
+
+    //! @name Dynamic adaptive chemistry
+    //! @{
+    std::vector<std::string> m_dacTargets; //!< Target species
+    double m_dacThreshold; //!< Minimum importance of retained species
+    double m_dacMaxDeltaT; //!< Temperature change triggering an update [K]
+    double m_dacT; //!< Temperature at the last update [K]
+    shared_ptr<MechanismReducer> m_reducer;
+    //! @}
 };
 }
 
@@ -0,0 +1,181 @@
+//! @file ReactorEnsemble.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORENSEMBLE_H
+#define CT_REACTORENSEMBLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+class Reactor;
+class ReactorNet;
+
+//! A set of independent reactors which are integrated in parallel.
+/*!
+ *  This class integrates the same reactor model for a number of different
+ *  initial states, for example to compute ignition delays over a range of
+ *  initial temperatures, pressures and compositions. The initial states are
+ *  distributed dynamically over a set of worker threads, each of which owns a
+ *  Solution, Reactor and ReactorNet object.
+ *
+ *  The Solution objects used by the workers are created from the Solution
+ *  object passed to the constructor using Solution::clone(), and share its
+ *  Species and Reaction objects rather than reading the input file again. The
+ *  state of the original Solution object is not modified.
+ *
+ *  Results are stored in contiguous arrays, with the data for each initial
+ *  state stored consecutively.
+ *
+ *  @warning  This class is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ *
+ * @ingroup ZeroD
+ */
+class ReactorEnsemble
+{
+public:
+    //! Create a reactor ensemble
+    /*!
+     *  @param sol  Solution object defining the mechanism. The phase must be an
+     *      ideal gas with a single-phase kinetics model.
+     *  @param reactorType  Type of reactor, as used by newReactor()
+     *  @param nThreads  Number of worker threads. If zero, the number of
+     *      concurrent threads supported by the hardware is used.
+     */
+    ReactorEnsemble(shared_ptr<Solution> sol,
+                    const std::string& reactorType="IdealGasConstPressureReactor",
+                    size_t nThreads=0);
+    ~ReactorEnsemble();
+    ReactorEnsemble(const ReactorEnsemble&) = delete;
+    ReactorEnsemble& operator=(const ReactorEnsemble&) = delete;
+
+    //! Number of worker threads
+    size_t nThreads() const {
+        return m_workers.size();
+    }
+
+    //! Number of species in the mechanism
+    size_t nSpecies() const {
+        return m_nsp;
+    }
+
+    //! Set the initial states of the reactors
+    /*!
+     *  @param nStates  Number of initial states
+     *  @param T  Temperatures [K]. Length: nStates
+     *  @param P  Pressures [Pa]. Length: nStates
+     *  @param Y  Mass fractions, with the mass fractions for each state stored
+     *      consecutively. Length: nStates * nSpecies()
+     */
+    void setInitialStates(size_t nStates, const double* T, const double* P,
+                          const double* Y);
+
+    //! Number of initial states
+    size_t nStates() const {
+        return m_T0.size();
+    }
+
+    //! Set the time [s] up to which each reactor is integrated
+    void setEndTime(double tEnd);
+
+    //! Set the relative and absolute integration tolerances
+    void setTolerances(double rtol, double atol);
+
+    //! Set the temperature rise [K] relative to the initial temperature which
+    //! is used to define the ignition delay. The default is 400 K.
+    void setIgnitionTemperatureRise(double deltaT);
+
+    //! Set the times [s] at which the state of each reactor is sampled. The
+    //! times must be increasing and may not exceed the end time.
+    void setOutputTimes(const vector_fp& times);
+
+    //! Number of sample times
+    size_t nOutputTimes() const {
+        return m_times.size();
+    }
+
+    //! Integrate all reactors from their initial states to the end time
+    void integrate();
+
+    //! Ignition delay [s] for each initial state, determined from the first
+    //! time where the temperature exceeds the initial temperature by the
+    //! specified rise. NaN if the reactor did not ignite before the end time.
+    const vector_fp& ignitionDelays() const {
+        return m_tig;
+    }
+
+    //! Temperature [K] of each reactor at the end time
+    const vector_fp& finalTemperatures() const {
+        return m_Tf;
+    }
+
+    //! Pressure [Pa] of each reactor at the end time
+    const vector_fp& finalPressures() const {
+        return m_Pf;
+    }
+
+    //! Mass fractions of each reactor at the end time. Length:
+    //! nStates() * nSpecies()
+    const vector_fp& finalMassFractions() const {
+        return m_Yf;
+    }
+
+    //! Temperatures [K] at the sample times. The entry for state `i` and
+    //! sample time `m` is at index `i * nOutputTimes() + m`.
+    const vector_fp& sampledTemperatures() const {
+        return m_Ts;
+    }
+
+    //! Pressures [Pa] at the sample times, stored like sampledTemperatures()
+    const vector_fp& sampledPressures() const {
+        return m_Ps;
+    }
+
+    //! Mass fractions at the sample times. The mass fraction of species `k`
+    //! for state `i` and sample time `m` is at index
+    //! `(i * nOutputTimes() + m) * nSpecies() + k`.
+    const vector_fp& sampledMassFractions() const {
+        return m_Ys;
+    }
+
+protected:
+    //! Objects used by a single worker thread
+    struct Worker {
+        shared_ptr<Solution> sol;
+        unique_ptr<Reactor> reactor;
+        unique_ptr<ReactorNet> net;
+    };
+
+    //! Integrate the reactor for initial state `i` using worker `w`
+    void run(Worker& w, size_t i);
+
+    size_t m_nsp; //!< Number of species
+    std::vector<Worker> m_workers;
+
+    double m_tEnd; //!< End time [s]
+    double m_rtol; //!< Relative integration tolerance
+    double m_atol; //!< Absolute integration tolerance
+    double m_deltaT; //!< Temperature rise used to define the ignition delay
+    vector_fp m_times; //!< Sample times [s]
+
+    //! Initial states
+    vector_fp m_T0, m_P0, m_Y0;
+
+    //! Ignition delays
+    vector_fp m_tig;
+
+    //! Final states
+    vector_fp m_Tf, m_Pf, m_Yf;
+
+    //! States at the sample times
+    vector_fp m_Ts, m_Ps, m_Ys;
+};
+
+}
+
+#endif
@@ -45,6 +45,49 @@ public:
     //! @param preconditioner preconditioner object used for the linear solver
     void setPreconditioner(shared_ptr<PreconditionerBase> preconditioner);
 
+    //! Use a preconditioner for the whole network, including the coupling
+    //! between reactors.
+    /*!
+     *  If `true`, the preconditioner set using setPreconditioner() is built
+     *  from the sparse finite difference Jacobian of the network computed by
+     *  evalSparseJacobian(). This Jacobian includes the blocks coupling
+     *  reactors connected by flow devices and walls, and is available for all
+     *  reactor types, including reactors with surfaces. If `false` (the
+     *  default), the preconditioner is built from the analytical Jacobians of
+     *  the individual reactors, see Reactor::jacobian().
+     */
+    void setCoupledPreconditioner(bool coupled);
+
+    //! Returns `true` if the preconditioner is built from the Jacobian of the
+    //! whole network. See setCoupledPreconditioner().
+    bool coupledPreconditioner() const {
+        return m_coupledPrecon;
+    }
+
+    //! Set the number of threads used to evaluate the governing equations of
+    //! the reactors.
+    /*!
+     *  After the states of all reactors have been updated, the governing
+     *  equations of the individual reactors only depend on their own state and
+     *  on properties of connected reactors that are stored by the reactors,
+     *  so they can be evaluated concurrently. This requires that each reactor
+     *  uses its own ThermoPhase and Kinetics objects. Functions used to set
+     *  the velocity of or heat flux through walls are also evaluated
+     *  concurrently, and must be safe to call from multiple threads. Reactors
+     *  implemented by delegating to external code (ReactorDelegator) cannot
+     *  be evaluated concurrently. The default is one thread.
+     *
+     *  @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    void setNumThreads(size_t nThreads);
+
+    //! Number of threads used to evaluate the governing equations of the
+    //! reactors
+    size_t numThreads() const {
+        return m_nthreads;
+    }
+
     //! Set initial time. Default = 0.0 s. Restarts integration from this time
     //! using the current mixture state as the initial condition.
     void setInitialTime(double time);
@@ -188,6 +231,90 @@ public:
     void evalJacobian(doublereal t, doublereal* y,
                       doublereal* ydot, doublereal* p, Array2D* j);
 
+    //! Evaluate the Jacobian matrix for the reactor network as a sparse
+    //! matrix.
+    /*!
+     *  The Jacobian consists of a dense block for each reactor, and of dense
+     *  blocks coupling each pair of reactors which are connected by a flow
+     *  device or a wall, or through the master flow controller of a
+     *  PressureController. Since the columns for reactors which are not
+     *  coupled to any common reactor have no nonzero rows in common, groups
+     *  of these reactors are perturbed at once. The number of evaluations of
+     *  the governing equations is the sum of the maximum number of state
+     *  variables of the reactors in each group (see nJacobianGroups()),
+     *  instead of the total number of state variables. The values are the
+     *  same as those computed by evalJacobian().
+     *
+     *  @param[in] t Time at which to evaluate the Jacobian
+     *  @param[in] y Global state vector at time *t*
+     *  @param[out] ydot Time derivative of the state vector evaluated at *t*.
+     *  @param[in] p sensitivity parameter vector
+     *  @param[out] jac Jacobian matrix, size neq() by neq(). All elements of
+     *      the sparsity pattern are stored, including those which are zero.
+     */
+    void evalSparseJacobian(double t, double* y, double* ydot, double* p,
+                            Eigen::SparseMatrix<double>& jac);
+
+    //! Number of groups of reactors which are perturbed together by
+    //! evalSparseJacobian()
+    size_t nJacobianGroups() {
+        if (!m_init) {
+            initialize();
+        }
+        return m_jacGroups.size();
+    }
+
+    //! Compute the gradient of a scalar output with respect to the rate
+    //! multipliers of all reactions using adjoint sensitivity analysis.
+    /*!
+     *  The network is integrated from the current time to `tf` while the
+     *  forward solution is checkpointed. The adjoint system is then
+     *  integrated backward to the initial time, together with quadratures
+     *  which yield the derivatives of the output with respect to the
+     *  logarithms of the rate multipliers of all reactions of the homogeneous
+     *  phases of all reactors. Unlike the forward sensitivities computed for
+     *  parameters added with Reactor::addSensitivityReaction(), the cost is
+     *  nearly independent of the number of reactions. Since a multiplier
+     *  scales the forward and reverse rate constants, the derivatives are
+     *  equal to those with respect to the logarithm of the pre-exponential
+     *  factor for reactions with Arrhenius rates. The derivatives are
+     *  available from adjointSensitivities().
+     *
+     *  The output is defined by `output`:
+     *  - `"final"`: the value of `component` at `tf`
+     *  - `"integral"`: the integral of `component` from the current time to
+     *    `tf`
+     *  - `"ignition"`: the time at which `component` first reaches the value
+     *    `threshold`, for example an ignition delay defined by a temperature
+     *    threshold. An exception is thrown if the value is not reached before
+     *    `tf`.
+     *
+     *  The adjoint system is solved using the sensitivity tolerances (see
+     *  setSensitivityTolerances()), with the adjoint variables scaled such that
+     *  they are of order one for an output of order one. Afterwards, the state
+     *  of the network corresponds to the time `tf`, or to the ignition time for
+     *  the `"ignition"` output, and integration restarts from this state. The
+     *  Jacobian of the network is evaluated using evalSparseJacobian().
+     *
+     *  @param tf  Final time [s]
+     *  @param output  Type of output
+     *  @param component  Name of the component defining the output
+     *  @param reactor  Index of the reactor containing `component`
+     *  @param threshold  Value of `component` defining the ignition time
+     *  @returns  Value of the output
+     *
+     *  @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    double solveAdjoint(double tf, const std::string& output,
+                        const std::string& component, size_t reactor=0,
+                        double threshold=0.0);
+
+    //! Derivatives of the output of the last call to solveAdjoint() with
+    //! respect to the logarithms of the rate multipliers of the reactions of
+    //! reactor `n`. Empty if chemistry is disabled for the reactor.
+    const vector_fp& adjointSensitivities(size_t n) const;
+
     // overloaded methods of class FuncEval
     virtual size_t neq() {
         return m_nv;
@@ -209,6 +336,17 @@ public:
         return m_sens_params.size();
     }
 
+    virtual void evalAdjoint(double t, double* y, double* yB, double* yBdot);
+
+    virtual void evalAdjointJacobian(double t, double* y, double* jac);
+
+    virtual void evalAdjointQuadrature(double t, double* y, double* yB,
+                                       double* qBdot);
+
+    virtual size_t nAdjointQuadratures() {
+        return m_adjStart.empty() ? 0 : m_adjStart.back();
+    }
+
     //! Return the index corresponding to the component named *component* in the
     //! reactor with index *reactor* in the global state vector for the
     //! reactor network.
@@ -283,6 +421,24 @@ public:
     //! @param settings the settings map propagated to all reactors and kinetics objects
     virtual void setDerivativeSettings(AnyMap& settings);
 
+    //! Set the number of integrator steps after which the sets of active
+    //! reactions of reactors using dynamic adaptive chemistry are updated, even
+    //! if the temperature has not changed significantly. The default is 20.
+    //! @see Reactor::setAdaptiveChemistry
+    void setAdaptiveChemistryInterval(size_t nSteps);
+
+    //! Times at which the sets of active reactions were updated during
+    //! integration
+    const vector_fp& adaptiveChemistryTimes() const {
+        return m_dacTimes;
+    }
+
+    //! Total number of active reactions of all reactors using dynamic adaptive
+    //! chemistry after each update listed in adaptiveChemistryTimes()
+    const std::vector<size_t>& adaptiveChemistryActiveReactions() const {
+        return m_dacActive;
+    }
+
 protected:
     //! Check if surfaces and preconditioning are included, if so throw an error because
     //! they are currently not supported.
@@ -301,6 +457,24 @@ protected:
     //! and deliberately not exposed in external interfaces.
     virtual int lastOrder();
 
+    //! Update the sets of active reactions of reactors using dynamic adaptive
+    //! chemistry before an integrator step, and record the number of active
+    //! reactions.
+    void updateActiveReactions();
+
+    //! Determine the reactors coupled to each reactor, and the groups of
+    //! reactors perturbed together by evalSparseJacobian()
+    void updateCoupling();
+
+    //! Check that the reactors can be evaluated concurrently
+    void checkThreadSafety();
+
+    //! Evaluate the Jacobian used by the adjoint system at the state `y`,
+    //! unless it has already been evaluated for this state
+    void updateAdjointJacobian(double t, double* y);
+
+    class EvalPool;
+
     std::vector<Reactor*> m_reactors;
     std::unique_ptr<Integrator> m_integ;
     doublereal m_time;
@@ -331,6 +505,56 @@ protected:
     //! "left hand side" of each governing equation
     vector_fp m_LHS;
     vector_fp m_RHS;
+
+    //! Time reached by the last integrator step, which may be later than
+    //! #m_time
+    double m_stepTime;
+
+    //! @name Dynamic adaptive chemistry
+    //! @{
+    size_t m_dacInterval; //!< Steps between forced updates
+    size_t m_dacSteps; //!< Steps since the last forced update
+    vector_fp m_dacTimes; //!< Times of updates
+    std::vector<size_t> m_dacActive; //!< Number of active reactions
+    //! @}
+
+    //! Indices of the reactors whose states affect the governing equations of
+    //! each reactor, including the reactor itself
+    std::vector<std::vector<size_t>> m_coupling;
+
+    //! Groups of reactors perturbed together by evalSparseJacobian()
+    std::vector<std::vector<size_t>> m_jacGroups;
+
+    //! Build the preconditioner from the Jacobian of the whole network
+    bool m_coupledPrecon;
+
+    //! Number of threads used by eval()
+    size_t m_nthreads;
+
+    //! Worker threads used by eval()
+    std::unique_ptr<EvalPool> m_pool;
+
+    //! @name Adjoint sensitivity analysis
+    //! @{
+
+    //! m_adjStart[n] is the index of the first quadrature of reactor n
+    std::vector<size_t> m_adjStart;
+
+    //! Index of the integrated component for the "integral" output of
+    //! solveAdjoint(), or `npos`
+    size_t m_adjIntegrand;
+
+    //! Scale of the adjoint variables
+    double m_adjScale;
+
+    Eigen::SparseMatrix<double> m_adjJac; //!< Jacobian of the network
+    double m_adjTime; //!< Time at which #m_adjJac was evaluated
+    vector_fp m_adjState; //!< State at which #m_adjJac was evaluated
+    vector_fp m_adjWork;
+
+    //! Derivatives computed by the last call to solveAdjoint()
+    std::vector<vector_fp> m_adjointSens;
+    //! @}
 };
 }
 
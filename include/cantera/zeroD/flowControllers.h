@@ -78,6 +78,11 @@ public:
         m_master = master;
     }
 
+    //! Return the master flow controller
+    FlowDevice* master() const {
+        return m_master;
+    }
+
     virtual void setTimeFunction(Func1* g) {
         throw NotImplementedError("PressureController::setTimeFunction");
     }
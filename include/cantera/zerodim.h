@@ -11,6 +11,8 @@
 
 // reactor network
 #include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/IsatTable.h"
 
 // reactors
 #include "cantera/zeroD/Reservoir.h"
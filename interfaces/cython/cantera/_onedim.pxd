@@ -80,6 +80,8 @@ cdef extern from "cantera/oneD/StFlow.h":
         void setPressure(double)
         void enableRadiation(cbool)
         cbool radiationEnabled()
+        void setAnalyticChemistryJacobian(cbool)
+        cbool analyticChemistryJacobian()
         double radiativeHeatLoss(size_t)
         double pressure()
         void setFixedTempProfile(vector[double]&, vector[double]&)
@@ -119,6 +121,7 @@ cdef extern from "cantera/oneD/Sim1D.h":
         int maxTimeStepCount()
         void getInitialSoln() except +translate_exception
         void solve(int, cbool) except +translate_exception
+        size_t solveContinuation(vector[double]&, CxxFunc1*, CxxFunc1*, int, cbool) except +translate_exception
         void refine(int) except +translate_exception
         void setRefineCriteria(size_t, double, double, double, double) except +translate_exception
         vector[double] getRefineCriteria(int) except +translate_exception
@@ -142,6 +145,8 @@ cdef extern from "cantera/oneD/Sim1D.h":
         void solveAdjoint(const double*, double*) except +translate_exception
         void getResidual(double, double*) except +translate_exception
         void setJacAge(int, int)
+        void setSparseJacobian(cbool) except +translate_exception
+        cbool sparseJacobian()
         void setTimeStepFactor(double)
         void setMinTimeStep(double)
         void setMaxTimeStep(double)
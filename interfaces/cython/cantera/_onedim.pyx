@@ -605,6 +605,21 @@ cdef class _FlowBase(Domain1D):
         def __set__(self, do_radiation):
             self.flow.enableRadiation(<cbool>do_radiation)
 
+    property analytic_chemistry_jacobian:
+        """
+        Determines whether the derivatives of the chemical source terms in the
+        Jacobian are evaluated analytically, rather than by finite differences.
+
+        .. warning::
+
+            This property is an experimental part of the Cantera API and
+            may be changed or removed without notice.
+        """
+        def __get__(self):
+            return self.flow.analyticChemistryJacobian()
+        def __set__(self, analytic):
+            self.flow.setAnalyticChemistryJacobian(<cbool>analytic)
+
     property radiative_heat_loss:
         """
         Return radiative heat loss (only non-zero if radiation is enabled).
@@ -1317,6 +1332,54 @@ cdef class Sim1D:
         if have_user_tolerances or solve_multi or soret_doms:
             self.sim.solve(loglevel, <cbool>refine_grid)
 
+    def solve_continuation(self, values, set_parameter, callback=None,
+                           loglevel=0, refine_grid=True):
+        """
+        Solve the problem for a sequence of values of a parameter, such as the
+        strain rate or the equivalence ratio. Each point is solved using the
+        previous solution as the initial guess. Instead of evaluating a new
+        Jacobian after each change of the parameter, the Newton iteration is
+        first attempted with the Jacobian of the previous solution, corrected
+        using Broyden updates. Returns the number of parameter values which were
+        solved without evaluating a new Jacobian before the first converged
+        solution.
+
+        :param values:
+            sequence of parameter values
+        :param set_parameter:
+            function ``f(value)`` which modifies the problem for the given
+            parameter value, for example by setting the inlet mass flux. The
+            parameter must not change the structure of the problem, such as
+            the set of enabled equations.
+        :param callback:
+            optional function ``f(value)`` called after the problem has been
+            solved for each parameter value, for example to store the solution
+        :param loglevel:
+            integer flag controlling the amount of diagnostic output
+        :param refine_grid:
+            if True, enable grid refinement
+
+        >>> f.solve_continuation(mdots, lambda m: setattr(f.fuel_inlet, 'mdot', m),
+        ...                      lambda m: states.append(f.to_solution_array()))
+        """
+        def wrap(f):
+            def g(value):
+                f(value)
+                return 0.0
+            return Func1(g)
+
+        if not self._initialized:
+            self.set_initial_guess()
+        setter = wrap(set_parameter)
+        cdef CxxFunc1* cxx_callback = NULL
+        if callback is not None:
+            callback = wrap(callback)
+            cxx_callback = (<Func1>callback).func
+        cdef vector[double] cxx_values = values
+        return self.sim.solveContinuation(cxx_values, (<Func1>setter).func,
+                                          cxx_callback, loglevel,
+                                          <cbool>refine_grid)
+
     def refine(self, loglevel=1):
         """
         Refine the grid, adding points where solution is not adequately
@@ -1393,6 +1456,16 @@ cdef class Sim1D:
         """
         self.sim.setJacAge(ss_age, ts_age)
 
+    property sparse_jacobian:
+        """
+        Get/Set whether the Jacobian is stored as a sparse matrix and factored
+        using a sparse LU decomposition instead of a banded LU decomposition.
+        """
+        def __get__(self):
+            return self.sim.sparseJacobian()
+        def __set__(self, sparse):
+            self.sim.setSparseJacobian(sparse)
+
     def set_time_step_factor(self, tfactor):
         """
         Set the factor by which the time step will be increased after a
@@ -1429,7 +1502,10 @@ cdef class Sim1D:
     def save(self, filename='soln.yaml', name='solution', description='none',
              loglevel=1):
         """
-        Save the solution in YAML format.
+        Save the solution in YAML format, or in a binary container format for
+        file names with the extension ``.ctsol``. Binary containers are
+        appended to in place and can be written and read much faster than YAML
+        files.
 
         :param filename:
             solution file
@@ -47,6 +47,8 @@ cdef extern from "cantera/kinetics/Kinetics.h" namespace "Cantera":
 
         double multiplier(int)
         void setMultiplier(int, double)
+        void setRateTabulation(double, double, double) except +translate_exception
+        void clearRateTabulation() except +translate_exception
 
         void getDerivativeSettings(CxxAnyMap&) except +translate_exception
         void setDerivativeSettings(CxxAnyMap&) except +translate_exception
@@ -214,6 +214,28 @@ cdef class Kinetics(_SolutionBase):
             self._check_reaction_index(i_reaction)
             self.kinetics.setMultiplier(i_reaction, value)
 
+    def set_rate_tabulation(self, double T_min, double T_max, double rtol=1e-6):
+        """
+        Evaluate rate constants by interpolation in tables of log(k) computed
+        for temperatures between ``T_min`` and ``T_max``, which are refined until
+        the relative interpolation error is less than ``rtol``. Applies to rate
+        types which depend on temperature alone, such as Arrhenius rates, and to
+        the temperature-dependent parts of falloff rates. Rate constants at
+        temperatures outside this range are evaluated directly.
+
+        .. versionadded:: 3.0
+        """
+        self.kinetics.setRateTabulation(T_min, T_max, rtol)
+
+    def clear_rate_tabulation(self):
+        """
+        Evaluate all rate constants directly. Undoes the effect of
+        `set_rate_tabulation`.
+
+        .. versionadded:: 3.0
+        """
+        self.kinetics.clearRateTabulation()
+
     def reaction_equations(self, indices=None):
         """
         Returns a list containing the reaction equation for all reactions in the
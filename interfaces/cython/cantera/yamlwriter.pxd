@@ -15,6 +15,7 @@ cdef extern from "cantera/base/YamlWriter.h" namespace "Cantera":
         void addPhase(shared_ptr[CxxSolution]) except +translate_exception
         string toYamlString() except +translate_exception
         void toYamlFile(string&) except +translate_exception
+        void toBinaryFile(string&) except +translate_exception
         void setPrecision(int)
         void skipUserDefined(cbool)
         void setUnitSystem(CxxUnitSystem&) except +translate_exception
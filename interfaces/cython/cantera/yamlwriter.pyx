@@ -27,6 +27,17 @@ cdef class YamlWriter:
         """
         self.writer.toYamlFile(stringify(filename))
 
+    def to_binary_file(self, filename):
+        """
+        Write the definitions for the added phases, species and reactions to
+        the specified file in a binary format, with all values in SI units. The
+        file can be used in place of a YAML input file and is loaded without
+        parsing YAML. The `precision` and `output_units` settings are ignored.
+
+        .. versionadded:: 3.0
+        """
+        self.writer.toBinaryFile(stringify(filename))
+
     def to_string(self):
         """
         Return a YAML string that contains the definitions for the added phases,
@@ -10,6 +10,7 @@
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 #include <boost/algorithm/string.hpp>
+#include <cstring>
 #include <fstream>
 #include <mutex>
 #include <unordered_set>
@@ -1724,6 +1725,298 @@ void AnyMap::clearCachedFile(const std::string& filename)
     }
 }
 
+namespace { // binary serialization helpers
+
+// Identifies files generated by AnyMap::toBinaryString(). The last character
+// is the format version.
+const char binaryMagic[8] = {'C', 'T', 'M', 'E', 'C', 'H', '\0', '\1'};
+
+// Tags identifying the type of each serialized value
+enum BinaryTag : uint8_t {
+    tagEmpty, tagDouble, tagLong, tagBool, tagString, tagMap,
+    tagVecDouble, tagVecLong, tagVecBool, tagVecString, tagVecMap, tagVecAny,
+    tagVec2Double, tagVec2Long, tagVec2Bool, tagVec2String
+};
+
+class BinaryWriter
+{
+public:
+    explicit BinaryWriter(std::string& out) : m_out(out) {}
+
+    template <class T>
+    void put(T value) {
+        m_out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    void putSize(size_t n) {
+        put<uint64_t>(n);
+    }
+    void putString(const std::string& s) {
+        putSize(s.size());
+        m_out.append(s);
+    }
+
+    void write(const AnyMap& m) {
+        if (m.units().getDelta(UnitSystem()).size()) {
+            throw CanteraError("AnyMap::toBinaryString", "Maps using non-default "
+                "units cannot be serialized. The unit system is:\n{}",
+                m.units().getDelta(UnitSystem()).toYamlString());
+        }
+        size_t n = 0;
+        for (auto iter = m.begin(); iter != m.end(); ++iter) {
+            n++;
+        }
+        putSize(n);
+        for (const auto& item : m) {
+            putString(item.first);
+            write(item.second);
+        }
+    }
+
+    void write(const AnyValue& v) {
+        if (v.empty()) {
+            put(tagEmpty);
+        } else if (v.is<double>()) {
+            put(tagDouble);
+            put(v.as<double>());
+        } else if (v.is<long int>()) {
+            put(tagLong);
+            put<int64_t>(v.as<long int>());
+        } else if (v.is<bool>()) {
+            put(tagBool);
+            put<uint8_t>(v.as<bool>());
+        } else if (v.is<string>()) {
+            put(tagString);
+            putString(v.asString());
+        } else if (v.is<AnyMap>()) {
+            put(tagMap);
+            write(v.as<AnyMap>());
+        } else if (v.is<vector<double>>()) {
+            put(tagVecDouble);
+            write(v.as<vector<double>>());
+        } else if (v.is<vector<long int>>()) {
+            put(tagVecLong);
+            write(v.as<vector<long int>>());
+        } else if (v.is<vector<bool>>()) {
+            put(tagVecBool);
+            write(v.as<vector<bool>>());
+        } else if (v.is<vector<string>>()) {
+            put(tagVecString);
+            write(v.as<vector<string>>());
+        } else if (v.is<vector<AnyMap>>()) {
+            put(tagVecMap);
+            write(v.as<vector<AnyMap>>());
+        } else if (v.is<vector<AnyValue>>()) {
+            put(tagVecAny);
+            write(v.as<vector<AnyValue>>());
+        } else if (v.is<vector<vector<double>>>()) {
+            put(tagVec2Double);
+            write(v.as<vector<vector<double>>>());
+        } else if (v.is<vector<vector<long int>>>()) {
+            put(tagVec2Long);
+            write(v.as<vector<vector<long int>>>());
+        } else if (v.is<vector<vector<bool>>>()) {
+            put(tagVec2Bool);
+            write(v.as<vector<vector<bool>>>());
+        } else if (v.is<vector<vector<string>>>()) {
+            put(tagVec2String);
+            write(v.as<vector<vector<string>>>());
+        } else {
+            throw CanteraError("AnyMap::toBinaryString",
+                "Don't know how to serialize value of type '{}'", v.type_str());
+        }
+    }
+
+    void write(const vector<double>& v) {
+        // Stored as a contiguous block which is copied directly on input
+        putSize(v.size());
+        m_out.append(reinterpret_cast<const char*>(v.data()),
+                     v.size() * sizeof(double));
+    }
+    void write(const vector<long int>& v) {
+        putSize(v.size());
+        for (long int x : v) {
+            put<int64_t>(x);
+        }
+    }
+    void write(const vector<bool>& v) {
+        putSize(v.size());
+        for (bool x : v) {
+            put<uint8_t>(x);
+        }
+    }
+    void write(const vector<string>& v) {
+        putSize(v.size());
+        for (const auto& x : v) {
+            putString(x);
+        }
+    }
+    template <class T>
+    void write(const vector<T>& v) {
+        putSize(v.size());
+        for (const auto& x : v) {
+            write(x);
+        }
+    }
+
+private:
+    std::string& m_out;
+};
+
+class BinaryReader
+{
+public:
+    BinaryReader(const char* data, size_t size)
+        : m_pos(data), m_end(data + size) {}
+
+    template <class T>
+    T get() {
+        T value;
+        require(sizeof(T));
+        std::memcpy(&value, m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+    size_t getSize() {
+        uint64_t n = get<uint64_t>();
+        // Every element occupies at least one byte, which guards against
+        // huge allocations from corrupted input
+        require(n);
+        return static_cast<size_t>(n);
+    }
+    std::string getString() {
+        size_t n = getSize();
+        std::string s(m_pos, n);
+        m_pos += n;
+        return s;
+    }
+
+    void read(AnyMap& m) {
+        size_t n = getSize();
+        for (size_t i = 0; i < n; i++) {
+            std::string key = getString();
+            read(m[key]);
+        }
+    }
+
+    void read(AnyValue& v) {
+        uint8_t tag = get<uint8_t>();
+        switch (tag) {
+        case tagEmpty:
+            break;
+        case tagDouble:
+            v = get<double>();
+            break;
+        case tagLong:
+            v = static_cast<long int>(get<int64_t>());
+            break;
+        case tagBool:
+            v = (get<uint8_t>() != 0);
+            break;
+        case tagString:
+            v = getString();
+            break;
+        case tagMap:
+            v = AnyMap();
+            read(v.as<AnyMap>());
+            break;
+        case tagVecDouble:
+            readVector<double>(v);
+            break;
+        case tagVecLong:
+            readVector<long int>(v);
+            break;
+        case tagVecBool:
+            readVector<bool>(v);
+            break;
+        case tagVecString:
+            readVector<string>(v);
+            break;
+        case tagVecMap:
+            readVector<AnyMap>(v);
+            break;
+        case tagVecAny:
+            readVector<AnyValue>(v);
+            break;
+        case tagVec2Double:
+            readVector<vector<double>>(v);
+            break;
+        case tagVec2Long:
+            readVector<vector<long int>>(v);
+            break;
+        case tagVec2Bool:
+            readVector<vector<bool>>(v);
+            break;
+        case tagVec2String:
+            readVector<vector<string>>(v);
+            break;
+        default:
+            throw CanteraError("AnyMap::fromBinaryString",
+                "Invalid type tag ({}) in binary input", tag);
+        }
+    }
+
+    void read(double& x) {
+        x = get<double>();
+    }
+    void read(long int& x) {
+        x = static_cast<long int>(get<int64_t>());
+    }
+    void read(string& x) {
+        x = getString();
+    }
+    void read(vector<double>& v) {
+        size_t n = getSize();
+        require(n * sizeof(double));
+        v.resize(n);
+        std::memcpy(v.data(), m_pos, n * sizeof(double));
+        m_pos += n * sizeof(double);
+    }
+    void read(vector<bool>& v) {
+        size_t n = getSize();
+        v.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            v[i] = (get<uint8_t>() != 0);
+        }
+    }
+    template <class T>
+    void read(vector<T>& v) {
+        size_t n = getSize();
+        v.resize(n);
+        for (auto& x : v) {
+            read(x);
+        }
+    }
+
+    template <class T>
+    void readVector(AnyValue& v) {
+        v = vector<T>();
+        read(v.as<vector<T>>());
+    }
+
+    bool done() const {
+        return m_pos == m_end;
+    }
+
+private:
+    void require(size_t n) const {
+        if (n > static_cast<size_t>(m_end - m_pos)) {
+            throw CanteraError("AnyMap::fromBinaryString",
+                               "Unexpected end of binary input");
+        }
+    }
+
+    const char* m_pos;
+    const char* m_end;
+};
+
+bool isBinaryInput(const std::string& data)
+{
+    return data.size() >= sizeof(binaryMagic)
+        && std::equal(binaryMagic, binaryMagic + sizeof(binaryMagic), data.begin());
+}
+
+} // end anonymous namespace
+
 AnyMap AnyMap::fromYamlString(const std::string& yaml) {
     AnyMap amap;
     try {
@@ -1775,10 +2068,22 @@ AnyMap AnyMap::fromYamlFile(const std::string& name,
     auto& cache_item = s_cache[fullName];
     cache_item.second = mtime;
     try {
-        YAML::Node node = YAML::LoadFile(fullName);
-        cache_item.first = node.as<AnyMap>();
-        cache_item.first.setMetadata("filename", AnyValue(fullName));
-        cache_item.first.applyUnits();
+        std::ifstream infile(fullName, std::ios::binary);
+        char magic[sizeof(binaryMagic)] = {};
+        infile.read(magic, sizeof(binaryMagic));
+        if (infile && std::equal(magic, magic + sizeof(magic), binaryMagic)) {
+            // Pre-processed binary input, with all values already in SI units
+            std::string data(magic, sizeof(magic));
+            data.append(std::istreambuf_iterator<char>(infile),
+                        std::istreambuf_iterator<char>());
+            cache_item.first = fromBinaryString(data);
+            cache_item.first.setMetadata("filename", AnyValue(fullName));
+        } else {
+            YAML::Node node = YAML::LoadFile(fullName);
+            cache_item.first = node.as<AnyMap>();
+            cache_item.first.setMetadata("filename", AnyValue(fullName));
+            cache_item.first.applyUnits();
+        }
     } catch (YAML::Exception& err) {
         s_cache.erase(fullName);
         AnyMap fake;
@@ -1808,6 +2113,34 @@ std::string AnyMap::toYamlString() const
     return out.c_str();
 }
 
+AnyMap AnyMap::fromBinaryString(const std::string& data)
+{
+    if (!isBinaryInput(data)) {
+        throw CanteraError("AnyMap::fromBinaryString",
+                           "Input is not in the binary AnyMap format.");
+    }
+    BinaryReader reader(data.data() + sizeof(binaryMagic),
+                        data.size() - sizeof(binaryMagic));
+    AnyMap amap;
+    reader.read(amap);
+    if (!reader.done()) {
+        throw CanteraError("AnyMap::fromBinaryString",
+                           "Unexpected data after end of binary input");
+    }
+    // Binary input has no line information which could be shown in error messages
+    amap.setMetadata("file-contents", AnyValue(""));
+    return amap;
+}
+
+std::string AnyMap::toBinaryString() const
+{
+    const_cast<AnyMap*>(this)->applyUnits();
+    std::string out(binaryMagic, sizeof(binaryMagic));
+    BinaryWriter writer(out);
+    writer.write(*this);
+    return out;
+}
+
 AnyMap::Iterator begin(const AnyValue& v) {
     return v.as<AnyMap>().begin();
 }
@@ -10,6 +10,8 @@
 #include "cantera/base/Interface.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/VPStandardStateTP.h"
+#include "cantera/thermo/Species.h"
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/kinetics/KineticsFactory.h"
 #include "cantera/transport/Transport.h"
@@ -21,6 +23,71 @@ namespace Cantera
 
 Solution::Solution() {}
 
+shared_ptr<Solution> Solution::clone()
+{
+    if (!m_thermo) {
+        throw CanteraError("Solution::clone",
+                           "Requires associated 'ThermoPhase'");
+    }
+    if (dynamic_cast<VPStandardStateTP*>(m_thermo.get())) {
+        throw NotImplementedError("Solution::clone",
+            "Not implemented for phase type '{}'.", m_thermo->type());
+    }
+
+    // Create a phase sharing the Species objects of this phase
+    auto thermo = newThermo(m_thermo->type());
+    thermo->setName(m_thermo->name());
+    for (size_t m = 0; m < m_thermo->nElements(); m++) {
+        thermo->addElement(m_thermo->elementName(m), m_thermo->atomicWeight(m),
+                           m_thermo->atomicNumber(m),
+                           m_thermo->entropyElement298(m),
+                           m_thermo->elementType(m));
+    }
+    for (size_t k = 0; k < m_thermo->nSpecies(); k++) {
+        thermo->addSpecies(m_thermo->species(k));
+    }
+    thermo->setParameters(m_thermo->input());
+    thermo->initThermo();
+    vector_fp state;
+    m_thermo->saveState(state);
+    thermo->restoreState(state);
+
+    auto sol = create();
+    sol->setThermo(thermo);
+    sol->m_header = m_header;
+    for (auto& adj : m_adjacent) {
+        sol->addAdjacent(adj->clone());
+    }
+
+    if (m_kinetics) {
+        // Phases participating in the reactions, in the same order as in the
+        // original Kinetics object
+        std::vector<ThermoPhase*> phases;
+        for (size_t n = 0; n < m_kinetics->nPhases(); n++) {
+            const std::string& phaseName = m_kinetics->thermo(n).name();
+            if (phaseName == m_thermo->name()) {
+                phases.push_back(thermo.get());
+            } else {
+                phases.push_back(sol->adjacent(phaseName)->thermo().get());
+            }
+        }
+
+        // The copy shares the Reaction objects, and has its own copies of the
+        // rate evaluators
+        sol->setKinetics(m_kinetics->clone(phases));
+    }
+
+    if (m_transport) {
+        // Copy the fitted transport properties if possible
+        try {
+            sol->setTransport(m_transport->clone(thermo.get()));
+        } catch (NotImplementedError&) {
+            sol->setTransportModel(m_transport->transportModel());
+        }
+    }
+    return sol;
+}
+
 std::string Solution::name() const {
     if (m_thermo) {
         return m_thermo->name();
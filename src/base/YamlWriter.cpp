@@ -59,7 +59,7 @@ void YamlWriter::addPhase(shared_ptr<ThermoPhase> thermo,
     addPhase(soln);
 }
 
-std::string YamlWriter::toYamlString() const
+AnyMap YamlWriter::buildOutput() const
 {
     AnyMap output;
     bool hasDescription = m_header.hasKey("description");
@@ -189,6 +189,12 @@ std::string YamlWriter::toYamlString() const
         }
     }
 
+    return output;
+}
+
+std::string YamlWriter::toYamlString() const
+{
+    AnyMap output = buildOutput();
     output.setMetadata("precision", AnyValue(m_float_precision));
     output.setUnits(m_output_units);
     return output.toYamlString();
@@ -200,6 +206,19 @@ void YamlWriter::toYamlFile(const std::string& filename) const
     out << toYamlString();
 }
 
+std::string YamlWriter::toBinaryString() const
+{
+    // Values are always stored in the default unit system, so no conversions
+    // are needed when the file is loaded
+    return buildOutput().toBinaryString();
+}
+
+void YamlWriter::toBinaryFile(const std::string& filename) const
+{
+    std::ofstream out(filename, std::ios::binary);
+    out << toBinaryString();
+}
+
 void YamlWriter::setUnits(const std::map<std::string, std::string>& units)
 {
     m_output_units = UnitSystem();
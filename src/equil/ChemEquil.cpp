@@ -317,9 +317,6 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XY, int loglevel)
 int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                            vector_fp& elMolesGoal, int loglevel)
 {
-    int fail = 0;
-    bool tempFixed = true;
-    int XY = _equilflag(XYstr);
     vector_fp state;
     s.saveState(state);
     m_loglevel = loglevel;
@@ -332,66 +329,13 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
 
     initialize(s);
     update(s);
-    switch (XY) {
-    case TP:
-    case PT:
-        m_p1 = [](ThermoPhase& s) { return s.temperature(); };
-        m_p2 = [](ThermoPhase& s) { return s.pressure(); };
-        break;
-    case HP:
-    case PH:
-        tempFixed = false;
-        m_p1 = [](ThermoPhase& s) { return s.enthalpy_mass(); };
-        m_p2 = [](ThermoPhase& s) { return s.pressure(); };
-        break;
-    case SP:
-    case PS:
-        tempFixed = false;
-        m_p1 = [](ThermoPhase& s) { return s.entropy_mass(); };
-        m_p2 = [](ThermoPhase& s) { return s.pressure(); };
-        break;
-    case SV:
-    case VS:
-        tempFixed = false;
-        m_p1 = [](ThermoPhase& s) { return s.entropy_mass(); };
-        m_p2 = [](ThermoPhase& s) { return s.density(); };
-        break;
-    case TV:
-    case VT:
-        m_p1 = [](ThermoPhase& s) { return s.temperature(); };
-        m_p2 = [](ThermoPhase& s) { return s.density(); };
-        break;
-    case UV:
-    case VU:
-        tempFixed = false;
-        m_p1 = [](ThermoPhase& s) { return s.intEnergy_mass(); };
-        m_p2 = [](ThermoPhase& s) { return s.density(); };
-        break;
-    default:
-        throw CanteraError("ChemEquil::equilibrate",
-                           "illegal property pair '{}'", XYstr);
-    }
-    // If the temperature is one of the specified variables, and
-    // it is outside the valid range, throw an exception.
-    if (tempFixed) {
-        double tfixed = s.temperature();
-        if (tfixed > s.maxTemp() + 1.0 || tfixed < s.minTemp() - 1.0) {
-            throw CanteraError("ChemEquil::equilibrate", "Specified temperature"
-                               " ({} K) outside valid range of {} K to {} K\n",
-                               s.temperature(), s.minTemp(), s.maxTemp());
-        }
-    }
+    bool tempFixed = setPropertyPair(s, XYstr);
 
     // Before we do anything to change the ThermoPhase object, we calculate and
     // store the two specified thermodynamic properties that we are after.
     double xval = m_p1(s);
     double yval = m_p2(s);
-
-    size_t mm = m_mm;
-    size_t nvar = mm + 1;
-    DenseMatrix jac(nvar, nvar); // Jacobian
-    vector_fp x(nvar, -102.0); // solution vector
-    vector_fp res_trial(nvar, 0.0); // residual
+    vector_fp x(m_mm + 1, -102.0); // solution vector
 
     // Replace one of the element abundance fraction equations with the
     // specified property calculation.
@@ -519,6 +463,113 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
 
     // Install the log(temp) into the last solution unknown slot.
     x[m_mm] = log(s.temperature());
+    return iterate(s, x, elMolesGoal, xval, yval, state, loglevel);
+}
+
+bool ChemEquil::setPropertyPair(ThermoPhase& s, const char* XYstr)
+{
+    bool tempFixed = true;
+    int XY = _equilflag(XYstr);
+    switch (XY) {
+    case TP:
+    case PT:
+        m_p1 = [](ThermoPhase& s) { return s.temperature(); };
+        m_p2 = [](ThermoPhase& s) { return s.pressure(); };
+        break;
+    case HP:
+    case PH:
+        tempFixed = false;
+        m_p1 = [](ThermoPhase& s) { return s.enthalpy_mass(); };
+        m_p2 = [](ThermoPhase& s) { return s.pressure(); };
+        break;
+    case SP:
+    case PS:
+        tempFixed = false;
+        m_p1 = [](ThermoPhase& s) { return s.entropy_mass(); };
+        m_p2 = [](ThermoPhase& s) { return s.pressure(); };
+        break;
+    case SV:
+    case VS:
+        tempFixed = false;
+        m_p1 = [](ThermoPhase& s) { return s.entropy_mass(); };
+        m_p2 = [](ThermoPhase& s) { return s.density(); };
+        break;
+    case TV:
+    case VT:
+        m_p1 = [](ThermoPhase& s) { return s.temperature(); };
+        m_p2 = [](ThermoPhase& s) { return s.density(); };
+        break;
+    case UV:
+    case VU:
+        tempFixed = false;
+        m_p1 = [](ThermoPhase& s) { return s.intEnergy_mass(); };
+        m_p2 = [](ThermoPhase& s) { return s.density(); };
+        break;
+    default:
+        throw CanteraError("ChemEquil::equilibrate",
+                           "illegal property pair '{}'", XYstr);
+    }
+    // If the temperature is one of the specified variables, and
+    // it is outside the valid range, throw an exception.
+    if (tempFixed) {
+        double tfixed = s.temperature();
+        if (tfixed > s.maxTemp() + 1.0 || tfixed < s.minTemp() - 1.0) {
+            throw CanteraError("ChemEquil::equilibrate", "Specified temperature"
+                               " ({} K) outside valid range of {} K to {} K\n",
+                               s.temperature(), s.minTemp(), s.maxTemp());
+        }
+    }
+    return tempFixed;
+}
+
+int ChemEquil::equilibrateFrom(ThermoPhase& s, const char* XYstr,
+                               vector_fp& x, int loglevel)
+{
+    if (m_x.size() != s.nElements() + 1 || m_kk != s.nSpecies()) {
+        throw CanteraError("ChemEquil::equilibrateFrom",
+            "No previous solution for a phase with the same species and "
+            "elements.");
+    }
+    if (x.size() != m_mm + 1) {
+        throw CanteraError("ChemEquil::equilibrateFrom",
+            "Starting estimate has length {}; {} expected.", x.size(), m_mm + 1);
+    }
+    vector_fp state;
+    s.saveState(state);
+    m_loglevel = loglevel;
+    update(s);
+    vector_fp elMolesGoal = m_elementmolefracs;
+    bool tempFixed = setPropertyPair(s, XYstr);
+    double xval = m_p1(s);
+    double yval = m_p2(s);
+
+    // Choose the replaced element equation in the same way as equilibrate()
+    double tmp = -1.0;
+    for (size_t m = 0; m < m_mm; m++) {
+        if (elMolesGoal[m] > tmp) {
+            m_skip = m;
+            tmp = elMolesGoal[m];
+        }
+    }
+    if (tmp <= 0.0) {
+        throw CanteraError("ChemEquil::equilibrateFrom",
+                           "Element Abundance Vector is zeroed");
+    }
+    if (tempFixed) {
+        x[m_mm] = log(s.temperature());
+    }
+    return iterate(s, x, elMolesGoal, xval, yval, state, loglevel);
+}
+
+int ChemEquil::iterate(ThermoPhase& s, vector_fp& x, vector_fp& elMolesGoal,
+                       double xval, double yval, const vector_fp& state,
+                       int loglevel)
+{
+    int fail = 0;
+    size_t mm = m_mm;
+    size_t nvar = mm + 1;
+    DenseMatrix jac(nvar, nvar); // Jacobian
+    vector_fp res_trial(nvar, 0.0); // residual
 
     // Setting the max and min values for x[]. Also, if element abundance vector
     // is zero, setting x[] to -1000. This effectively zeroes out all species
@@ -579,6 +630,7 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         if (iter > 0 && passThis && fabs(deltax) < options.relTolerance
                 && fabs(deltay) < options.relTolerance) {
             options.iterations = iter;
+            m_x = x;
 
             if (m_eloc != npos) {
                 adjustEloc(s, elMolesGoal);
@@ -627,7 +679,7 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
 
         // Solve the system
         try {
-            info = solve(jac, res_trial.data());
+            solve(jac, res_trial.data());
         } catch (CanteraError& err) {
             s.restoreState(state);
             throw CanteraError("ChemEquil::equilibrate",
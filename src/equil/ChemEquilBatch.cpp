@@ -0,0 +1,230 @@
+//! @file ChemEquilBatch.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/equil/ChemEquilBatch.h"
+#include "cantera/equil/ChemEquil.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/global.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace Cantera
+{
+
+ChemEquilBatch::ChemEquilBatch(shared_ptr<Solution> sol, size_t nThreads)
+    : m_nsp(sol->thermo()->nSpecies())
+    , m_nel(sol->thermo()->nElements())
+    , m_chunkSize(256)
+    , m_rtol(1.0e-9)
+    , m_nWarm(0)
+    , m_nCold(0)
+    , m_nFailedWarm(0)
+{
+    if (!sol->thermo()->isIdeal() || sol->thermo()->nDim() != 3) {
+        throw CanteraError("ChemEquilBatch::ChemEquilBatch",
+            "Phase '{}' of type '{}' is not supported; an ideal gas is required.",
+            sol->thermo()->name(), sol->thermo()->type());
+    }
+    if (nThreads == 0) {
+        nThreads = std::max(thread::hardware_concurrency(), 1u);
+    }
+
+    // All objects are created here, before any worker threads are started
+    m_workers.resize(nThreads);
+    for (auto& w : m_workers) {
+        w.sol = sol->clone();
+        w.equil.reset(new ChemEquil());
+    }
+}
+
+ChemEquilBatch::~ChemEquilBatch()
+{
+}
+
+void ChemEquilBatch::setStates(size_t nStates, const double* T,
+                               const double* P, const double* Y)
+{
+    m_T0.assign(T, T + nStates);
+    m_P0.assign(P, P + nStates);
+    m_Y0.assign(Y, Y + nStates * m_nsp);
+}
+
+void ChemEquilBatch::setChunkSize(size_t n)
+{
+    if (n == 0) {
+        throw CanteraError("ChemEquilBatch::setChunkSize",
+                           "Chunk size must be positive.");
+    }
+    m_chunkSize = n;
+}
+
+void ChemEquilBatch::setTolerance(double rtol)
+{
+    m_rtol = rtol;
+}
+
+void ChemEquilBatch::equilibrate(const string& XY)
+{
+    _equilflag(XY.c_str()); // check the property pair before starting
+    size_t nStates = m_T0.size();
+    size_t nChunks = (nStates + m_chunkSize - 1) / m_chunkSize;
+    m_T.assign(nStates, 0.0);
+    m_P.assign(nStates, 0.0);
+    m_Y.assign(nStates * m_nsp, 0.0);
+    for (auto& w : m_workers) {
+        w.nWarm = 0;
+        w.nCold = 0;
+        w.nFailedWarm = 0;
+        w.equil->options.relTolerance = m_rtol;
+    }
+
+    // Each worker takes the next chunk which has not been started yet
+    std::atomic<size_t> next(0);
+    std::exception_ptr error;
+    size_t errorChunk = npos;
+    std::mutex errorMutex;
+    auto work = [&](Worker& w) {
+        for (size_t c = next++; c < nChunks; c = next++) {
+            try {
+                run(w, c, XY);
+            } catch (...) {
+                std::unique_lock<std::mutex> lock(errorMutex);
+                if (c < errorChunk) {
+                    errorChunk = c;
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t n = 1; n < m_workers.size(); n++) {
+        threads.emplace_back([&work, &w=m_workers[n]]() {
+            work(w);
+            thread_complete();
+        });
+    }
+    work(m_workers[0]);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    m_nWarm = 0;
+    m_nCold = 0;
+    m_nFailedWarm = 0;
+    for (auto& w : m_workers) {
+        m_nWarm += w.nWarm;
+        m_nCold += w.nCold;
+        m_nFailedWarm += w.nFailedWarm;
+    }
+
+    if (error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (std::exception& err) {
+            throw CanteraError("ChemEquilBatch::equilibrate",
+                "Equilibrium calculation failed for states {} to {}:\n{}",
+                errorChunk * m_chunkSize,
+                std::min((errorChunk + 1) * m_chunkSize, nStates) - 1,
+                err.what());
+        }
+    }
+}
+
+void ChemEquilBatch::run(Worker& w, size_t c, const string& XY)
+{
+    auto thermo = w.sol->thermo();
+    ChemEquil& equil = *w.equil;
+    size_t nf = m_nel + 2; // number of features of each state
+    size_t nx = m_nel + 1; // length of the solution vector
+    size_t iStart = c * m_chunkSize;
+    size_t iEnd = std::min(iStart + m_chunkSize, m_T0.size());
+    w.features.clear();
+    w.solutions.clear();
+    vector_fp f(nf);
+    vector_fp x(nx);
+
+    for (size_t i = iStart; i < iEnd; i++) {
+        thermo->setState_TPY(m_T0[i], m_P0[i], &m_Y0[i * m_nsp]);
+
+        // Features used to find the nearest solved state: log(T), log(P) and
+        // the elemental mole fractions
+        f[0] = log(m_T0[i]);
+        f[1] = log(m_P0[i]);
+        double sum = 0.0;
+        for (size_t m = 0; m < m_nel; m++) {
+            f[m+2] = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                f[m+2] += thermo->nAtoms(k, m) * thermo->moleFraction(k);
+            }
+            sum += f[m+2];
+        }
+        for (size_t m = 0; m < m_nel; m++) {
+            f[m+2] /= sum;
+        }
+
+        size_t jBest = npos;
+        double dBest = BigNumber;
+        for (size_t j = 0; j < w.solutions.size() / nx; j++) {
+            double d = 0.0;
+            for (size_t n = 0; n < nf; n++) {
+                d += pow(f[n] - w.features[j * nf + n], 2);
+            }
+            if (d < dBest) {
+                dBest = d;
+                jBest = j;
+            }
+        }
+
+        bool solved = false;
+        if (jBest != npos) {
+            x.assign(&w.solutions[jBest * nx], &w.solutions[(jBest + 1) * nx]);
+            // Starting close to the solution, a converging iteration needs
+            // few steps; otherwise, a cold start is more reliable.
+            equil.options.maxIterations = 100;
+            try {
+                solved = (equil.equilibrateFrom(*thermo, XY.c_str(), x) == 0);
+            } catch (CanteraError&) {
+                thermo->setState_TPY(m_T0[i], m_P0[i], &m_Y0[i * m_nsp]);
+            }
+            if (solved) {
+                w.nWarm++;
+            } else {
+                w.nFailedWarm++;
+            }
+        }
+
+        if (!solved) {
+            // Use the same settings as ThermoPhase::equilibrate
+            w.nCold++;
+            equil.options.maxIterations = 50000;
+            try {
+                solved = (equil.equilibrate(*thermo, XY.c_str()) == 0);
+                x = equil.solution();
+            } catch (CanteraError&) {
+                thermo->setState_TPY(m_T0[i], m_P0[i], &m_Y0[i * m_nsp]);
+            }
+            if (!solved) {
+                thermo->equilibrate(XY, "vcs", m_rtol);
+            }
+        }
+
+        if (solved) {
+            w.features.insert(w.features.end(), f.begin(), f.end());
+            w.solutions.insert(w.solutions.end(), x.begin(), x.end());
+        }
+        m_T[i] = thermo->temperature();
+        m_P[i] = thermo->pressure();
+        thermo->getMassFractions(&m_Y[i * m_nsp]);
+    }
+}
+
+}
@@ -28,7 +28,12 @@ MultiPhase::MultiPhase() :
     m_init(false),
     m_eloc(npos),
     m_Tmin(1.0),
-    m_Tmax(100000.0)
+    m_Tmax(100000.0),
+    m_reuseVcs(false)
+{
+}
+
+MultiPhase::~MultiPhase()
 {
 }
 
@@ -656,13 +661,19 @@ void MultiPhase::equilibrate(const std::string& XY, const std::string& solver,
     if (solver == "auto" || solver == "vcs") {
         try {
             debuglog("Trying VCS equilibrium solver\n", log_level);
-            vcs_MultiPhaseEquil eqsolve(this, log_level-1);
-            int ret = eqsolve.equilibrate(ixy, estimate_equil, log_level-1,
-                                          rtol, max_steps);
+            unique_ptr<vcs_MultiPhaseEquil> eqsolve = std::move(m_vcsSolver);
+            if (!eqsolve) {
+                eqsolve.reset(new vcs_MultiPhaseEquil(this, log_level-1));
+            }
+            int ret = eqsolve->equilibrate(ixy, estimate_equil, log_level-1,
+                                           rtol, max_steps);
             if (ret) {
                 throw CanteraError("MultiPhase::equilibrate",
                     "VCS solver failed. Return code: {}", ret);
             }
+            if (m_reuseVcs) {
+                m_vcsSolver = std::move(eqsolve);
+            }
             debuglog("VCS solver succeeded\n", log_level);
             return;
         } catch (std::exception& err) {
@@ -706,6 +717,14 @@ void MultiPhase::equilibrate(const std::string& XY, const std::string& solver,
     }
 }
 
+void MultiPhase::setReuseVcsSolver(bool reuse)
+{
+    m_reuseVcs = reuse;
+    if (!reuse) {
+        m_vcsSolver.reset();
+    }
+}
+
 void MultiPhase::setTemperature(const doublereal T)
 {
     if (!m_init) {
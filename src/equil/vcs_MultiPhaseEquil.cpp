@@ -371,6 +371,8 @@ int vcs_MultiPhaseEquil::equilibrate(int XY, int estimateEquil,
                                      int printLvl, doublereal err,
                                      int maxsteps, int loglevel)
 {
+    // Pick up any changes of the composition since the last calculation
+    m_vsolve.vcs_prob_reload();
     doublereal xtarget;
     if (XY == TP) {
         return equilibrate_TP(estimateEquil, printLvl, err, maxsteps, loglevel);
@@ -63,6 +63,7 @@ VCS_SOLVE::VCS_SOLVE(MultiPhase* mphase, int printLvl) :
     m_totalVol(mphase->volume()),
     m_Faraday_dim(Faraday / (m_temperature * GasConstant)),
     m_VCount(0),
+    m_basisNumUpdates(0),
     m_debug_print_lvl(0),
     m_timing_print_lvl(1)
 {
@@ -339,16 +340,7 @@ VCS_SOLVE::VCS_SOLVE(MultiPhase* mphase, int printLvl) :
     }
 
     // Transfer initial element abundances based on the species mole numbers
-    for (size_t j = 0; j < m_nelem; j++) {
-        for (size_t kspec = 0; kspec < m_nsp; kspec++) {
-            if (m_speciesUnknownType[kspec] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
-                m_elemAbundancesGoal[j] += m_formulaMatrix(kspec,j) * m_molNumSpecies_old[kspec];
-            }
-        }
-        if (m_elType[j] == VCS_ELEM_TYPE_LATTICERATIO && m_elemAbundancesGoal[j] < 1.0E-10) {
-            m_elemAbundancesGoal[j] = 0.0;
-        }
-    }
+    vcs_elabGoal();
 
     // Printout the species information: PhaseID's and mole nums
     if (m_printLvl > 1) {
@@ -437,25 +429,6 @@ VCS_SOLVE::VCS_SOLVE(MultiPhase* mphase, int printLvl) :
         }
     }
 
-    for (size_t i = 0; i < m_nelem; i++) {
-        if (m_elType[i] == VCS_ELEM_TYPE_CHARGENEUTRALITY) {
-            if (m_elemAbundancesGoal[i] != 0.0) {
-                if (fabs(m_elemAbundancesGoal[i]) > 1.0E-9) {
-                    throw CanteraError("VCS_SOLVE::VCS_SOLVE",
-                            "Charge neutrality condition {} is signicantly "
-                            "nonzero, {}. Giving up",
-                            m_elementName[i], m_elemAbundancesGoal[i]);
-                } else {
-                    if (m_debug_print_lvl >= 2) {
-                        plogf("Charge neutrality condition %s not zero, %g. Setting it zero\n",
-                              m_elementName[i], m_elemAbundancesGoal[i]);
-                    }
-                    m_elemAbundancesGoal[i] = 0.0;
-                }
-            }
-        }
-    }
-
     // Copy over the species names
     for (size_t i = 0; i < m_nsp; i++) {
         m_speciesName[i] = m_mix->speciesName(i);
@@ -2211,6 +2184,35 @@ bool VCS_SOLVE::vcs_elabcheck(int ibound)
     return true;
 }
 
+void VCS_SOLVE::vcs_elabGoal()
+{
+    for (size_t j = 0; j < m_nelem; j++) {
+        m_elemAbundancesGoal[j] = 0.0;
+        for (size_t kspec = 0; kspec < m_nsp; kspec++) {
+            if (m_speciesUnknownType[kspec] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
+                m_elemAbundancesGoal[j] += m_formulaMatrix(kspec,j) * m_molNumSpecies_old[kspec];
+            }
+        }
+        if (m_elType[j] == VCS_ELEM_TYPE_LATTICERATIO && m_elemAbundancesGoal[j] < 1.0E-10) {
+            m_elemAbundancesGoal[j] = 0.0;
+        }
+        if (m_elType[j] == VCS_ELEM_TYPE_CHARGENEUTRALITY && m_elemAbundancesGoal[j] != 0.0) {
+            if (fabs(m_elemAbundancesGoal[j]) > 1.0E-9) {
+                throw CanteraError("VCS_SOLVE::vcs_elabGoal",
+                        "Charge neutrality condition {} is signicantly "
+                        "nonzero, {}. Giving up",
+                        m_elementName[j], m_elemAbundancesGoal[j]);
+            } else {
+                if (m_debug_print_lvl >= 2) {
+                    plogf("Charge neutrality condition %s not zero, %g. Setting it zero\n",
+                          m_elementName[j], m_elemAbundancesGoal[j]);
+                }
+                m_elemAbundancesGoal[j] = 0.0;
+            }
+        }
+    }
+}
+
 void VCS_SOLVE::vcs_elabPhase(size_t iphase, double* const elemAbundPhase)
 {
     for (size_t j = 0; j < m_nelem; ++j) {
@@ -2950,6 +2952,46 @@ void VCS_SOLVE::vcs_prob_specifyFully()
     m_numRxnRdc = m_numRxnTot;
 }
 
+void VCS_SOLVE::vcs_prob_reload()
+{
+    // Undo the rearrangement of the species done by a previous calculation,
+    // so that the initial choice of components is the same as for a new object
+    for (size_t k = 0; k < m_nsp; k++) {
+        size_t kpos = k;
+        while (m_speciesMapIndex[kpos] != k) {
+            kpos++;
+        }
+        vcs_switch_pos(false, k, kpos);
+        m_speciesStatus[k] = VCS_SPECIES_MAJOR;
+    }
+
+    for (size_t kspec = 0; kspec < m_nsp; kspec++) {
+        if (m_speciesUnknownType[kspec] == VCS_SPECIES_TYPE_MOLNUM) {
+            m_molNumSpecies_old[kspec] = m_mix->speciesMoles(kspec);
+        } else {
+            m_molNumSpecies_old[kspec] = m_mix->phase(m_phaseID[kspec]).electricPotential();
+        }
+    }
+    for (size_t iph = 0; iph < m_numPhases; iph++) {
+        vcs_VolPhase* Vphase = m_VolPhaseList[iph].get();
+        Vphase->setMolesFromVCS(VCS_STATECALC_OLD, &m_molNumSpecies_old[0]);
+        TPhInertMoles[iph] = Vphase->totalMolesInert();
+        m_tPhaseMoles_old[iph] = 0.0;
+    }
+    vcs_elabGoal();
+
+    // Discard the results of the previous calculation which are used before
+    // they are recomputed
+    m_SSfeSpecies.assign(m_SSfeSpecies.size(), 0.0);
+    m_deltaGRxn_new.assign(m_deltaGRxn_new.size(), 0.0);
+    m_deltaGRxn_old.assign(m_deltaGRxn_old.size(), 0.0);
+    m_deltaGRxn_Deficient.assign(m_deltaGRxn_Deficient.size(), 0.0);
+    m_deltaGRxn_tmp.assign(m_deltaGRxn_tmp.size(), 0.0);
+    m_deltaMolNumSpecies.assign(m_deltaMolNumSpecies.size(), 0.0);
+    m_actCoeffSpecies_new.assign(m_actCoeffSpecies_new.size(), 1.0);
+    m_actCoeffSpecies_old.assign(m_actCoeffSpecies_old.size(), 1.0);
+}
+
 void VCS_SOLVE::vcs_inest(double* const aw, double* const sa, double* const sm,
                           double* const ss, double test)
 {
@@ -3260,11 +3302,17 @@ void VCS_SOLVE::vcs_counters_init(int ifunc)
 {
     m_VCount->Its = 0;
     m_VCount->Basis_Opts = 0;
+    m_VCount->Basis_Factorizations = 0;
+    m_VCount->Basis_Updates = 0;
+    m_VCount->Basis_Reuses = 0;
     m_VCount->Time_vcs_TP = 0.0;
     m_VCount->Time_basopt = 0.0;
     if (ifunc) {
         m_VCount->T_Its = 0;
         m_VCount->T_Basis_Opts = 0;
+        m_VCount->T_Basis_Factorizations = 0;
+        m_VCount->T_Basis_Updates = 0;
+        m_VCount->T_Basis_Reuses = 0;
         m_VCount->T_Calls_Inest = 0;
         m_VCount->T_Calls_vcs_TP = 0;
         m_VCount->T_Time_vcs_TP = 0.0;
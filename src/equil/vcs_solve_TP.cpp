@@ -280,6 +280,9 @@ int VCS_SOLVE::vcs_solve_TP(int print_lvl, int printDetails, int maxit)
     m_VCount->T_Calls_vcs_TP++;
     m_VCount->T_Its += m_VCount->Its;
     m_VCount->T_Basis_Opts += m_VCount->Basis_Opts;
+    m_VCount->T_Basis_Factorizations += m_VCount->Basis_Factorizations;
+    m_VCount->T_Basis_Updates += m_VCount->Basis_Updates;
+    m_VCount->T_Basis_Reuses += m_VCount->Basis_Reuses;
     m_VCount->T_Time_basopt += m_VCount->Time_basopt;
 
     // Return a Flag indicating whether convergence occurred
@@ -2303,64 +2306,73 @@ L_END_LOOP:
     // the rearrangement of elements need only be done once in the problem. It's
     // actually very similar to the top of this program with ne being the
     // species and nc being the elements!!
-    C.resize(ncTrial, ncTrial);
-    for (size_t j = 0; j < ncTrial; ++j) {
-        for (size_t i = 0; i < ncTrial; ++i) {
-            C(i, j) = m_formulaMatrix(j,i);
-        }
-    }
-    for (size_t i = 0; i < m_numRxnTot; ++i) {
-        k = m_indexRxnToSpecies[i];
+    //
+    // If the new components are the same as, or differ in only a few species
+    // from, those of a previous basis, the stoichiometric matrix is obtained
+    // from the stored matrix of that basis instead.
+    if (!vcs_basisUpdate()) {
+        C.resize(ncTrial, ncTrial);
         for (size_t j = 0; j < ncTrial; ++j) {
-            m_stoichCoeffRxnMatrix(j,i) = - m_formulaMatrix(k,j);
+            for (size_t i = 0; i < ncTrial; ++i) {
+                C(i, j) = m_formulaMatrix(j,i);
+            }
         }
-    }
-    // Solve the linear system to calculate the reaction matrix,
-    // m_stoichCoeffRxnMatrix.
-    solve(C, m_stoichCoeffRxnMatrix.ptrColumn(0), m_numRxnTot, m_nelem);
+        for (size_t i = 0; i < m_numRxnTot; ++i) {
+            k = m_indexRxnToSpecies[i];
+            for (size_t j = 0; j < ncTrial; ++j) {
+                m_stoichCoeffRxnMatrix(j,i) = - m_formulaMatrix(k,j);
+            }
+        }
+        // Solve the linear system to calculate the reaction matrix,
+        // m_stoichCoeffRxnMatrix.
+        solve(C, m_stoichCoeffRxnMatrix.ptrColumn(0), m_numRxnTot, m_nelem);
 
-    // NOW, if we have interfacial voltage unknowns, what we did was just wrong
-    // -> hopefully it didn't blow up. Redo the problem. Search for inactive E
-    juse = npos;
-    jlose = npos;
-    for (size_t j = 0; j < m_nelem; j++) {
-        if (!m_elementActive[j] && !strcmp(m_elementName[j].c_str(), "E")) {
-            juse = j;
+        // NOW, if we have interfacial voltage unknowns, what we did was just
+        // wrong -> hopefully it didn't blow up. Redo the problem. Search for
+        // inactive E
+        juse = npos;
+        jlose = npos;
+        for (size_t j = 0; j < m_nelem; j++) {
+            if (!m_elementActive[j] && !strcmp(m_elementName[j].c_str(), "E")) {
+                juse = j;
+            }
         }
-    }
-    for (size_t j = 0; j < m_nelem; j++) {
-        if (m_elementActive[j] && !strncmp((m_elementName[j]).c_str(), "cn_", 3)) {
-            jlose = j;
+        for (size_t j = 0; j < m_nelem; j++) {
+            if (m_elementActive[j] && !strncmp((m_elementName[j]).c_str(), "cn_", 3)) {
+                jlose = j;
+            }
         }
-    }
-    for (k = 0; k < m_nsp; k++) {
-        if (m_speciesUnknownType[k] == VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
-            for (size_t j = 0; j < ncTrial; ++j) {
-                for (size_t i = 0; i < ncTrial; ++i) {
-                    if (i == jlose) {
-                        C(i, j) = m_formulaMatrix(j,juse);
-                    } else {
-                        C(i, j) = m_formulaMatrix(j,i);
+        for (k = 0; k < m_nsp; k++) {
+            if (m_speciesUnknownType[k] == VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
+                for (size_t j = 0; j < ncTrial; ++j) {
+                    for (size_t i = 0; i < ncTrial; ++i) {
+                        if (i == jlose) {
+                            C(i, j) = m_formulaMatrix(j,juse);
+                        } else {
+                            C(i, j) = m_formulaMatrix(j,i);
+                        }
                     }
                 }
-            }
-            for (size_t i = 0; i < m_numRxnTot; ++i) {
-                k = m_indexRxnToSpecies[i];
-                for (size_t j = 0; j < ncTrial; ++j) {
-                    if (j == jlose) {
-                        aw[j] = - m_formulaMatrix(k,juse);
-                    } else {
-                        aw[j] = - m_formulaMatrix(k,j);
+                for (size_t i = 0; i < m_numRxnTot; ++i) {
+                    k = m_indexRxnToSpecies[i];
+                    for (size_t j = 0; j < ncTrial; ++j) {
+                        if (j == jlose) {
+                            aw[j] = - m_formulaMatrix(k,juse);
+                        } else {
+                            aw[j] = - m_formulaMatrix(k,j);
+                        }
                     }
                 }
-            }
 
-            solve(C, aw, 1, m_nelem);
-            size_t i = k - ncTrial;
-            for (size_t j = 0; j < ncTrial; j++) {
-                m_stoichCoeffRxnMatrix(j,i) = aw[j];
+                solve(C, aw, 1, m_nelem);
+                size_t i = k - ncTrial;
+                for (size_t j = 0; j < ncTrial; j++) {
+                    m_stoichCoeffRxnMatrix(j,i) = aw[j];
+                }
             }
         }
+        vcs_basisSave();
+        m_VCount->Basis_Factorizations++;
     }
 
     // Calculate the szTmp array for each formation reaction
@@ -2490,6 +2502,127 @@ L_CLEANUP:
     return VCS_SUCCESS;
 }
 
+bool VCS_SOLVE::vcs_basisUpdate()
+{
+    size_t nc = m_numComponents;
+    if (m_basisComponents.empty() || m_basisComponents.size() != nc) {
+        return false;
+    }
+
+    // Find the new components which are not components of the stored basis
+    vector<size_t> pos(m_nsp, npos);
+    for (size_t p = 0; p < nc; p++) {
+        pos[m_basisComponents[p]] = p;
+    }
+    vector<size_t> incoming;
+    vector<bool> kept(nc, false);
+    for (size_t j = 0; j < nc; j++) {
+        size_t k = m_speciesMapIndex[j];
+        if (pos[k] == npos) {
+            incoming.push_back(k);
+        } else {
+            kept[pos[k]] = true;
+        }
+    }
+    if (m_basisNumUpdates + incoming.size() > VCS_MAX_BASIS_UPDATES) {
+        return false;
+    }
+
+    // Exchange each new component with the old component which has the
+    // largest coefficient in its formation reaction. Written in terms of the
+    // formation reactions
+    //
+    //     f(k) + sum_j nu(j,k) f(c_j) = 0,
+    //
+    // where f(k) is the formula vector of species k, exchanging component c_p
+    // with species s gives the new coefficients
+    //
+    //     nu'(p,k) = -nu(p,k) / nu(p,s)
+    //     nu'(j,k) = nu(j,k) - nu(p,k) nu(j,s) / nu(p,s)  for j != p
+    //
+    // and the formation reaction of the old component c_p.
+    for (size_t s : incoming) {
+        size_t p = npos;
+        double pivot = 1.0E-6;
+        for (size_t q = 0; q < nc; q++) {
+            if (!kept[q] && fabs(m_basisStoich(q,s)) > pivot) {
+                pivot = fabs(m_basisStoich(q,s));
+                p = q;
+            }
+        }
+        if (p == npos) {
+            // The stored matrix may have been partially updated
+            m_basisComponents.clear();
+            return false;
+        }
+        pivot = m_basisStoich(p,s);
+        size_t c = m_basisComponents[p];
+        for (size_t j = 0; j < nc; j++) {
+            m_basisStoich(j,c) = m_basisStoich(j,s) / pivot;
+        }
+        m_basisStoich(p,c) = 1.0 / pivot;
+        for (size_t k = 0; k < m_nsp; k++) {
+            double f = m_basisStoich(p,k) / pivot;
+            if (k == s || k == c || f == 0.0) {
+                continue;
+            }
+            for (size_t j = 0; j < nc; j++) {
+                m_basisStoich(j,k) -= f * m_basisStoich(j,s);
+            }
+            m_basisStoich(p,k) = -f;
+        }
+        for (size_t j = 0; j < nc; j++) {
+            m_basisStoich(j,s) = 0.0;
+        }
+        m_basisComponents[p] = s;
+        kept[p] = true;
+        m_basisNumUpdates++;
+    }
+
+    // Copy the stored matrix, using the current order of the components and
+    // of the noncomponent species
+    for (size_t p = 0; p < nc; p++) {
+        pos[m_basisComponents[p]] = p;
+    }
+    for (size_t i = 0; i < m_numRxnTot; i++) {
+        size_t k = m_speciesMapIndex[m_indexRxnToSpecies[i]];
+        for (size_t j = 0; j < nc; j++) {
+            m_stoichCoeffRxnMatrix(j,i) = m_basisStoich(pos[m_speciesMapIndex[j]], k);
+        }
+    }
+    if (incoming.empty()) {
+        m_VCount->Basis_Reuses++;
+    } else {
+        m_VCount->Basis_Updates++;
+    }
+    return true;
+}
+
+void VCS_SOLVE::vcs_basisSave()
+{
+    // Reaction matrices for interfacial voltage unknowns are not evaluated
+    // from the component formula matrix, and are not stored
+    m_basisComponents.clear();
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (m_speciesUnknownType[k] == VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
+            return;
+        }
+    }
+    size_t nc = m_numComponents;
+    for (size_t j = 0; j < nc; j++) {
+        m_basisComponents.push_back(m_speciesMapIndex[j]);
+    }
+    m_basisStoich.resize(nc, m_nsp);
+    m_basisStoich.zero();
+    for (size_t i = 0; i < m_numRxnTot; i++) {
+        size_t k = m_speciesMapIndex[m_indexRxnToSpecies[i]];
+        for (size_t j = 0; j < nc; j++) {
+            m_basisStoich(j,k) = m_stoichCoeffRxnMatrix(j,i);
+        }
+    }
+    m_basisNumUpdates = 0;
+}
+
 size_t VCS_SOLVE::vcs_basisOptMax(const double* const molNum, const size_t j,
                                   const size_t n)
 {
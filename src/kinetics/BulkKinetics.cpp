@@ -9,6 +9,9 @@ namespace Cantera
 {
 
 BulkKinetics::BulkKinetics(ThermoPhase* thermo) :
+    m_tab_Tmin(0.0),
+    m_tab_Tmax(0.0),
+    m_tab_rtol(0.0),
     m_ROP_ok(false),
     m_temp(0.0)
 {
@@ -17,6 +20,29 @@ BulkKinetics::BulkKinetics(ThermoPhase* thermo) :
     }
 }
 
+BulkKinetics::BulkKinetics(const BulkKinetics& other) :
+    Kinetics(other),
+    m_bulk_types(other.m_bulk_types),
+    m_tab_Tmin(other.m_tab_Tmin),
+    m_tab_Tmax(other.m_tab_Tmax),
+    m_tab_rtol(other.m_tab_rtol),
+    m_active(other.m_active),
+    m_revindex(other.m_revindex),
+    m_irrev(other.m_irrev),
+    m_dn(other.m_dn),
+    m_multi_concm(other.m_multi_concm),
+    m_concm(other.m_concm),
+    m_act_conc(other.m_act_conc),
+    m_phys_conc(other.m_phys_conc),
+    m_grt(other.m_grt),
+    m_ROP_ok(false),
+    m_temp(0.0)
+{
+    for (const auto& rates : other.m_bulk_rates) {
+        m_bulk_rates.push_back(rates->clone());
+    }
+}
+
 void BulkKinetics::resizeReactions()
 {
     Kinetics::resizeReactions();
@@ -128,6 +154,10 @@ bool BulkKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
     }
 
     m_dn.push_back(dn);
+    if (!m_active.empty()) {
+        // new reactions are active
+        m_active.push_back(true);
+    }
 
     if (r->reversible) {
         m_revindex.push_back(nReactions()-1);
@@ -146,6 +176,9 @@ bool BulkKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
         m_bulk_types[rtype] = m_bulk_rates.size();
         m_bulk_rates.push_back(rate->newMultiRate());
         m_bulk_rates.back()->resize(m_kk, nReactions(), nPhases());
+        if (m_tab_rtol > 0) {
+            m_bulk_rates.back()->setTabulation(m_tab_Tmin, m_tab_Tmax, m_tab_rtol);
+        }
     }
 
     // Set index of rate to number of reaction within kinetics
@@ -235,4 +268,41 @@ void BulkKinetics::invalidateCache()
     m_temp += 0.13579;
 }
 
+void BulkKinetics::setRateTabulation(double Tmin, double Tmax, double rtol)
+{
+    for (auto& rates : m_bulk_rates) {
+        rates->setTabulation(Tmin, Tmax, rtol);
+    }
+    m_tab_Tmin = Tmin;
+    m_tab_Tmax = Tmax;
+    m_tab_rtol = rtol;
+    invalidateCache();
+}
+
+void BulkKinetics::clearRateTabulation()
+{
+    for (auto& rates : m_bulk_rates) {
+        rates->clearTabulation();
+    }
+    m_tab_rtol = 0.0;
+    invalidateCache();
+}
+
+void BulkKinetics::setActiveReactions(const std::vector<bool>& active)
+{
+    if (!active.empty() && active.size() != nReactions()) {
+        throw CanteraError("BulkKinetics::setActiveReactions",
+            "Expected {} flags, but got {}.", nReactions(), active.size());
+    }
+    if (std::find(active.begin(), active.end(), false) == active.end()) {
+        m_active.clear();
+    } else {
+        m_active = active;
+    }
+    for (auto& rates : m_bulk_rates) {
+        rates->setActiveReactions(m_active);
+    }
+    invalidateCache();
+}
+
 }
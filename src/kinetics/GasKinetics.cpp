@@ -20,6 +20,13 @@ GasKinetics::GasKinetics(ThermoPhase* thermo) :
     setDerivativeSettings(AnyMap()); // use default settings
 }
 
+shared_ptr<Kinetics> GasKinetics::clone(const vector<ThermoPhase*>& phases) const
+{
+    shared_ptr<GasKinetics> kin(new GasKinetics(*this));
+    kin->setClonePhases(phases);
+    return kin;
+}
+
 void GasKinetics::resizeReactions()
 {
     m_rbuf0.resize(nReactions());
@@ -82,6 +89,11 @@ void GasKinetics::updateKc()
     double rrt = 1.0 / thermo().RT();
     for (size_t i = 0; i < m_revindex.size(); i++) {
         size_t irxn = m_revindex[i];
+        if (!m_active.empty() && !m_active[irxn]) {
+            // rate of progress is zero; updated by invalidateCache() when the
+            // set of active reactions changes
+            continue;
+        }
         m_rkcn[irxn] = std::min(
             exp(m_delta_gibbs0[irxn] * rrt - m_dn[irxn] * m_logStandConc),
             BigNumber);
@@ -166,6 +178,111 @@ void GasKinetics::updateROP()
     m_ROP_ok = true;
 }
 
+void GasKinetics::getNetProductionRates(size_t nStates, const double* T,
+                                        const double* P, const double* Y,
+                                        double* wdot)
+{
+    ThermoPhase& phase = thermo();
+    size_t nsp = nTotalSpecies();
+    size_t nr = nReactions();
+    m_blk_ropf.resize(nr * nStates);
+    m_blk_ropr.resize(nr * nStates);
+    m_blk_concm.resize(nr * nStates);
+    m_blk_conc.resize(nsp * nStates);
+    m_blk_logT.resize(nStates);
+    m_blk_recipT.resize(nStates);
+    double* ropf = m_blk_ropf.data();
+    double* ropr = m_blk_ropr.data();
+
+    // Rate constants which depend only on temperature are evaluated for all
+    // states at once
+    for (size_t n = 0; n < nStates; n++) {
+        m_blk_logT[n] = std::log(T[n]);
+        m_blk_recipT[n] = 1.0 / T[n];
+    }
+    m_blk_rates.resize(m_bulk_rates.size());
+    for (size_t i = 0; i < m_bulk_rates.size(); i++) {
+        m_blk_rates[i] = m_bulk_rates[i]->getRateConstants(
+            nStates, m_blk_logT.data(), m_blk_recipT.data(), ropf);
+    }
+    m_blk_rxns.clear();
+    for (size_t i = 0; i < nr; i++) {
+        shared_ptr<ReactionRate> rate = m_reactions[i]->rate();
+        std::string rtype = rate->subType();
+        if (rtype == "") {
+            rtype = rate->type();
+        }
+        if (!m_blk_rates[m_bulk_types.at(rtype)]) {
+            m_blk_rxns.push_back(i);
+        }
+    }
+
+    // Properties which require the state of the phase. The bookkeeping is the
+    // same as in update_rates_T() and update_rates_C(), so the rate handlers
+    // only re-evaluate rate constants if the state has changed.
+    phase.saveState(m_state);
+    for (size_t n = 0; n < nStates; n++) {
+        for (size_t k = 0; k < nsp; k++) {
+            m_sbuf0[k] = Y[k * nStates + n];
+        }
+        phase.setMassFractions_NoNorm(m_sbuf0.data());
+        phase.setState_TP(T[n], P[n]);
+        update_rates_C();
+        m_logStandConc = log(phase.standardConcentration());
+        if (T[n] != m_temp) {
+            updateKc();
+        }
+        for (size_t i = 0; i < m_bulk_rates.size(); i++) {
+            if (!m_blk_rates[i] && m_bulk_rates[i]->update(phase, *this)) {
+                m_bulk_rates[i]->getRateConstants(m_rfn.data());
+            }
+        }
+        m_temp = T[n];
+        m_pres = P[n];
+
+        for (size_t k = 0; k < nsp; k++) {
+            m_blk_conc[k * nStates + n] = m_act_conc[k];
+        }
+        for (size_t i : m_blk_rxns) {
+            ropf[i * nStates + n] = m_rfn[i];
+        }
+        for (size_t i = 0; i < nr; i++) {
+            ropr[i * nStates + n] = m_rkcn[i];
+            m_blk_concm[i * nStates + n] = m_concm[i];
+        }
+    }
+    phase.restoreState(m_state);
+    m_ROP_ok = false;
+
+    // Remaining steps of updateROP() for all states
+    for (size_t i = 0; i < nr; i++) {
+        double perturb = m_perturb[i];
+        double* kf = ropf + i * nStates;
+        for (size_t n = 0; n < nStates; n++) {
+            kf[n] *= perturb;
+        }
+    }
+    if (!m_concm.empty()) {
+        m_multi_concm.multiply(ropf, m_blk_concm.data(), nStates);
+    }
+    for (size_t j = 0; j < nr * nStates; j++) {
+        ropr[j] *= ropf[j];
+    }
+    m_reactantStoich.multiply(m_blk_conc.data(), ropf, nStates);
+    m_revProductStoich.multiply(m_blk_conc.data(), ropr, nStates);
+    for (size_t j = 0; j < nr * nStates; j++) {
+        ropf[j] -= ropr[j];
+    }
+
+    // products are created and reactants are destroyed for positive net rates
+    // of progress
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                          Eigen::RowMajor> RowMatrix;
+    Eigen::Map<const RowMatrix> ropnet(ropf, nr, nStates);
+    Eigen::Map<RowMatrix> out(wdot, nsp, nStates);
+    out = m_stoichMatrix * ropnet;
+}
+
 void GasKinetics::getFwdRateConstants(double* kfwd)
 {
     processFwdRateCoefficients(m_ropf.data());
@@ -24,6 +24,8 @@ InterfaceKinetics::InterfaceKinetics(ThermoPhase* thermo) :
     m_temp(0.0),
     m_phaseExistsCheck(false),
     m_ioFlag(0),
+    m_jac_skip_coverage_dependence(false),
+    m_jac_rtol_delta(1e-8),
     m_nDim(2)
 {
     if (thermo != 0) {
@@ -31,14 +33,59 @@ InterfaceKinetics::InterfaceKinetics(ThermoPhase* thermo) :
     }
 }
 
+InterfaceKinetics::InterfaceKinetics(const InterfaceKinetics& other) :
+    Kinetics(other),
+    m_grt(other.m_grt),
+    m_revindex(other.m_revindex),
+    m_redo_rates(true),
+    m_interfaceTypes(other.m_interfaceTypes),
+    m_irrev(other.m_irrev),
+    m_conc(other.m_conc),
+    m_actConc(other.m_actConc),
+    m_mu0(other.m_mu0),
+    m_mu(other.m_mu),
+    m_mu0_Kc(other.m_mu0_Kc),
+    m_phi(other.m_phi),
+    m_surf(0),
+    m_integrator(0),
+    m_ROP_ok(false),
+    m_temp(0.0),
+    m_phaseExistsCheck(other.m_phaseExistsCheck),
+    m_phaseExists(other.m_phaseExists),
+    m_phaseIsStable(other.m_phaseIsStable),
+    m_rxnPhaseIsReactant(other.m_rxnPhaseIsReactant),
+    m_rxnPhaseIsProduct(other.m_rxnPhaseIsProduct),
+    m_ioFlag(other.m_ioFlag),
+    m_jac_skip_coverage_dependence(other.m_jac_skip_coverage_dependence),
+    m_jac_rtol_delta(other.m_jac_rtol_delta),
+    m_rbuf0(other.m_rbuf0),
+    m_rbuf1(other.m_rbuf1),
+    m_nDim(other.m_nDim)
+{
+    for (const auto& rates : other.m_interfaceRates) {
+        m_interfaceRates.push_back(rates->clone());
+    }
+}
+
 InterfaceKinetics::~InterfaceKinetics()
 {
     delete m_integrator;
 }
 
+shared_ptr<Kinetics> InterfaceKinetics::clone(
+    const vector<ThermoPhase*>& phases) const
+{
+    shared_ptr<InterfaceKinetics> kin(new InterfaceKinetics(*this));
+    kin->setClonePhases(phases);
+    kin->init();
+    return kin;
+}
+
 void InterfaceKinetics::resizeReactions()
 {
     Kinetics::resizeReactions();
+    m_rbuf0.resize(nReactions());
+    m_rbuf1.resize(nReactions());
 
     for (auto& rates : m_interfaceRates) {
         rates->resize(nTotalSpecies(), nReactions(), nPhases());
@@ -294,6 +341,156 @@ void InterfaceKinetics::updateROP()
     m_ROP_ok = true;
 }
 
+void InterfaceKinetics::getDerivativeSettings(AnyMap& settings) const
+{
+    settings["skip-coverage-dependence"] = m_jac_skip_coverage_dependence;
+    settings["rtol-delta"] = m_jac_rtol_delta;
+}
+
+void InterfaceKinetics::setDerivativeSettings(const AnyMap& settings)
+{
+    bool force = settings.empty();
+    if (force || settings.hasKey("skip-coverage-dependence")) {
+        m_jac_skip_coverage_dependence =
+            settings.getBool("skip-coverage-dependence", false);
+    }
+    if (force || settings.hasKey("rtol-delta")) {
+        m_jac_rtol_delta = settings.getDouble("rtol-delta", 1e-8);
+    }
+}
+
+void InterfaceKinetics::assertDerivativesValid(const std::string& name)
+{
+    for (size_t n = 0; n < nPhases(); n++) {
+        if (!thermo(n).isIdeal()) {
+            throw NotImplementedError(name,
+                "Not supported for non-ideal ThermoPhase models.");
+        }
+    }
+}
+
+void InterfaceKinetics::processRateConstants_ddT(double* dkfwd, double* dkrev)
+{
+    updateROP();
+    double T = thermo(surfacePhaseIndex()).temperature();
+    double dT = T * m_jac_rtol_delta;
+
+    // rate constants at the perturbed temperature
+    m_jac_states.resize(nPhases());
+    for (size_t n = 0; n < nPhases(); n++) {
+        thermo(n).saveState(m_jac_states[n]);
+        thermo(n).setTemperature(T + dT);
+    }
+    _update_rates_T();
+    for (size_t i = 0; i < nReactions(); i++) {
+        dkfwd[i] = m_rfn[i] * m_perturb[i];
+        dkrev[i] = dkfwd[i] * m_rkcn[i];
+    }
+
+    // revert changes
+    for (size_t n = 0; n < nPhases(); n++) {
+        thermo(n).restoreState(m_jac_states[n]);
+    }
+    _update_rates_T();
+    for (size_t i = 0; i < nReactions(); i++) {
+        double kf = m_rfn[i] * m_perturb[i];
+        dkfwd[i] = (dkfwd[i] - kf) / dT;
+        dkrev[i] = (dkrev[i] - kf * m_rkcn[i]) / dT;
+    }
+
+    // rate constants are identical to those used for the current rates of
+    // progress, which therefore remain valid
+    m_ROP_ok = true;
+}
+
+void InterfaceKinetics::getFwdRateConstants_ddT(double* dkfwd)
+{
+    assertDerivativesValid("InterfaceKinetics::getFwdRateConstants_ddT");
+    processRateConstants_ddT(dkfwd, m_rbuf1.data());
+}
+
+void InterfaceKinetics::getFwdRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("InterfaceKinetics::getFwdRatesOfProgress_ddT");
+    processRateConstants_ddT(drop, m_rbuf1.data());
+    m_reactantStoich.multiply(m_actConc.data(), drop);
+}
+
+void InterfaceKinetics::getRevRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("InterfaceKinetics::getRevRatesOfProgress_ddT");
+    processRateConstants_ddT(m_rbuf0.data(), drop);
+    m_revProductStoich.multiply(m_actConc.data(), drop);
+}
+
+void InterfaceKinetics::getNetRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("InterfaceKinetics::getNetRatesOfProgress_ddT");
+    processRateConstants_ddT(drop, m_rbuf1.data());
+    m_reactantStoich.multiply(m_actConc.data(), drop);
+    m_revProductStoich.multiply(m_actConc.data(), m_rbuf1.data());
+    for (size_t i = 0; i < nReactions(); i++) {
+        drop[i] -= m_rbuf1[i];
+    }
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::process_ddCi(
+    StoichManagerN& stoich, const vector_fp& kf, const vector_fp& rop)
+{
+    // derivatives due to concentrations in law of mass action
+    Eigen::SparseMatrix<double> out = stoich.derivatives(m_actConc.data(),
+                                                         kf.data());
+    if (m_jac_skip_coverage_dependence) {
+        return out;
+    }
+
+    // derivatives due to rate constants depending on surface coverages
+    m_jac_trips.clear();
+    for (auto& rates : m_interfaceRates) {
+        rates->processRateConstants_ddCov(rop.data(), m_jac_trips);
+    }
+    if (m_jac_trips.empty()) {
+        return out;
+    }
+    size_t ns = surfacePhaseIndex();
+    const auto& surf = dynamic_cast<const SurfPhase&>(thermo(ns));
+    double invSiteDensity = 1. / surf.siteDensity();
+    for (auto& item : m_jac_trips) {
+        // convert to derivative with respect to species concentration
+        size_t k = item.col();
+        item = Eigen::Triplet<double>(item.row(),
+            static_cast<int>(m_start[ns] + k),
+            item.value() * surf.size(k) * invSiteDensity);
+    }
+    Eigen::SparseMatrix<double> cov(nReactions(), m_kk);
+    cov.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
+    return out + cov;
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::fwdRatesOfProgress_ddCi()
+{
+    assertDerivativesValid("InterfaceKinetics::fwdRatesOfProgress_ddCi");
+    getFwdRateConstants(m_rbuf0.data());
+    return process_ddCi(m_reactantStoich, m_rbuf0, m_ropf);
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::revRatesOfProgress_ddCi()
+{
+    assertDerivativesValid("InterfaceKinetics::revRatesOfProgress_ddCi");
+    getRevRateConstants(m_rbuf0.data());
+    return process_ddCi(m_revProductStoich, m_rbuf0, m_ropr);
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::netRatesOfProgress_ddCi()
+{
+    assertDerivativesValid("InterfaceKinetics::netRatesOfProgress_ddCi");
+    getFwdRateConstants(m_rbuf0.data());
+    Eigen::SparseMatrix<double> jac = process_ddCi(m_reactantStoich, m_rbuf0,
+                                                   m_ropf);
+    getRevRateConstants(m_rbuf0.data());
+    return jac - process_ddCi(m_revProductStoich, m_rbuf0, m_ropr);
+}
+
 void InterfaceKinetics::getDeltaGibbs(doublereal* deltaG)
 {
     // Get the chemical potentials of the species in the all of the phases used
@@ -261,6 +261,21 @@ void InterfaceRateBase::updateFromStruct(const InterfaceData& shared_data) {
     }
 }
 
+void InterfaceRateBase::ddCoverageScaledFromStruct(const InterfaceData& shared_data,
+    std::vector<std::pair<size_t, double>>& ddCov) const
+{
+    for (auto& item : m_indices) {
+        double theta = shared_data.coverages[item.second];
+        double d = std::log(10.0) * m_ac[item.first]
+                   - m_ec[item.first] * shared_data.recipT;
+        if (m_mc[item.first] != 0.) {
+            // consistent with the lower bound applied to logCoverages
+            d += m_mc[item.first] / std::max(theta, Tiny);
+        }
+        ddCov.emplace_back(item.second, d);
+    }
+}
+
 void InterfaceRateBase::setContext(const Reaction& rxn, const Kinetics& kin)
 {
     setSpecies(kin.thermo().speciesNames());
@@ -64,6 +64,37 @@ void Kinetics::resizeReactions()
     m_ready = true;
 }
 
+shared_ptr<Kinetics> Kinetics::clone(const vector<ThermoPhase*>& phases) const
+{
+    if (typeid(*this) != typeid(Kinetics)) {
+        throw NotImplementedError("Kinetics::clone",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+    shared_ptr<Kinetics> kin(new Kinetics(*this));
+    kin->setClonePhases(phases);
+    return kin;
+}
+
+void Kinetics::setClonePhases(const vector<ThermoPhase*>& phases)
+{
+    if (phases.size() != m_thermo.size()) {
+        throw CanteraError("Kinetics::setClonePhases",
+            "Expected {} phases, but got {}.", m_thermo.size(), phases.size());
+    }
+    for (size_t n = 0; n < phases.size(); n++) {
+        if (phases[n]->nSpecies() != m_thermo[n]->nSpecies()) {
+            throw CanteraError("Kinetics::setClonePhases",
+                "Phase '{}' has {} species, but phase '{}' has {} species.",
+                phases[n]->name(), phases[n]->nSpecies(), m_thermo[n]->name(),
+                m_thermo[n]->nSpecies());
+        }
+    }
+    m_thermo = phases;
+    m_root.reset();
+    m_cache.clear();
+    invalidateCache();
+}
+
 void Kinetics::checkReactionArraySize(size_t ii) const
 {
     if (nReactions() > ii) {
@@ -554,6 +585,11 @@ Eigen::SparseMatrix<double> Kinetics::netProductionRates_ddX()
     return m_stoichMatrix * netRatesOfProgress_ddX();
 }
 
+Eigen::SparseMatrix<double> Kinetics::netProductionRates_ddCi()
+{
+    return m_stoichMatrix * netRatesOfProgress_ddCi();
+}
+
 void Kinetics::addPhase(ThermoPhase& thermo)
 {
     // the phase with lowest dimensionality is assumed to be the
@@ -0,0 +1,205 @@
+/**
+ *  @file MechanismReducer.cpp
+ *  Reduction of the set of active reactions of a Kinetics object using the
+ *  DRGEP method
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/MechanismReducer.h"
+#include "cantera/kinetics/Kinetics.h"
+
+#include <queue>
+
+using namespace std;
+
+namespace Cantera
+{
+
+MechanismReducer::MechanismReducer(Kinetics& kin) :
+    m_kin(kin),
+    m_threshold(1e-3),
+    m_nActive(kin.nReactions())
+{
+    size_t nsp = kin.nTotalSpecies();
+    size_t nrxn = kin.nReactions();
+
+    // Net stoichiometric coefficients of all participating species, including
+    // species which appear on both sides of a reaction
+    auto reactants = kin.reactantStoichCoeffs();
+    auto products = kin.productStoichCoeffs();
+    m_rxnStart.assign(1, 0);
+    for (size_t i = 0; i < nrxn; i++) {
+        map<size_t, double> nu;
+        for (Eigen::SparseMatrix<double>::InnerIterator it(reactants, i); it; ++it) {
+            nu[it.row()] -= it.value();
+        }
+        for (Eigen::SparseMatrix<double>::InnerIterator it(products, i); it; ++it) {
+            nu[it.row()] += it.value();
+        }
+        for (const auto& sp : nu) {
+            m_rxnSpecies.push_back(sp.first);
+            m_rxnNu.push_back(sp.second);
+        }
+        m_rxnStart.push_back(m_rxnSpecies.size());
+    }
+
+    // Species pairs which are coupled by at least one reaction
+    map<pair<size_t, size_t>, size_t> pairIndex;
+    vector<pair<size_t, size_t>> pairs;
+    m_pairStart.assign(1, 0);
+    for (size_t i = 0; i < nrxn; i++) {
+        for (size_t m = m_rxnStart[i]; m < m_rxnStart[i+1]; m++) {
+            if (m_rxnNu[m] == 0) {
+                continue;
+            }
+            for (size_t n = m_rxnStart[i]; n < m_rxnStart[i+1]; n++) {
+                if (n == m) {
+                    continue;
+                }
+                auto key = make_pair(m_rxnSpecies[m], m_rxnSpecies[n]);
+                auto iter = pairIndex.find(key);
+                if (iter == pairIndex.end()) {
+                    iter = pairIndex.emplace(key, pairs.size()).first;
+                    pairs.push_back(key);
+                }
+                m_rxnPairs.push_back(iter->second);
+                m_rxnPairNu.push_back(m_rxnNu[m]);
+            }
+        }
+        m_pairStart.push_back(m_rxnPairs.size());
+    }
+
+    // Edges of the directed relation graph, sorted by source species
+    m_edgeStart.assign(nsp + 1, 0);
+    for (const auto& p : pairs) {
+        m_edgeStart[p.first + 1]++;
+    }
+    for (size_t k = 0; k < nsp; k++) {
+        m_edgeStart[k + 1] += m_edgeStart[k];
+    }
+    m_edgeTarget.resize(pairs.size());
+    m_edgePair.resize(pairs.size());
+    vector<size_t> pos(m_edgeStart.begin(), m_edgeStart.end() - 1);
+    for (size_t p = 0; p < pairs.size(); p++) {
+        size_t e = pos[pairs[p].first]++;
+        m_edgeTarget[e] = pairs[p].second;
+        m_edgePair[e] = p;
+    }
+
+    m_active.assign(nrxn, true);
+    m_importance.assign(nsp, 1.0);
+    m_ropnet.resize(nrxn);
+    m_interaction.resize(pairs.size());
+    m_prod.resize(nsp);
+    m_cons.resize(nsp);
+}
+
+void MechanismReducer::setTargets(const vector<string>& names)
+{
+    m_targets.clear();
+    for (const auto& name : names) {
+        size_t k = m_kin.kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("MechanismReducer::setTargets",
+                               "Unknown species '{}'.", name);
+        }
+        m_targets.push_back(k);
+    }
+}
+
+void MechanismReducer::setThreshold(double threshold)
+{
+    if (threshold < 0 || threshold > 1) {
+        throw CanteraError("MechanismReducer::setThreshold",
+            "Threshold must be between 0 and 1; got {}.", threshold);
+    }
+    m_threshold = threshold;
+}
+
+size_t MechanismReducer::update()
+{
+    if (m_targets.empty()) {
+        throw CanteraError("MechanismReducer::update",
+                           "No target species specified.");
+    }
+    size_t nrxn = m_ropnet.size();
+
+    // Rates of progress of the full mechanism
+    m_kin.setActiveReactions({});
+    m_kin.getNetRatesOfProgress(m_ropnet.data());
+
+    // Production and consumption rates, and numerators of the direct
+    // interaction coefficients
+    fill(m_prod.begin(), m_prod.end(), 0.0);
+    fill(m_cons.begin(), m_cons.end(), 0.0);
+    fill(m_interaction.begin(), m_interaction.end(), 0.0);
+    for (size_t i = 0; i < nrxn; i++) {
+        double rop = m_ropnet[i];
+        if (rop == 0) {
+            continue;
+        }
+        for (size_t m = m_rxnStart[i]; m < m_rxnStart[i+1]; m++) {
+            double wdot = m_rxnNu[m] * rop;
+            if (wdot > 0) {
+                m_prod[m_rxnSpecies[m]] += wdot;
+            } else {
+                m_cons[m_rxnSpecies[m]] -= wdot;
+            }
+        }
+        for (size_t m = m_pairStart[i]; m < m_pairStart[i+1]; m++) {
+            m_interaction[m_rxnPairs[m]] += m_rxnPairNu[m] * rop;
+        }
+    }
+
+    // Maximum path products starting from the target species. Since the
+    // interaction coefficients are at most one, species are finalized in order
+    // of decreasing importance, as in Dijkstra's algorithm. Paths are not
+    // followed once their product drops below the threshold.
+    fill(m_importance.begin(), m_importance.end(), 0.0);
+    priority_queue<pair<double, size_t>> queue;
+    for (size_t k : m_targets) {
+        m_importance[k] = 1.0;
+        queue.emplace(1.0, k);
+    }
+    while (!queue.empty()) {
+        double R = queue.top().first;
+        size_t A = queue.top().second;
+        queue.pop();
+        double denom = std::max(m_prod[A], m_cons[A]);
+        if (R < m_importance[A] || denom == 0) {
+            continue;
+        }
+        for (size_t e = m_edgeStart[A]; e < m_edgeStart[A+1]; e++) {
+            size_t B = m_edgeTarget[e];
+            double RB = R * std::abs(m_interaction[m_edgePair[e]]) / denom;
+            if (RB > m_importance[B] && RB >= m_threshold) {
+                m_importance[B] = RB;
+                queue.emplace(RB, B);
+            }
+        }
+    }
+
+    // Reactions are active if all participating species are retained
+    m_nActive = 0;
+    for (size_t i = 0; i < nrxn; i++) {
+        bool active = true;
+        for (size_t m = m_rxnStart[i]; m < m_rxnStart[i+1] && active; m++) {
+            active = (m_importance[m_rxnSpecies[m]] >= m_threshold);
+        }
+        m_active[i] = active;
+        m_nActive += active;
+    }
+    m_kin.setActiveReactions(m_active);
+    return m_nActive;
+}
+
+void MechanismReducer::clear()
+{
+    m_kin.setActiveReactions({});
+    m_active.assign(m_active.size(), true);
+    m_nActive = m_active.size();
+}
+
+}
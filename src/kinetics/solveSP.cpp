@@ -33,6 +33,7 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_rtol(1.0E-4),
     m_maxstep(1000),
     m_maxTotSpecies(0),
+    m_analyticJac(bulkFunc != BULK_DEPOSITION),
     m_ioflag(0)
 {
     m_numSurfPhases = 0;
@@ -54,6 +55,11 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
                                "InterfaceKinetics object");
         }
 
+        for (size_t i = 0; i < kin->nPhases(); i++) {
+            // analytical derivatives require ideal phases
+            m_analyticJac = m_analyticJac && kin->thermo(i).isIdeal();
+        }
+
         m_ptrsSurfPhase.push_back(sp);
         size_t nsp = sp->nSpecies();
         m_nSpeciesSurfPhase.push_back(nsp);
@@ -455,20 +461,66 @@ void solveSP::resjac_eval(DenseMatrix& jac,
     size_t kColIndex = 0;
     // Calculate the residual
     fun_eval(resid, CSoln, CSolnOld, do_time, deltaT);
-    // Now we will look over the columns perturbing each unknown.
-    for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
-        size_t nsp = m_nSpeciesSurfPhase[jsp];
-        double sd = m_ptrsSurfPhase[jsp]->siteDensity();
-        for (size_t kCol = 0; kCol < nsp; kCol++) {
-            double cSave = CSoln[kColIndex];
-            double dc = std::max(1.0E-10 * sd, fabs(cSave) * 1.0E-7);
-            CSoln[kColIndex] += dc;
-            fun_eval(m_numEqn2.data(), CSoln, CSolnOld, do_time, deltaT);
-            for (size_t i = 0; i < m_neq; i++) {
-                jac(i, kColIndex) = (m_numEqn2[i] - resid[i])/dc;
+
+    if (m_analyticJac) {
+        // The surface species columns are evaluated from the analytical
+        // derivatives of the net production rates with respect to the species
+        // concentrations, at the state set by fun_eval.
+        jac.zero();
+        size_t kins = 0;
+        for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+            size_t nsp = m_nSpeciesSurfPhase[isp];
+            InterfaceKinetics* kin = m_objects[isp];
+            size_t kstart = kin->kineticsSpeciesIndex(0, kin->surfacePhaseIndex());
+            size_t kspecial = kins + m_spSurfLarge[isp];
+            Eigen::SparseMatrix<double> dwdot = kin->netProductionRates_ddCi();
+
+            // Columns of all surface phases participating in the kinetics object
+            size_t jcol = 0;
+            for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
+                size_t jstart = npos;
+                for (size_t n = 0; n < kin->nPhases(); n++) {
+                    if (&kin->thermo(n) == m_ptrsSurfPhase[jsp]) {
+                        jstart = kin->kineticsSpeciesIndex(0, n);
+                    }
+                }
+                for (size_t j = 0; j < m_nSpeciesSurfPhase[jsp] && jstart != npos; j++) {
+                    int col = static_cast<int>(jstart + j);
+                    for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, col); it; ++it) {
+                        size_t k = it.row();
+                        if (k >= kstart && k < kstart + nsp && kins + k - kstart != kspecial) {
+                            jac(kins + k - kstart, jcol + j) = -it.value();
+                        }
+                    }
+                }
+                jcol += m_nSpeciesSurfPhase[jsp];
+            }
+
+            for (size_t k = 0; k < nsp; k++) {
+                if (do_time && kins + k != kspecial) {
+                    jac(kins + k, kins + k) += 1.0 / deltaT;
+                }
+                jac(kspecial, kins + k) = -1.0;
+            }
+            kins += nsp;
+        }
+        kColIndex = m_numTotSurfSpecies;
+    } else {
+        // Now we will look over the columns perturbing each unknown.
+        for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
+            size_t nsp = m_nSpeciesSurfPhase[jsp];
+            double sd = m_ptrsSurfPhase[jsp]->siteDensity();
+            for (size_t kCol = 0; kCol < nsp; kCol++) {
+                double cSave = CSoln[kColIndex];
+                double dc = std::max(1.0E-10 * sd, fabs(cSave) * 1.0E-7);
+                CSoln[kColIndex] += dc;
+                fun_eval(m_numEqn2.data(), CSoln, CSolnOld, do_time, deltaT);
+                for (size_t i = 0; i < m_neq; i++) {
+                    jac(i, kColIndex) = (m_numEqn2[i] - resid[i])/dc;
+                }
+                CSoln[kColIndex] = cSave;
+                kColIndex++;
             }
-            CSoln[kColIndex] = cSave;
-            kColIndex++;
         }
     }
 
@@ -32,16 +32,15 @@ void AdaptivePreconditioner::initialize(size_t networkSize)
     use_legacy_rate_constants(false);
     // reset arrays in case of re-initialization
     m_jac_trips.clear();
+    m_pattern.clear();
+    m_jac.resize(0, 0);
+    m_analyze = true;
     // set dimensions of preconditioner from network
     m_dim = networkSize;
     // reserve some space for vectors making up SparseMatrix
     m_jac_trips.reserve(3 * networkSize);
     // reserve space for preconditioner
     m_precon_matrix.resize(m_dim, m_dim);
-    // creating sparse identity matrix
-    m_identity.resize(m_dim, m_dim);
-    m_identity.setIdentity();
-    m_identity.makeCompressed();
     // setting default ILUT parameters
     if (m_drop_tol == 0) {
         setIlutDropTol(1e-10);
@@ -58,10 +57,12 @@ void AdaptivePreconditioner::setup()
 {
     // make into preconditioner as P = (I - gamma * J_bar)
     updatePreconditioner();
-    // compressing sparse matrix structure
-    m_precon_matrix.makeCompressed();
-    // analyze and factorize
-    m_solver.compute(m_precon_matrix);
+    // analyze the pattern if it has changed and factorize
+    if (m_analyze) {
+        m_solver.analyzePattern(m_precon_matrix);
+        m_analyze = false;
+    }
+    m_solver.factorize(m_precon_matrix);
     // check for errors
     if (m_solver.info() != Eigen::Success) {
         throw CanteraError("AdaptivePreconditioner::setup",
@@ -71,16 +72,95 @@ void AdaptivePreconditioner::setup()
 
 void AdaptivePreconditioner::updatePreconditioner()
 {
-    // set precon to jacobian
-    m_precon_matrix.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
-    // convert to preconditioner
-    m_precon_matrix = m_identity - m_gamma * m_precon_matrix;
+    // update jacobian values, rebuilding the sparsity pattern only if needed
+    updateJacobian();
+    // convert to preconditioner in place, P = (I - gamma * J)
+    double* precon = m_precon_matrix.valuePtr();
+    std::fill(precon, precon + m_precon_matrix.nonZeros(), 0.0);
+    const double* jac = m_jac.valuePtr();
+    for (size_t i = 0; i < m_precon_index.size(); i++) {
+        precon[m_precon_index[i]] = -m_gamma * jac[i];
+    }
+    for (size_t i = 0; i < m_diag_index.size(); i++) {
+        precon[m_diag_index[i]] += 1.0;
+    }
     // prune by threshold if desired
     if (m_prune_precon) {
         prunePreconditioner();
     }
 }
 
+bool AdaptivePreconditioner::updateJacobian()
+{
+    bool changed = (m_jac.rows() != static_cast<Eigen::Index>(m_dim)
+                    || m_pattern.size() != m_jac_trips.size());
+    for (size_t i = 0; i < m_jac_trips.size() && !changed; i++) {
+        changed = (m_pattern[i].first != m_jac_trips[i].row()
+                   || m_pattern[i].second != m_jac_trips[i].col());
+    }
+    if (changed) {
+        updatePattern();
+    }
+    // scatter values into compressed storage; duplicate entries are summed
+    double* jac = m_jac.valuePtr();
+    std::fill(jac, jac + m_jac.nonZeros(), 0.0);
+    for (size_t i = 0; i < m_jac_trips.size(); i++) {
+        jac[m_jac_index[i]] += m_jac_trips[i].value();
+    }
+    return changed;
+}
+
+void AdaptivePreconditioner::updatePattern()
+{
+    m_pattern.resize(m_jac_trips.size());
+    for (size_t i = 0; i < m_jac_trips.size(); i++) {
+        m_pattern[i] = {m_jac_trips[i].row(), m_jac_trips[i].col()};
+    }
+    // build the jacobian pattern; sorting of triplets only happens here
+    m_jac.resize(m_dim, m_dim);
+    m_jac.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
+    m_jac.makeCompressed();
+    // preconditioner pattern is the union of the jacobian pattern and the diagonal
+    std::vector<Eigen::Triplet<double>> trips;
+    trips.reserve(m_jac.nonZeros() + m_dim);
+    for (int k = 0; k < m_jac.outerSize(); k++) {
+        trips.emplace_back(k, k, 1.0);
+        for (Eigen::SparseMatrix<double>::InnerIterator it(m_jac, k); it; ++it) {
+            trips.emplace_back(it.row(), it.col(), 1.0);
+        }
+    }
+    m_precon_matrix.resize(m_dim, m_dim);
+    m_precon_matrix.setFromTriplets(trips.begin(), trips.end());
+    m_precon_matrix.makeCompressed();
+
+    // map triplets to positions in the jacobian value array
+    m_jac_index.resize(m_jac_trips.size());
+    for (size_t i = 0; i < m_jac_trips.size(); i++) {
+        int row = m_jac_trips[i].row();
+        int col = m_jac_trips[i].col();
+        const int* start = m_jac.innerIndexPtr() + m_jac.outerIndexPtr()[col];
+        const int* end = m_jac.innerIndexPtr() + m_jac.outerIndexPtr()[col + 1];
+        m_jac_index[i] = std::lower_bound(start, end, row) - m_jac.innerIndexPtr();
+    }
+
+    // map jacobian and diagonal elements to positions in the preconditioner
+    m_precon_index.resize(m_jac.nonZeros());
+    m_diag_index.resize(m_dim);
+    const int* outer = m_precon_matrix.outerIndexPtr();
+    const int* inner = m_precon_matrix.innerIndexPtr();
+    for (int k = 0; k < m_precon_matrix.outerSize(); k++) {
+        m_diag_index[k] = std::lower_bound(inner + outer[k], inner + outer[k + 1], k)
+            - inner;
+        for (int i = m_jac.outerIndexPtr()[k]; i < m_jac.outerIndexPtr()[k + 1]; i++) {
+            int row = m_jac.innerIndexPtr()[i];
+            m_precon_index[i] = std::lower_bound(inner + outer[k],
+                                                 inner + outer[k + 1], row) - inner;
+        }
+    }
+    m_analyze = true;
+    m_pattern_updates++;
+}
+
 void AdaptivePreconditioner::prunePreconditioner()
 {
     for (int k=0; k<m_precon_matrix.outerSize(); ++k) {
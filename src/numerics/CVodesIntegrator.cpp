@@ -87,6 +87,36 @@ extern "C" {
         }
     }
 
+    //! Function called by CVODES to evaluate the right-hand side of the
+    //! adjoint system
+    static int cvodes_rhsB(realtype t, N_Vector y, N_Vector yB, N_Vector yBdot,
+                           void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalAdjoint_nothrow(t, NV_DATA_S(y), NV_DATA_S(yB),
+                                      NV_DATA_S(yBdot));
+    }
+
+    //! Function called by CVODES to evaluate the quadrature integrands of the
+    //! adjoint system
+    static int cvodes_quadB(realtype t, N_Vector y, N_Vector yB, N_Vector qBdot,
+                            void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalAdjointQuadrature_nothrow(t, NV_DATA_S(y), NV_DATA_S(yB),
+                                                NV_DATA_S(qBdot));
+    }
+
+    //! Function called by CVODES to evaluate the dense Jacobian of the adjoint
+    //! system
+    static int cvodes_jacB(realtype t, N_Vector y, N_Vector yB, N_Vector fyB,
+                           SUNMatrix JB, void* f_data, N_Vector tmp1B,
+                           N_Vector tmp2B, N_Vector tmp3B)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalAdjointJacobian_nothrow(t, NV_DATA_S(y), SM_DATA_D(JB));
+    }
+
     static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector ydot, N_Vector r,
                                  N_Vector z, realtype gamma, realtype delta, int lr,
                                  void* f_data)
@@ -122,7 +152,8 @@ CVodesIntegrator::CVodesIntegrator() :
     m_yS(nullptr),
     m_np(0),
     m_mupper(0), m_mlower(0),
-    m_sens_ok(false)
+    m_sens_ok(false),
+    m_adjointSteps(0)
 {
 }
 
@@ -132,6 +163,9 @@ CVodesIntegrator::~CVodesIntegrator()
         if (m_np > 0) {
             CVodeSensFree(m_cvode_mem);
         }
+        if (m_adjointSteps) {
+            CVodeAdjFree(m_cvode_mem);
+        }
         CVodeFree(&m_cvode_mem);
     }
 
@@ -323,6 +357,10 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
     func.getState(NV_DATA_S(m_y));
 
     if (m_cvode_mem) {
+        if (m_adjointSteps) {
+            CVodeAdjFree(m_cvode_mem);
+            m_adjointSteps = 0;
+        }
         CVodeFree(&m_cvode_mem);
     }
 
@@ -402,6 +440,10 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
     if (m_prec_side != PreconditionerSide::NO_PRECONDITION) {
         m_preconditioner->initialize(m_neq);
     }
+    if (m_adjointSteps) {
+        CVodeAdjFree(m_cvode_mem);
+        m_adjointSteps = 0;
+    }
     int result = CVodeReInit(m_cvode_mem, m_t0, m_y);
     if (result != CV_SUCCESS) {
         throw CanteraError("CVodesIntegrator::reinitialize",
@@ -557,7 +599,13 @@ void CVodesIntegrator::integrate(double tout)
     if (tout == m_time) {
         return;
     }
-    int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
+    int flag;
+    if (m_adjointSteps) {
+        int ncheck;
+        flag = CVodeF(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL, &ncheck);
+    } else {
+        flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
+    }
     if (flag != CV_SUCCESS) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
@@ -574,7 +622,13 @@ void CVodesIntegrator::integrate(double tout)
 
 double CVodesIntegrator::step(double tout)
 {
-    int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP);
+    int flag;
+    if (m_adjointSteps) {
+        int ncheck;
+        flag = CVodeF(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP, &ncheck);
+    } else {
+        flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP);
+    }
     if (flag != CV_SUCCESS) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
@@ -706,6 +760,161 @@ double CVodesIntegrator::sensitivity(size_t k, size_t p)
     return NV_Ith_S(m_yS[p],k);
 }
 
+void CVodesIntegrator::initializeAdjoint(int nsteps)
+{
+    if (!m_cvode_mem) {
+        throw CanteraError("CVodesIntegrator::initializeAdjoint",
+                           "Integrator is not initialized.");
+    }
+    if (m_adjointSteps) {
+        CVodeAdjFree(m_cvode_mem);
+    }
+    int flag = CVodeAdjInit(m_cvode_mem, nsteps, CV_HERMITE);
+    if (flag != CV_SUCCESS) {
+        throw CanteraError("CVodesIntegrator::initializeAdjoint",
+                           "CVodeAdjInit failed. Error code: {}", flag);
+    }
+    m_adjointSteps = nsteps;
+}
+
+void CVodesIntegrator::solveAdjoint(double tB0, double tB1, double* yB, double* qB)
+{
+    if (!m_adjointSteps) {
+        throw CanteraError("CVodesIntegrator::solveAdjoint",
+            "Checkpointing of the forward solution is not enabled. "
+            "Call initializeAdjoint() before integrating forward.");
+    }
+    size_t nq = m_func->nAdjointQuadratures();
+    sd_size_t N = static_cast<sd_size_t>(m_neq);
+    N_Vector yBvec = newNVector(m_neq, m_sundials_ctx);
+    N_Vector qBvec = newNVector(std::max<size_t>(nq, 1), m_sundials_ctx);
+    std::copy(yB, yB + m_neq, NV_DATA_S(yBvec));
+    N_VConst(0.0, qBvec);
+    SUNMatrix matB = nullptr;
+    SUNLinearSolver linsolB = nullptr;
+
+    // Report errors after releasing all memory allocated for the backward
+    // problem
+    int flag = CV_SUCCESS;
+    std::string step;
+    int which;
+    #if CT_SUNDIALS_VERSION >= 60
+        matB = SUNDenseMatrix(N, N, m_sundials_ctx.get());
+    #else
+        matB = SUNDenseMatrix(N, N);
+    #endif
+    #if CT_SUNDIALS_VERSION >= 60
+        #if CT_SUNDIALS_USE_LAPACK
+            linsolB = SUNLinSol_LapackDense(yBvec, matB, m_sundials_ctx.get());
+        #else
+            linsolB = SUNLinSol_Dense(yBvec, matB, m_sundials_ctx.get());
+        #endif
+    #else
+        #if CT_SUNDIALS_USE_LAPACK
+            linsolB = SUNLapackDense(yBvec, matB);
+        #else
+            linsolB = SUNDenseLinearSolver(yBvec, matB);
+        #endif
+    #endif
+    if (matB == nullptr || linsolB == nullptr) {
+        flag = CV_MEM_FAIL;
+        step = "creating the linear solver";
+    }
+    if (flag == CV_SUCCESS) {
+        #if CT_SUNDIALS_VERSION < 40
+            flag = CVodeCreateB(m_cvode_mem, m_method, CV_NEWTON, &which);
+        #else
+            flag = CVodeCreateB(m_cvode_mem, m_method, &which);
+        #endif
+        step = "CVodeCreateB";
+    }
+    if (flag == CV_SUCCESS) {
+        flag = CVodeInitB(m_cvode_mem, which, cvodes_rhsB, tB0, yBvec);
+        step = "CVodeInitB";
+    }
+    if (flag == CV_SUCCESS) {
+        void* cvodeB_mem = CVodeGetAdjCVodeBmem(m_cvode_mem, which);
+        flag = CVodeSetErrHandlerFn(cvodeB_mem, &cvodes_err, this);
+        step = "CVodeSetErrHandlerFn";
+    }
+    if (flag == CV_SUCCESS) {
+        flag = CVodeSStolerancesB(m_cvode_mem, which, m_reltolsens, m_abstolsens);
+        step = "CVodeSStolerancesB";
+    }
+    if (flag == CV_SUCCESS) {
+        flag = CVodeSetUserDataB(m_cvode_mem, which, m_func);
+        step = "CVodeSetUserDataB";
+    }
+    if (flag == CV_SUCCESS && m_maxsteps > 0) {
+        flag = CVodeSetMaxNumStepsB(m_cvode_mem, which, m_maxsteps);
+        step = "CVodeSetMaxNumStepsB";
+    }
+    if (flag == CV_SUCCESS) {
+        #if CT_SUNDIALS_VERSION >= 40
+            flag = CVodeSetLinearSolverB(m_cvode_mem, which, linsolB, matB);
+        #else
+            flag = CVDlsSetLinearSolverB(m_cvode_mem, which, linsolB, matB);
+        #endif
+        step = "setting the linear solver";
+    }
+    if (flag == CV_SUCCESS) {
+        #if CT_SUNDIALS_VERSION >= 40
+            flag = CVodeSetJacFnB(m_cvode_mem, which, cvodes_jacB);
+        #else
+            flag = CVDlsSetJacFnB(m_cvode_mem, which, cvodes_jacB);
+        #endif
+        step = "setting the Jacobian function";
+    }
+    if (flag == CV_SUCCESS && nq) {
+        flag = CVodeQuadInitB(m_cvode_mem, which, cvodes_quadB, qBvec);
+        step = "CVodeQuadInitB";
+    }
+    if (flag == CV_SUCCESS && nq) {
+        flag = CVodeQuadSStolerancesB(m_cvode_mem, which, m_reltolsens,
+                                      m_abstolsens);
+        step = "CVodeQuadSStolerancesB";
+    }
+    if (flag == CV_SUCCESS && nq) {
+        flag = CVodeSetQuadErrConB(m_cvode_mem, which, SUNTRUE);
+        step = "CVodeSetQuadErrConB";
+    }
+    if (flag == CV_SUCCESS) {
+        flag = CVodeB(m_cvode_mem, tB1, CV_NORMAL);
+        step = "CVodeB";
+    }
+    double t;
+    if (flag == CV_SUCCESS) {
+        flag = CVodeGetB(m_cvode_mem, which, &t, yBvec);
+        step = "CVodeGetB";
+    }
+    if (flag == CV_SUCCESS && nq) {
+        flag = CVodeGetQuadB(m_cvode_mem, which, &t, qBvec);
+        step = "CVodeGetQuadB";
+    }
+    if (flag == CV_SUCCESS) {
+        std::copy(NV_DATA_S(yBvec), NV_DATA_S(yBvec) + m_neq, yB);
+        std::copy(NV_DATA_S(qBvec), NV_DATA_S(qBvec) + nq, qB);
+    }
+
+    // The backward problem is freed together with the checkpoints
+    CVodeAdjFree(m_cvode_mem);
+    m_adjointSteps = 0;
+    SUNLinSolFree(linsolB);
+    SUNMatDestroy(matB);
+    N_VDestroy_Serial(yBvec);
+    N_VDestroy_Serial(qBvec);
+
+    if (flag != CV_SUCCESS) {
+        string f_errs = m_func->getErrors();
+        if (!f_errs.empty()) {
+            f_errs = "Exceptions caught during adjoint evaluation:\n" + f_errs;
+        }
+        throw CanteraError("CVodesIntegrator::solveAdjoint",
+            "CVodes error encountered in {}. Error code: {}\n{}\n{}",
+            step, flag, m_error_message, f_errs);
+    }
+}
+
 string CVodesIntegrator::getErrorInfo(int N)
 {
     N_Vector errs = newNVector(m_neq, m_sundials_ctx);
@@ -117,4 +117,57 @@ int FuncEval::preconditioner_solve_nothrow(double* rhs, double* output)
     return 0; // successful evaluation
 }
 
+int FuncEval::evalAdjoint_nothrow(double t, double* y, double* yB, double* yBdot)
+{
+    return callNothrow("evalAdjoint_nothrow",
+                       [&]() { evalAdjoint(t, y, yB, yBdot); });
+}
+
+int FuncEval::evalAdjointJacobian_nothrow(double t, double* y, double* jac)
+{
+    return callNothrow("evalAdjointJacobian_nothrow",
+                       [&]() { evalAdjointJacobian(t, y, jac); });
+}
+
+int FuncEval::evalAdjointQuadrature_nothrow(double t, double* y, double* yB,
+                                            double* qBdot)
+{
+    return callNothrow("evalAdjointQuadrature_nothrow",
+                       [&]() { evalAdjointQuadrature(t, y, yB, qBdot); });
+}
+
+int FuncEval::callNothrow(const std::string& method,
+                          const std::function<void()>& func)
+{
+    try {
+        func();
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::{}: unhandled exception:\n", method);
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    } catch (...) {
+        std::string msg = fmt::format("FuncEval::{}: unhandled exception"
+                                      " of unknown type\n", method);
+        if (suppressErrors()) {
+            m_errors.push_back(msg);
+        } else {
+            writelog(msg);
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
 }
@@ -0,0 +1,582 @@
+//! @file FlameletTable.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/FlameletTable.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/Boundary1D.h"
+#include "cantera/numerics/Func1.h"
+#include "cantera/numerics/funcs.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/transport/Transport.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/base/global.h"
+
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace {
+
+//! Function setting the mass fluxes of both inlets of a counterflow flame to
+//! their initial values, multiplied by the strain factor \f$ s = e^\lambda \f$
+class StrainFactorFunction : public Func1
+{
+public:
+    StrainFactorFunction(Inlet1D& fuel, Inlet1D& ox, double mdotFuel,
+                         double mdotOx)
+        : m_fuel(fuel), m_ox(ox), m_mdotFuel(mdotFuel), m_mdotOx(mdotOx) {}
+
+    virtual double eval(double lambda) const {
+        double s = exp(lambda);
+        m_fuel.setMdot(s * m_mdotFuel);
+        m_ox.setMdot(s * m_mdotOx);
+        return 0.0;
+    }
+
+protected:
+    Inlet1D& m_fuel;
+    Inlet1D& m_ox;
+    double m_mdotFuel;
+    double m_mdotOx;
+};
+
+//! A flamelet interpolated onto the mixture fraction grid
+struct Flamelet {
+    double Lambda;
+    double strain;
+    double Tmax;
+    vector_fp T, Y, omegaC;
+};
+
+}
+
+FlameletTable::FlameletTable(shared_ptr<Solution> sol, size_t nThreads)
+    : m_nsp(sol->thermo()->nSpecies())
+    , m_fuelX("H2:1.0")
+    , m_oxX("O2:0.21, N2:0.79")
+    , m_Tfuel(300.0)
+    , m_Tox(300.0)
+    , m_mdotFuel(0.2)
+    , m_mdotOx(0.6)
+    , m_width(0.02)
+    , m_Zst(NAN)
+    , m_ds(0.1)
+    , m_dsMin(1e-3)
+    , m_dsMax(0.5)
+    , m_Tscale(100.0)
+    , m_deltaT(100.0)
+    , m_maxFlamelets(200)
+    , m_ratio(3.0)
+    , m_slope(0.1)
+    , m_curve(0.2)
+    , m_prune(0.05)
+    , m_maxPoints(1000)
+{
+    if (!sol->thermo()->isIdeal() || sol->thermo()->nDim() != 3) {
+        throw CanteraError("FlameletTable::FlameletTable",
+            "Phase '{}' of type '{}' is not supported; an ideal gas is required.",
+            sol->thermo()->name(), sol->thermo()->type());
+    }
+    if (!sol->kinetics() || !sol->transport()) {
+        throw CanteraError("FlameletTable::FlameletTable",
+            "Kinetics and transport models are required.");
+    }
+    if (nThreads == 0) {
+        nThreads = std::max(thread::hardware_concurrency(), 1u);
+    }
+
+    // All objects are created here, before any worker threads are started
+    m_workers.resize(nThreads);
+    for (auto& w : m_workers) {
+        w.sol = sol->clone();
+    }
+
+    for (const char* name : {"CO2", "CO", "H2O", "H2"}) {
+        size_t k = sol->thermo()->speciesIndex(name);
+        if (k != npos) {
+            m_progressSpecies.push_back(k);
+        }
+    }
+    m_Z.resize(101);
+    for (size_t m = 0; m < m_Z.size(); m++) {
+        m_Z[m] = m / 100.0;
+    }
+}
+
+FlameletTable::~FlameletTable()
+{
+}
+
+void FlameletTable::setFuel(const string& X, double T)
+{
+    m_fuelX = X;
+    m_Tfuel = T;
+}
+
+void FlameletTable::setOxidizer(const string& X, double T)
+{
+    m_oxX = X;
+    m_Tox = T;
+}
+
+void FlameletTable::setMassFluxes(double mdotFuel, double mdotOx)
+{
+    if (mdotFuel <= 0 || mdotOx <= 0) {
+        throw CanteraError("FlameletTable::setMassFluxes",
+                           "Mass fluxes must be positive.");
+    }
+    m_mdotFuel = mdotFuel;
+    m_mdotOx = mdotOx;
+}
+
+void FlameletTable::setWidth(double width)
+{
+    if (width <= 0) {
+        throw CanteraError("FlameletTable::setWidth", "Width must be positive.");
+    }
+    m_width = width;
+}
+
+void FlameletTable::setPressures(const vector_fp& P)
+{
+    m_pressures = P;
+}
+
+void FlameletTable::setProgressVariable(const vector<string>& species)
+{
+    auto thermo = m_workers[0].sol->thermo();
+    m_progressSpecies.clear();
+    for (const auto& name : species) {
+        size_t k = thermo->speciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("FlameletTable::setProgressVariable",
+                               "Unknown species '{}'.", name);
+        }
+        m_progressSpecies.push_back(k);
+    }
+}
+
+void FlameletTable::setMixtureFractionGrid(const vector_fp& Z)
+{
+    for (size_t m = 1; m < Z.size(); m++) {
+        if (Z[m] <= Z[m-1]) {
+            throw CanteraError("FlameletTable::setMixtureFractionGrid",
+                               "Mixture fractions must be increasing.");
+        }
+    }
+    if (Z.size() < 2) {
+        throw CanteraError("FlameletTable::setMixtureFractionGrid",
+                           "At least two mixture fractions are required.");
+    }
+    m_Z = Z;
+}
+
+void FlameletTable::setArcLength(double ds, double dsMin, double dsMax)
+{
+    if (dsMin <= 0 || ds < dsMin || dsMax < ds) {
+        throw CanteraError("FlameletTable::setArcLength",
+            "Arc lengths must satisfy 0 < dsMin <= ds <= dsMax.");
+    }
+    m_ds = ds;
+    m_dsMin = dsMin;
+    m_dsMax = dsMax;
+}
+
+void FlameletTable::setTemperatureScale(double Tscale)
+{
+    if (Tscale <= 0) {
+        throw CanteraError("FlameletTable::setTemperatureScale",
+                           "Temperature scale must be positive.");
+    }
+    m_Tscale = Tscale;
+}
+
+void FlameletTable::setExtinctionMargin(double deltaT)
+{
+    m_deltaT = deltaT;
+}
+
+void FlameletTable::setMaxFlamelets(size_t nmax)
+{
+    m_maxFlamelets = nmax;
+}
+
+void FlameletTable::setRefineCriteria(double ratio, double slope, double curve,
+                                      double prune)
+{
+    m_ratio = ratio;
+    m_slope = slope;
+    m_curve = curve;
+    m_prune = prune;
+}
+
+void FlameletTable::setMaxGridPoints(size_t npoints)
+{
+    m_maxPoints = npoints;
+}
+
+size_t FlameletTable::nFlamelets(size_t b) const
+{
+    return branch(b).Lambda.size();
+}
+
+const FlameletTable::Branch& FlameletTable::branch(size_t b) const
+{
+    if (b >= m_branches.size()) {
+        throw IndexError("FlameletTable::branch", "branches", b,
+                         m_branches.size() - 1);
+    }
+    return m_branches[b];
+}
+
+void FlameletTable::build(int loglevel)
+{
+    if (m_pressures.empty()) {
+        throw CanteraError("FlameletTable::build", "No pressures specified.");
+    }
+    if (m_progressSpecies.empty()) {
+        throw CanteraError("FlameletTable::build",
+                           "No progress variable species specified.");
+    }
+
+    // stoichiometric mixture fraction
+    auto thermo = m_workers[0].sol->thermo();
+    vector_fp Yf(m_nsp), Yo(m_nsp);
+    thermo->setState_TPX(m_Tfuel, m_pressures[0], m_fuelX);
+    thermo->getMassFractions(Yf.data());
+    thermo->setState_TPX(m_Tox, m_pressures[0], m_oxX);
+    thermo->getMassFractions(Yo.data());
+    thermo->setEquivalenceRatio(1.0, Yf.data(), Yo.data(), ThermoBasis::mass);
+    m_Zst = thermo->mixtureFraction(Yf.data(), Yo.data(), ThermoBasis::mass);
+
+    m_branches.assign(m_pressures.size(), Branch());
+    for (size_t b = 0; b < m_branches.size(); b++) {
+        m_branches[b].P = m_pressures[b];
+    }
+
+    // Each worker takes the next branch which has not been started yet, which
+    // balances the load when the computational cost varies between branches.
+    size_t nBranches = m_branches.size();
+    std::atomic<size_t> next(0);
+    std::exception_ptr error;
+    size_t errorBranch = npos;
+    std::mutex errorMutex;
+    auto work = [&](Worker& w) {
+        for (size_t b = next++; b < nBranches; b = next++) {
+            try {
+                run(w, m_branches[b], loglevel - 1);
+            } catch (...) {
+                std::unique_lock<std::mutex> lock(errorMutex);
+                if (b < errorBranch) {
+                    errorBranch = b;
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t n = 1; n < std::min(m_workers.size(), nBranches); n++) {
+        threads.emplace_back([&work, &w=m_workers[n]]() {
+            work(w);
+            thread_complete();
+        });
+    }
+    work(m_workers[0]);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    if (error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (std::exception& err) {
+            throw CanteraError("FlameletTable::build",
+                "Computation failed for branch {} (P = {} Pa):\n{}",
+                errorBranch, m_pressures[errorBranch], err.what());
+        }
+    }
+
+    if (loglevel > 0) {
+        for (const auto& b : m_branches) {
+            writelog("Branch at P = {:.6g} Pa: {} flamelets, strain factor "
+                     "up to {:.4g}, progress variable {:.4g} to {:.4g}\n",
+                     b.P, b.Lambda.size(),
+                     *std::max_element(b.strain.begin(), b.strain.end()),
+                     b.Lambda.front(), b.Lambda.back());
+        }
+    }
+}
+
+void FlameletTable::run(Worker& w, Branch& b, int loglevel)
+{
+    auto thermo = w.sol->thermo();
+    auto kin = w.sol->kinetics();
+    auto trans = w.sol->transport();
+    double P = b.P;
+    size_t nZ = m_Z.size();
+
+    // compositions and densities of the inlet streams
+    vector_fp Yf(m_nsp), Yo(m_nsp);
+    thermo->setState_TPX(m_Tfuel, P, m_fuelX);
+    thermo->getMassFractions(Yf.data());
+    double rhof = thermo->density();
+    thermo->setState_TPX(m_Tox, P, m_oxX);
+    thermo->getMassFractions(Yo.data());
+    double rhoo = thermo->density();
+
+    StFlow flow(w.sol);
+    flow.setAxisymmetricFlow();
+    flow.setPressure(P);
+    size_t nz = 10;
+    vector_fp z(nz);
+    for (size_t j = 0; j < nz; j++) {
+        z[j] = m_width * j / (nz - 1);
+    }
+    flow.setupGrid(nz, z.data());
+
+    Inlet1D fuel, ox;
+    fuel.setMoleFractions(m_fuelX);
+    fuel.setTemperature(m_Tfuel);
+    fuel.setMdot(m_mdotFuel);
+    ox.setMoleFractions(m_oxX);
+    ox.setTemperature(m_Tox);
+    ox.setMdot(m_mdotOx);
+
+    vector<Domain1D*> domains{&fuel, &flow, &ox};
+    Sim1D sim(domains);
+    sim.setMaxGridPoints(1, static_cast<int>(m_maxPoints));
+    sim.setRefineCriteria(1, m_ratio, m_slope, m_curve, m_prune);
+
+    // Initial guess assuming infinitely fast chemistry, as generated by
+    // CounterflowDiffusionFlame.set_initial_guess in the Python module
+    vector_fp Yst(m_nsp), Yeq(m_nsp), D(m_nsp);
+    for (size_t k = 0; k < m_nsp; k++) {
+        Yst[k] = m_Zst * Yf[k] + (1.0 - m_Zst) * Yo[k];
+    }
+    thermo->setState_TPY(0.5 * (m_Tfuel + m_Tox), P, Yst.data());
+    thermo->equilibrate("HP");
+    double Teq = thermo->temperature();
+    thermo->getMassFractions(Yeq.data());
+    trans->getMixDiffCoeffs(D.data());
+    size_t kO2 = thermo->speciesIndex("O2");
+    double DO2 = (kO2 != npos) ? D[kO2] : D[0];
+
+    double u0f = m_mdotFuel / rhof;
+    double u0o = m_mdotOx / rhoo;
+    double a = (u0o + u0f) / m_width;
+    double f = sqrt(a / (2.0 * DO2));
+    double L = -0.5 * (rhoo + rhof) * a * a;
+    double x0 = sqrt(m_mdotFuel * u0f) * m_width
+                / (sqrt(m_mdotFuel * u0f) + sqrt(m_mdotOx * u0o));
+    vector_fp zrel(nz), T(nz);
+    vector<vector_fp> Y(m_nsp, vector_fp(nz));
+    for (size_t j = 0; j < nz; j++) {
+        zrel[j] = z[j] / m_width;
+        double zmix = 0.5 * (1.0 - erf(f * (z[j] - x0)));
+        if (zmix > m_Zst) {
+            double r = (zmix - m_Zst) / (1.0 - m_Zst);
+            T[j] = Teq + (m_Tfuel - Teq) * r;
+            for (size_t k = 0; k < m_nsp; k++) {
+                Y[k][j] = Yeq[k] + (Yf[k] - Yeq[k]) * r;
+            }
+        } else {
+            double r = zmix / m_Zst;
+            T[j] = m_Tox + (Teq - m_Tox) * r;
+            for (size_t k = 0; k < m_nsp; k++) {
+                Y[k][j] = Yo[k] + (Yeq[k] - Yo[k]) * r;
+            }
+        }
+    }
+    T[0] = m_Tfuel;
+    T[nz-1] = m_Tox;
+    sim.setProfile(1, c_offset_U, {0.0, 1.0}, {u0f, -u0o});
+    sim.setProfile(1, c_offset_V, {0.0, x0 / m_width, 1.0}, {0.0, a, 0.0});
+    sim.setProfile(1, c_offset_L, {0.0, 1.0}, {L, L});
+    sim.setProfile(1, c_offset_T, zrel, T);
+    for (size_t k = 0; k < m_nsp; k++) {
+        sim.setProfile(1, c_offset_Y + k, zrel, Y[k]);
+    }
+
+    flow.fixTemperature();
+    sim.solve(loglevel, false);
+    flow.solveEnergyEqn();
+    sim.solve(loglevel, true);
+
+    // Interpolate the current solution onto the mixture fraction grid
+    double Tin = std::max(m_Tfuel, m_Tox);
+    vector<Flamelet> flamelets;
+    vector_fp Yj(m_nsp), wdot(m_nsp);
+    const vector_fp& mw = thermo->molecularWeights();
+    auto store = [&](double strain) {
+        // solution at the points where the mixture fraction increases
+        // monotonically, starting from the oxidizer inlet
+        vector_fp Zp, Tp, Yp, Cp, Wp;
+        size_t np = flow.nPoints();
+        for (size_t j = np; j-- > 0;) {
+            double Tj = sim.value(1, c_offset_T, j);
+            for (size_t k = 0; k < m_nsp; k++) {
+                Yj[k] = sim.value(1, c_offset_Y + k, j);
+            }
+            thermo->setState_TPY(Tj, P, Yj.data());
+            double Z = thermo->mixtureFraction(Yf.data(), Yo.data(),
+                                               ThermoBasis::mass);
+            Z = std::min(std::max(Z, 0.0), 1.0);
+            if (!Zp.empty() && Z <= Zp.back()) {
+                continue;
+            }
+            kin->getNetProductionRates(wdot.data());
+            double C = 0.0, omegaC = 0.0;
+            for (size_t k : m_progressSpecies) {
+                C += Yj[k];
+                omegaC += wdot[k] * mw[k];
+            }
+            Zp.push_back(Z);
+            Tp.push_back(Tj);
+            Cp.push_back(C);
+            Wp.push_back(omegaC);
+            Yp.insert(Yp.end(), Yj.begin(), Yj.end());
+        }
+
+        Flamelet fl;
+        fl.strain = strain;
+        fl.Tmax = *std::max_element(Tp.begin(), Tp.end());
+        fl.Lambda = linearInterp(m_Zst, Zp, Cp);
+        fl.T.resize(nZ);
+        fl.omegaC.resize(nZ);
+        fl.Y.resize(nZ * m_nsp);
+        for (size_t m = 0; m < nZ; m++) {
+            // Values outside the range of the solution are extrapolated as
+            // constants
+            size_t i = std::upper_bound(Zp.begin(), Zp.end(), m_Z[m]) - Zp.begin();
+            size_t i0 = (i == 0) ? 0 : i - 1;
+            size_t i1 = (i == Zp.size()) ? i0 : i;
+            double r = (i0 == i1) ? 0.0 : (m_Z[m] - Zp[i0]) / (Zp[i1] - Zp[i0]);
+            fl.T[m] = Tp[i0] + r * (Tp[i1] - Tp[i0]);
+            fl.omegaC[m] = Wp[i0] + r * (Wp[i1] - Wp[i0]);
+            for (size_t k = 0; k < m_nsp; k++) {
+                double y0 = Yp[i0 * m_nsp + k];
+                fl.Y[m * m_nsp + k] = y0 + r * (Yp[i1 * m_nsp + k] - y0);
+            }
+        }
+        flamelets.push_back(std::move(fl));
+        return flamelets.back().Tmax;
+    };
+
+    if (store(1.0) - Tin < m_deltaT) {
+        throw CanteraError("FlameletTable::run",
+            "The initial flamelet is extinct. Try lower mass fluxes.");
+    }
+
+    // Continue the branch in ln(s) past the extinction point. The middle
+    // branch ends either close to the inlet temperatures or at an ignition
+    // point, after which the strain factor increases again.
+    StrainFactorFunction setStrain(fuel, ox, m_mdotFuel, m_mdotOx);
+    double lambda = 0.0;
+    double tangent[2] = {1.0, 0.0};
+    double ds = m_ds;
+    bool extinct = false;
+    while (flamelets.size() < m_maxFlamelets) {
+        if (sim.arcLengthStep(lambda, tangent, ds, &setStrain, m_Tscale,
+                              loglevel)) {
+            if (tangent[0] < 0) {
+                extinct = true;
+            } else if (extinct) {
+                break;
+            }
+            if (store(exp(lambda)) - Tin < m_deltaT) {
+                break;
+            }
+            ds = std::min(1.5 * ds, m_dsMax);
+        } else {
+            ds *= 0.5;
+            if (ds < m_dsMin) {
+                break;
+            }
+        }
+    }
+
+    // Along the branch, the progress variable decreases from the burning
+    // flamelet to the extinguished flamelets. Flamelets which do not
+    // continue this trend are discarded, and the remaining flamelets are
+    // stored with increasing progress variable.
+    std::vector<const Flamelet*> kept;
+    for (const auto& fl : flamelets) {
+        if (kept.empty() || fl.Lambda < kept.back()->Lambda) {
+            kept.push_back(&fl);
+        }
+    }
+    for (auto it = kept.rbegin(); it != kept.rend(); ++it) {
+        const Flamelet& fl = **it;
+        b.Lambda.push_back(fl.Lambda);
+        b.strain.push_back(fl.strain);
+        b.Tmax.push_back(fl.Tmax);
+        b.T.insert(b.T.end(), fl.T.begin(), fl.T.end());
+        b.Y.insert(b.Y.end(), fl.Y.begin(), fl.Y.end());
+        b.omegaC.insert(b.omegaC.end(), fl.omegaC.begin(), fl.omegaC.end());
+    }
+}
+
+AnyMap FlameletTable::table() const
+{
+    auto thermo = m_workers[0].sol->thermo();
+    AnyMap out;
+    out["fuel"]["composition"] = m_fuelX;
+    out["fuel"]["temperature"] = m_Tfuel;
+    out["oxidizer"]["composition"] = m_oxX;
+    out["oxidizer"]["temperature"] = m_Tox;
+    out["species"] = thermo->speciesNames();
+    vector<string> progress;
+    for (size_t k : m_progressSpecies) {
+        progress.push_back(thermo->speciesName(k));
+    }
+    out["progress-variable"] = progress;
+    out["stoichiometric-mixture-fraction"] = m_Zst;
+    out["mixture-fraction"] = m_Z;
+    vector<AnyMap> branches;
+    for (const auto& b : m_branches) {
+        AnyMap data;
+        data["pressure"] = b.P;
+        data["progress"] = b.Lambda;
+        data["strain-factor"] = b.strain;
+        data["max-temperature"] = b.Tmax;
+        data["T"] = b.T;
+        data["Y"] = b.Y;
+        data["progress-source"] = b.omegaC;
+        branches.push_back(std::move(data));
+    }
+    out["branches"] = std::move(branches);
+    return out;
+}
+
+void FlameletTable::save(const string& fname) const
+{
+    size_t dot = fname.find_last_of(".");
+    string extension;
+    if (dot != npos) {
+        extension = toLowerCopy(fname.substr(dot+1));
+    }
+    AnyMap data = table();
+    if (extension == "yaml" || extension == "yml") {
+        std::ofstream out(fname);
+        out << data.toYamlString();
+    } else {
+        std::ofstream out(fname, std::ios::binary);
+        out << data.toBinaryString();
+    }
+}
+
+}
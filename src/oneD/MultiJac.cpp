@@ -11,8 +11,11 @@ using namespace std;
 namespace Cantera
 {
 
-MultiJac::MultiJac(OneDim& r)
-    : BandMatrix(r.size(),r.bandwidth(),r.bandwidth())
+MultiJac::MultiJac(OneDim& r, bool sparse)
+    : BandMatrix(r.size(), sparse ? 0 : r.bandwidth(), sparse ? 0 : r.bandwidth())
+    , m_sparse(sparse)
+    , m_nnz_analyzed(npos)
+    , m_npatterns(0)
 {
     m_size = r.size();
     m_points = r.points();
@@ -20,11 +23,136 @@ MultiJac::MultiJac(OneDim& r)
     m_r1.resize(m_size);
     m_ssdiag.resize(m_size);
     m_mask.resize(m_size);
+    m_xsave.resize(m_points);
     m_elapsed = 0.0;
     m_nevals = 0;
     m_age = 100000;
     m_atol = sqrt(std::numeric_limits<double>::epsilon());
     m_rtol = 1.0e-5;
+    if (m_sparse) {
+        m_mat.resize(m_size, m_size);
+    }
+}
+
+double& MultiJac::value(size_t i, size_t j)
+{
+    if (m_sparse) {
+        m_factored = false;
+        double* v = sparseElement(i, j);
+        if (v) {
+            return *v;
+        }
+        return m_pending[{i, j}];
+    }
+    return BandMatrix::value(i, j);
+}
+
+double MultiJac::value(size_t i, size_t j) const
+{
+    if (m_sparse) {
+        const double* v = const_cast<MultiJac*>(this)->sparseElement(i, j);
+        if (v) {
+            return *v;
+        }
+        auto iter = m_pending.find({i, j});
+        return (iter != m_pending.end()) ? iter->second : 0.0;
+    }
+    return BandMatrix::value(i, j);
+}
+
+double* MultiJac::sparseElement(size_t i, size_t j)
+{
+    const int* rows = m_mat.innerIndexPtr();
+    const int* begin = rows + m_mat.outerIndexPtr()[j];
+    const int* end = rows + m_mat.outerIndexPtr()[j + 1];
+    const int* p = std::lower_bound(begin, end, static_cast<int>(i));
+    if (p != end && *p == static_cast<int>(i)) {
+        return m_mat.valuePtr() + (p - rows);
+    }
+    return nullptr;
+}
+
+void MultiJac::updatePattern()
+{
+    for (const auto& item : m_pending) {
+        m_trips.emplace_back(static_cast<int>(item.first.first),
+                             static_cast<int>(item.first.second), item.second);
+    }
+    m_pending.clear();
+
+    if (m_trips.empty() && m_mat.nonZeros() != 0) {
+        return;
+    }
+    for (int k = 0; k < m_mat.outerSize(); k++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(m_mat, k); it; ++it) {
+            m_trips.emplace_back(it.row(), it.col(), it.value());
+        }
+    }
+    for (size_t n = 0; n < m_size; n++) {
+        m_trips.emplace_back(static_cast<int>(n), static_cast<int>(n), 0.0);
+    }
+    m_mat.setFromTriplets(m_trips.begin(), m_trips.end());
+    m_trips.clear();
+}
+
+void MultiJac::zero()
+{
+    if (m_sparse) {
+        m_mat.coeffs().setZero();
+        m_pending.clear();
+        m_factored = false;
+    } else {
+        BandMatrix::zero();
+    }
+}
+
+int MultiJac::factor()
+{
+    if (!m_sparse) {
+        return BandMatrix::factor();
+    }
+    if (!m_pending.empty()) {
+        updatePattern();
+    }
+    if (static_cast<size_t>(m_mat.nonZeros()) != m_nnz_analyzed) {
+        m_solver.analyzePattern(m_mat);
+        m_nnz_analyzed = m_mat.nonZeros();
+        m_npatterns++;
+    }
+    m_solver.factorize(m_mat);
+    if (m_solver.info() != Eigen::Success) {
+        m_info = -1;
+        throw CanteraError("MultiJac::factor",
+            "Sparse LU factorization failed:\n{}", m_solver.lastErrorMessage());
+    }
+    m_info = 0;
+    m_factored = true;
+    return m_info;
+}
+
+int MultiJac::solve(double* b, size_t nrhs, size_t ldb)
+{
+    if (!m_sparse) {
+        return BandMatrix::solve(b, nrhs, ldb);
+    }
+    if (!m_factored) {
+        factor();
+    }
+    if (ldb == 0) {
+        ldb = m_size;
+    }
+    for (size_t n = 0; n < nrhs; n++) {
+        Eigen::Map<Eigen::VectorXd> x(b + n * ldb, m_size);
+        Eigen::VectorXd rhs = x;
+        x = m_solver.solve(rhs);
+        if (m_solver.info() != Eigen::Success) {
+            m_info = -1;
+            throw CanteraError("MultiJac::solve",
+                "Sparse LU solve failed with error code {}.", m_solver.info());
+        }
+    }
+    m_info = 0;
+    return m_info;
 }
 
 void MultiJac::updateTransient(doublereal rdt, integer* mask)
@@ -40,44 +168,133 @@ void MultiJac::incrementDiagonal(int j, doublereal d)
     value(j,j) = m_ssdiag[j];
 }
 
+void MultiJac::setSparseColumn(size_t j, size_t ipt, const double* resid0,
+                               double rdx)
+{
+    // rows of the residual which depend on the solution at point j
+    size_t rowStart = m_resid->loc(j > 0 ? j - 1 : j);
+    size_t jEnd = std::min(j + 1, m_points - 1);
+    size_t rowEnd = m_resid->loc(jEnd) + m_resid->nVars(jEnd);
+
+    // The rows of the pattern in each column are sorted
+    const int* rows = m_mat.innerIndexPtr();
+    double* values = m_mat.valuePtr();
+    int p = m_mat.outerIndexPtr()[ipt];
+    int pEnd = m_mat.outerIndexPtr()[ipt + 1];
+    for (size_t i = rowStart; i < rowEnd; i++) {
+        double dfdx = (m_r1[i] - resid0[i]) * rdx;
+        while (p < pEnd && rows[p] < static_cast<int>(i)) {
+            p++;
+        }
+        if (p < pEnd && rows[p] == static_cast<int>(i)) {
+            values[p] = dfdx;
+        } else if (dfdx != 0.0) {
+            m_trips.emplace_back(static_cast<int>(i), static_cast<int>(ipt), dfdx);
+        }
+    }
+}
+
 void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
 {
     m_nevals++;
     clock_t t0 = clock();
-    bfill(0.0);
-    size_t ipt=0;
+    if (m_sparse) {
+        // Values are stored directly in the existing sparsity pattern. Elements
+        // outside of it are collected in m_trips and m_pending.
+        m_mat.coeffs().setZero();
+        m_trips.clear();
+        m_pending.clear();
+    } else {
+        bfill(0.0);
+    }
 
+    // The residual at each grid point depends only on the solution at that
+    // point and its immediate neighbors, so the columns for grid points which
+    // are at least three points apart have no nonzero rows in common. Each of
+    // these groups of points is perturbed at once, which requires only one
+    // residual evaluation per solution component in each group.
+    for (size_t i = 0; i < m_resid->nDomains(); i++) {
+        m_resid->domain(i).setColoredJacobian(true);
+    }
+    size_t nvmax = 0;
     for (size_t j = 0; j < m_points; j++) {
-        size_t nv = m_resid->nVars(j);
-        for (size_t n = 0; n < nv; n++) {
-            // perturb x(n); preserve sign(x(n))
-            double xsave = x0[ipt];
-            double dx;
-            if (xsave >= 0) {
-                dx = xsave*m_rtol + m_atol;
-            } else {
-                dx = xsave*m_rtol - m_atol;
-            }
-            x0[ipt] = xsave + dx;
-            dx = x0[ipt] - xsave;
-            double rdx = 1.0/dx;
-
-            // calculate perturbed residual
-            m_resid->eval(j, x0, m_r1.data(), rdt, 0);
-
-            // compute nth column of Jacobian
-            for (size_t i = j - 1; i != j+2; i++) {
-                if (i != npos && i < m_points) {
-                    size_t mv = m_resid->nVars(i);
-                    size_t iloc = m_resid->loc(i);
-                    for (size_t m = 0; m < mv; m++) {
-                        value(m+iloc,ipt) = (m_r1[m+iloc] - resid0[m+iloc])*rdx;
+        nvmax = std::max(nvmax, m_resid->nVars(j));
+    }
+
+    try {
+        for (size_t color = 0; color < 3; color++) {
+            for (size_t n = 0; n < nvmax; n++) {
+                bool perturbed = false;
+                for (size_t j = color; j < m_points; j += 3) {
+                    if (n >= m_resid->nVars(j)) {
+                        continue;
+                    }
+                    // perturb x(n); preserve sign(x(n))
+                    size_t ipt = m_resid->loc(j) + n;
+                    double xsave = x0[ipt];
+                    m_xsave[j] = xsave;
+                    if (xsave >= 0) {
+                        x0[ipt] = xsave + xsave*m_rtol + m_atol;
+                    } else {
+                        x0[ipt] = xsave + xsave*m_rtol - m_atol;
+                    }
+                    perturbed = true;
+                }
+                if (!perturbed) {
+                    continue;
+                }
+
+                // calculate perturbed residual
+                m_resid->eval(npos, x0, m_r1.data(), rdt, 0);
+
+                for (size_t j = color; j < m_points; j += 3) {
+                    if (n >= m_resid->nVars(j)) {
+                        continue;
+                    }
+                    size_t ipt = m_resid->loc(j) + n;
+                    double rdx = 1.0/(x0[ipt] - m_xsave[j]);
+
+                    // compute nth column of Jacobian for point j
+                    if (m_sparse) {
+                        setSparseColumn(j, ipt, resid0, rdx);
+                        x0[ipt] = m_xsave[j];
+                        continue;
                     }
+                    for (size_t i = j - 1; i != j+2; i++) {
+                        if (i != npos && i < m_points) {
+                            size_t mv = m_resid->nVars(i);
+                            size_t iloc = m_resid->loc(i);
+                            for (size_t m = 0; m < mv; m++) {
+                                value(m+iloc,ipt) = (m_r1[m+iloc] - resid0[m+iloc])*rdx;
+                            }
+                        }
+                    }
+                    x0[ipt] = m_xsave[j];
                 }
             }
-            x0[ipt] = xsave;
-            ipt++;
         }
+    } catch (...) {
+        for (size_t i = 0; i < m_resid->nDomains(); i++) {
+            m_resid->domain(i).setColoredJacobian(false);
+        }
+        throw;
+    }
+
+    for (size_t i = 0; i < m_resid->nDomains(); i++) {
+        m_resid->domain(i).setColoredJacobian(false);
+    }
+
+    // add terms evaluated analytically by individual domains
+    for (size_t i = 0; i < m_resid->nDomains(); i++) {
+        m_resid->domain(i).evalJacobian(x0, *this);
+    }
+
+    if (m_sparse) {
+        if (m_mat.nonZeros() == 0 || !m_trips.empty() || !m_pending.empty()) {
+            // extend the sparsity pattern by the new nonzero elements
+            updatePattern();
+        }
+        m_factored = false;
     }
 
     for (size_t n = 0; n < m_size; n++) {
@@ -122,6 +122,32 @@ doublereal norm_square(const doublereal* x,
     return sum;
 }
 
+/**
+ * Compute the inverse squares of the error weights \f$ w_n \f$ defined for
+ * norm_square() for all components of one domain.
+ *
+ * @param x     Solution vector for this domain.
+ * @param r     Object representing the domain.
+ * @param[out] wt  Array of length `r.size()` containing \f$ 1/w_n^2 \f$ for
+ *              each solution component at each point.
+ */
+void inverse_square_weights(const double* x, Domain1D& r, double* wt)
+{
+    size_t nv = r.nComponents();
+    size_t np = r.nPoints();
+
+    for (size_t n = 0; n < nv; n++) {
+        double esum = 0.0;
+        for (size_t j = 0; j < np; j++) {
+            esum += fabs(x[nv*j + n]);
+        }
+        double ewt = r.rtol(n)*esum/np + r.atol(n);
+        for (size_t j = 0; j < np; j++) {
+            wt[nv*j + n] = 1.0 / (ewt*ewt);
+        }
+    }
+}
+
 } // end unnamed-namespace
 
 
@@ -133,6 +159,8 @@ const size_t NDAMP = 7;
 
 MultiNewton::MultiNewton(int sz)
     : m_maxAge(5)
+    , m_maxBroyden(0)
+    , m_nBroyden(0)
 {
     m_n = sz;
     m_elapsed = 0.0;
@@ -144,6 +172,8 @@ void MultiNewton::resize(size_t sz)
     m_x.resize(m_n);
     m_stp.resize(m_n);
     m_stp1.resize(m_n);
+    m_broydenU.clear();
+    m_broydenV.clear();
 }
 
 doublereal MultiNewton::norm2(const doublereal* x,
@@ -191,6 +221,61 @@ void MultiNewton::step(doublereal* x, doublereal* step,
         }
         throw;
     }
+
+    if (m_maxBroyden) {
+        m_g.assign(step, step + m_n);
+        applyBroyden(step);
+    }
+}
+
+void MultiNewton::applyBroyden(double* s) const
+{
+    for (size_t k = 0; k < m_broydenU.size(); k++) {
+        const vector_fp& u = m_broydenU[k];
+        const vector_fp& v = m_broydenV[k];
+        double vs = 0.0;
+        for (size_t i = 0; i < m_n; i++) {
+            vs += v[i] * s[i];
+        }
+        for (size_t i = 0; i < m_n; i++) {
+            s[i] += vs * u[i];
+        }
+    }
+}
+
+void MultiNewton::updateBroyden(const double* x0, const double* x1, OneDim& r)
+{
+    // Weighted step v = W (x1 - x0), where W contains the inverse squares of the
+    // error weights, and the change of the Newton step, which is the change of
+    // the residual multiplied by the inverse of the Jacobian.
+    vector_fp wt(m_n), u(m_n), v(m_n);
+    for (size_t n = 0; n < r.nDomains(); n++) {
+        inverse_square_weights(x0 + r.start(n), r.domain(n), &wt[r.start(n)]);
+    }
+    for (size_t i = 0; i < m_n; i++) {
+        u[i] = m_g0[i] - m_g[i];
+    }
+    applyBroyden(u.data());
+
+    // The update satisfies H_{k+1} y = s if u = (s - H_k y) / (v^T H_k y)
+    double vz = 0.0, ss = 0.0, zz = 0.0;
+    for (size_t i = 0; i < m_n; i++) {
+        double s = x1[i] - x0[i];
+        v[i] = wt[i] * s;
+        vz += v[i] * u[i];
+        ss += v[i] * s;
+        zz += wt[i] * u[i] * u[i];
+    }
+    if (!std::isfinite(vz) || std::abs(vz) <= 1e-4 * sqrt(ss * zz)) {
+        // skip updates which would be ill-conditioned
+        return;
+    }
+    for (size_t i = 0; i < m_n; i++) {
+        u[i] = (x1[i] - x0[i] - u[i]) / vz;
+    }
+    m_broydenU.push_back(std::move(u));
+    m_broydenV.push_back(std::move(v));
+    m_nBroyden++;
 }
 
 doublereal MultiNewton::boundStep(const doublereal* x0,
@@ -300,6 +385,8 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
     doublereal rdt = r.rdt();
     int j0 = jac.nEvals();
     int nJacReeval = 0;
+    m_broydenU.clear();
+    m_broydenV.clear();
 
     while (true) {
         // Check whether the Jacobian should be re-evaluated.
@@ -315,10 +402,15 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
             jac.eval(&m_x[0], &m_stp[0], 0.0);
             jac.updateTransient(rdt, r.transientMask().data());
             forceNewJac = false;
+            m_broydenU.clear();
+            m_broydenV.clear();
         }
 
         // compute the undamped Newton step
         step(&m_x[0], &m_stp[0], r, jac, loglevel-1);
+        if (m_maxBroyden) {
+            m_g0 = m_g;
+        }
 
         // increment the Jacobian age
         jac.incrementAge();
@@ -340,6 +432,9 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
         // Successful step, but not converged yet. Take the damped step, and try
         // again.
         if (m == 0) {
+            if (m_broydenU.size() < m_maxBroyden) {
+                updateBroyden(&m_x[0], x1, r);
+            }
             copy(x1, x1 + m_n, m_x.begin());
         } else if (m == 1) {
             // convergence
@@ -18,7 +18,7 @@ namespace Cantera
 
 OneDim::OneDim()
     : m_tmin(1.0e-16), m_tmax(1e8), m_tfactor(0.5),
-      m_rdt(0.0), m_jac_ok(false),
+      m_rdt(0.0), m_jac_ok(false), m_sparse_jac(false),
       m_bw(0), m_size(0),
       m_init(false), m_pts(0),
       m_ss_jac_age(20), m_ts_jac_age(20),
@@ -31,7 +31,7 @@ OneDim::OneDim()
 
 OneDim::OneDim(vector<Domain1D*> domains) :
     m_tmin(1.0e-16), m_tmax(1e8), m_tfactor(0.5),
-    m_rdt(0.0), m_jac_ok(false),
+    m_rdt(0.0), m_jac_ok(false), m_sparse_jac(false),
     m_bw(0), m_size(0),
     m_init(false),
     m_ss_jac_age(20), m_ts_jac_age(20),
@@ -117,6 +117,17 @@ void OneDim::setJacAge(int ss_age, int ts_age)
     }
 }
 
+void OneDim::setSparseJacobian(bool sparse)
+{
+    if (sparse != m_sparse_jac) {
+        m_sparse_jac = sparse;
+        if (m_jac) {
+            // replace the current Jacobian evaluator
+            resize();
+        }
+    }
+}
+
 void OneDim::writeStats(int printTime)
 {
     saveStats();
@@ -213,7 +224,7 @@ void OneDim::resize()
     m_mask.resize(size());
 
     // delete the current Jacobian evaluator and create a new one
-    m_jac.reset(new MultiJac(*this));
+    m_jac.reset(new MultiJac(*this, m_sparse_jac));
     m_jac_ok = false;
 
     for (size_t i = 0; i < nDomains(); i++) {
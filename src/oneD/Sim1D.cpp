@@ -23,7 +23,8 @@ namespace Cantera
 
 Sim1D::Sim1D(vector<Domain1D*>& domains) :
     OneDim(domains),
-    m_steady_callback(0)
+    m_steady_callback(0),
+    m_continuation_broyden(10)
 {
     // resize the internal solution vector and the work array, and perform
     // domain-specific initialization of the solution vector.
@@ -93,9 +94,136 @@ void Sim1D::setProfile(size_t dom, size_t comp,
     }
 }
 
+namespace { // helpers for binary solution containers
+
+// Identifies solution containers written by Sim1D::save(). The last character
+// is the format version.
+const char containerMagic[8] = {'C', 'T', 'S', 'O', 'L', 'N', '\0', '\1'};
+
+bool isBinaryContainer(const std::string& fname)
+{
+    size_t dot = fname.find_last_of(".");
+    return dot != npos && toLowerCopy(fname.substr(dot+1)) == "ctsol";
+}
+
+void checkContainer(std::istream& in, const std::string& fname,
+                    const std::string& method)
+{
+    char magic[sizeof(containerMagic)] = {};
+    in.read(magic, sizeof(magic));
+    if (!in || !std::equal(magic, magic + sizeof(magic), containerMagic)) {
+        throw CanteraError(method, "File '{}' is not a binary solution "
+                           "container.", fname);
+    }
+}
+
+// Append a solution to a container, creating the container if necessary.
+// Each record consists of the length of the id, the id, the length of the
+// serialized solution, and the solution in the format generated by
+// AnyMap::toBinaryString(). A record supersedes any earlier records with the
+// same id, so existing data never needs to be rewritten.
+void appendSolution(const std::string& fname, const std::string& id,
+                    const AnyMap& solution)
+{
+    std::string payload = solution.toBinaryString();
+    std::ifstream in(fname, std::ios::binary);
+    bool exists = in.good();
+    if (exists) {
+        checkContainer(in, fname, "Sim1D::save");
+    }
+    in.close();
+
+    std::ofstream out(fname, std::ios::binary | std::ios::app);
+    if (!exists) {
+        out.write(containerMagic, sizeof(containerMagic));
+    }
+    uint64_t n = id.size();
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(id.data(), id.size());
+    n = payload.size();
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(payload.data(), payload.size());
+    if (!out) {
+        throw CanteraError("Sim1D::save", "Error writing to file '{}'.", fname);
+    }
+}
+
+// Read the most recent solution with the given id from a container. Only the
+// record headers are scanned; the other solutions are skipped without being
+// read.
+AnyMap readSolution(const std::string& fname, const std::string& id)
+{
+    std::string path = findInputFile(fname);
+    std::ifstream in(path, std::ios::binary);
+    checkContainer(in, path, "Sim1D::restore");
+    in.seekg(0, std::ios::end);
+    uint64_t size = static_cast<uint64_t>(in.tellg());
+    in.seekg(sizeof(containerMagic));
+
+    uint64_t pos = size;
+    uint64_t length = 0;
+    std::string key;
+    while (true) {
+        uint64_t n;
+        if (!in.read(reinterpret_cast<char*>(&n), sizeof(n))) {
+            break;
+        }
+        if (n > size - static_cast<uint64_t>(in.tellg())) {
+            throw CanteraError("Sim1D::restore", "Corrupted data in binary "
+                               "solution container '{}'.", path);
+        }
+        key.resize(n);
+        in.read(&key[0], n);
+        if (!in.read(reinterpret_cast<char*>(&n), sizeof(n))
+            || n > size - static_cast<uint64_t>(in.tellg()))
+        {
+            throw CanteraError("Sim1D::restore", "Corrupted data in binary "
+                               "solution container '{}'.", path);
+        }
+        if (key == id) {
+            pos = in.tellg();
+            length = n;
+        }
+        in.seekg(n, std::ios::cur);
+    }
+    if (pos == size) {
+        throw CanteraError("Sim1D::restore", "No solution with id '{}' in "
+                           "file '{}'", id, path);
+    }
+    in.clear();
+    in.seekg(pos);
+    std::string payload(length, '\0');
+    in.read(&payload[0], length);
+    return AnyMap::fromBinaryString(payload);
+}
+
+} // end anonymous namespace
+
 void Sim1D::save(const std::string& fname, const std::string& id,
                  const std::string& desc, int loglevel)
 {
+    AnyMap solution = serialize(m_x.data());
+
+    // Add metadata
+    solution["description"] = desc;
+    solution["generator"] = "Cantera Sim1D";
+    solution["cantera-version"] = CANTERA_VERSION;
+    solution["git-commit"] = gitCommit();
+
+    // Add a timestamp indicating the current time
+    time_t aclock;
+    ::time(&aclock); // Get time in seconds
+    struct tm* newtime = localtime(&aclock); // Convert time to struct tm form
+    solution["date"] = stripnonprint(asctime(newtime));
+
+    if (isBinaryContainer(fname)) {
+        appendSolution(fname, id, solution);
+        if (loglevel > 0) {
+            writelog("Solution saved to file {} as solution '{}'.\n", fname, id);
+        }
+        return;
+    }
+
     // Check for an existing file and load it if present
     AnyMap data;
     if (ifstream(fname).good()) {
@@ -104,19 +232,7 @@ void Sim1D::save(const std::string& fname, const std::string& id,
     bool preexisting = data.hasKey(id);
 
     // Add this simulation to the YAML
-    data[id] = serialize(m_x.data());
-
-    // Add metadata
-    data[id]["description"] = desc;
-    data[id]["generator"] = "Cantera Sim1D";
-    data[id]["cantera-version"] = CANTERA_VERSION;
-    data[id]["git-commit"] = gitCommit();
-
-    // Add a timestamp indicating the current time
-    time_t aclock;
-    ::time(&aclock); // Get time in seconds
-    struct tm* newtime = localtime(&aclock); // Convert time to struct tm form
-    data[id]["date"] = stripnonprint(asctime(newtime));
+    data[id] = std::move(solution);
 
     // Force metadata fields to the top of the file
     data[id]["description"].setLoc(-6, 0);
@@ -160,12 +276,17 @@ void Sim1D::restore(const std::string& fname, const std::string& id,
         throw CanteraError("Sim1D::restore",
                            "Restoring from XML is no longer supported.");
     }
-    AnyMap root = AnyMap::fromYamlFile(fname);
-    if (!root.hasKey(id)) {
-        throw InputFileError("Sim1D::restore", root,
-                                "No solution with id '{}'", id);
+    AnyMap state;
+    if (isBinaryContainer(fname)) {
+        state = readSolution(fname, id);
+    } else {
+        AnyMap root = AnyMap::fromYamlFile(fname);
+        if (!root.hasKey(id)) {
+            throw InputFileError("Sim1D::restore", root,
+                                    "No solution with id '{}'", id);
+        }
+        state = root[id].as<AnyMap>();
     }
-    const auto& state = root[id];
     for (auto dom : m_dom) {
         if (!state.hasKey(dom->id())) {
             throw InputFileError("Sim1D::restore", state,
@@ -384,6 +505,277 @@ void Sim1D::solve(int loglevel, bool refine_grid)
     }
 }
 
+size_t Sim1D::solveContinuation(const vector_fp& values, Func1* setParameter,
+                                Func1* callback, int loglevel, bool refine_grid)
+{
+    if (!setParameter) {
+        throw CanteraError("Sim1D::solveContinuation",
+                           "No function for setting the parameter specified.");
+    }
+    size_t nmax_save = newton().broydenUpdates();
+    newton().setBroydenUpdates(m_continuation_broyden);
+    size_t nsaved = 0;
+    try {
+        for (double value : values) {
+            setParameter->eval(value);
+            if (loglevel > 0) {
+                writelog("\nContinuation: solving for parameter value {}\n", value);
+            }
+            if (m_jac_ok) {
+                // Changing the parameter marks the Jacobian as out of date.
+                // Instead, continue using the Jacobian of the previous solution.
+                // With an age of one, a failure of the Newton iteration leads to
+                // the evaluation of a new Jacobian.
+                finalize();
+                m_jac->setAge(1);
+                setSteadyMode();
+                newton().setOptions(m_ss_jac_age);
+                int nev = m_jac->nEvals();
+                MultiJac* jac = m_jac.get();
+                if (newtonSolve(loglevel-1) == 0 && m_jac.get() == jac
+                    && m_jac->nEvals() == nev) {
+                    nsaved++;
+                }
+            }
+            solve(loglevel, refine_grid);
+            if (callback) {
+                callback->eval(value);
+            }
+        }
+    } catch (...) {
+        newton().setBroydenUpdates(nmax_save);
+        throw;
+    }
+    newton().setBroydenUpdates(nmax_save);
+    if (loglevel > 0) {
+        writelog("\nContinuation: {} of {} parameter values solved without "
+                 "evaluating a new Jacobian.\n", nsaved, values.size());
+    }
+    return nsaved;
+}
+
+bool Sim1D::arcLengthStep(double& param, double* tangent, double ds,
+                          Func1* setParameter, double Tscale, int loglevel,
+                          bool refine_grid)
+{
+    if (!setParameter) {
+        throw CanteraError("Sim1D::arcLengthStep",
+                           "No function for setting the parameter specified.");
+    }
+    // save the current state, which is restored if the step fails
+    vector_fp x0 = m_x;
+    std::vector<vector_fp> grid0;
+    for (size_t n = 0; n < nDomains(); n++) {
+        grid0.push_back(domain(n).grid());
+    }
+    double p0 = param;
+    double theta0 = maxTemperature() / Tscale;
+
+    // Starting from the current solution, the first Newton iteration of the
+    // corrector is the tangent predictor.
+    double p = p0;
+    bool ok = false;
+    bool regridded = false;
+    try {
+        ok = arcLengthCorrector(p, p0, theta0, tangent, ds, setParameter,
+                                Tscale, loglevel);
+        while (ok && refine_grid) {
+            if (refine(loglevel - 1) <= 0) {
+                break;
+            }
+            regridded = true;
+            ok = arcLengthCorrector(p, p0, theta0, tangent, ds, setParameter,
+                                    Tscale, loglevel);
+        }
+    } catch (CanteraError& err) {
+        if (loglevel > 0) {
+            writelog("\nArc-length step failed:\n{}\n", err.getMessage());
+        }
+        ok = false;
+    }
+
+    if (!ok) {
+        if (regridded) {
+            for (size_t n = 0; n < nDomains(); n++) {
+                domain(n).setupGrid(grid0[n].size(), grid0[n].data());
+            }
+            m_x = x0;
+            resize();
+            finalize();
+        } else {
+            m_x = x0;
+        }
+        setParameter->eval(p0);
+        return false;
+    }
+
+    // update the tangent using the secant through the old and new solutions
+    double dp = p - p0;
+    double dtheta = maxTemperature() / Tscale - theta0;
+    double norm = sqrt(dp * dp + dtheta * dtheta);
+    tangent[0] = dp / norm;
+    tangent[1] = dtheta / norm;
+    param = p;
+    if (loglevel > 0) {
+        writelog("\nArc-length step: parameter = {:.6g}, maximum temperature = {:.6g} K\n",
+                 param, maxTemperature());
+    }
+    return true;
+}
+
+bool Sim1D::arcLengthCorrector(double& param, double p0, double theta0,
+                               const double* tangent, double ds,
+                               Func1* setParameter, double Tscale, int loglevel)
+{
+    size_t n = size();
+    vector_fp r(n), dFdp(n), wt(n);
+
+    // Compute the undamped Newton step (dx, dp) of the augmented system at
+    // (x, p) using the current Jacobian, and return its weighted norm
+    auto computeStep = [&](vector_fp& x, double p, vector_fp& dx,
+                           double& dp) {
+        setParameter->eval(p);
+        OneDim::eval(npos, x.data(), r.data(), 0.0, 0);
+
+        // derivative of the residual with respect to the parameter
+        double delta = 1e-6 * std::max(std::abs(p), 1.0);
+        setParameter->eval(p + delta);
+        OneDim::eval(npos, x.data(), dFdp.data(), 0.0, 0);
+        setParameter->eval(p);
+        for (size_t i = 0; i < n; i++) {
+            dFdp[i] = (dFdp[i] - r[i]) / delta;
+            dx[i] = -r[i];
+        }
+
+        // Block elimination for the augmented system
+        //     [ J    dF/dp ] [dx]     [F]
+        //     [ c^T  t_p   ] [dp] = - [N]
+        // where N is the arc length condition and c = dN/dx.
+        m_jac->solve(dx.data(), dx.data());
+        m_jac->solve(dFdp.data(), dFdp.data());
+        double theta = maxTemperature(x.data(), wt.data()) / Tscale;
+        double N = tangent[0] * (p - p0) + tangent[1] * (theta - theta0) - ds;
+        double cy = 0.0, cz = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            cy += wt[i] * dx[i];
+            cz += wt[i] * dFdp[i];
+        }
+        cy *= tangent[1] / Tscale;
+        cz *= tangent[1] / Tscale;
+        dp = (-N - cy) / (tangent[0] - cz);
+        for (size_t i = 0; i < n; i++) {
+            dx[i] -= dFdp[i] * dp;
+        }
+        return newton().norm2(x.data(), dx.data(), *this);
+    };
+
+    auto evalJacobian = [&](vector_fp& x, double p) {
+        setParameter->eval(p);
+        OneDim::eval(npos, x.data(), r.data(), 0.0, 0);
+        m_jac->eval(x.data(), r.data(), 0.0);
+    };
+
+    // Damped Newton iteration, following MultiNewton::solve
+    setSteadyMode();
+    vector_fp x = m_x, x1(n), dx(n), dx1(n);
+    double p = param, p1, dp, dp1;
+    evalJacobian(x, p);
+    bool newJac = true;
+    double s0 = computeStep(x, p, dx, dp);
+    for (int iter = 0; iter < 20; iter++) {
+        double fbound = std::min(
+            newton().boundStep(x.data(), dx.data(), *this, loglevel-1), 1.0);
+        if (fbound < 1e-10) {
+            debuglog("\nArc-length corrector: at limits.\n", loglevel);
+            return false;
+        }
+
+        // find a damping coefficient which reduces the norm of the next step
+        double damp = 1.0, s1 = 0.0;
+        bool accepted = false;
+        for (int m = 0; m < 7; m++) {
+            double ff = fbound * damp;
+            for (size_t i = 0; i < n; i++) {
+                x1[i] = x[i] + ff * dx[i];
+            }
+            p1 = p + ff * dp;
+            s1 = computeStep(x1, p1, dx1, dp1);
+            if (loglevel > 1) {
+                writelog("\n    {:2d}  parameter = {:12.6g}  log10(s0) = {:8.4f}  "
+                         "log10(s1) = {:8.4f}  F_damp = {:8.5f}", iter, p1,
+                         log10(s0 + SmallNumber), log10(s1 + SmallNumber), ff);
+            }
+            if (s1 < 1.0 || s1 < s0) {
+                accepted = true;
+                break;
+            }
+            damp /= sqrt(2.0);
+        }
+
+        if (!accepted) {
+            if (newJac) {
+                debuglog("\nArc-length corrector failed.\n", loglevel);
+                return false;
+            }
+            // try again with a new Jacobian
+            evalJacobian(x, p);
+            newJac = true;
+            s0 = computeStep(x, p, dx, dp);
+            continue;
+        }
+
+        x.swap(x1);
+        dx.swap(dx1);
+        p = p1;
+        dp = dp1;
+        if (s1 < 1.0) {
+            m_x = x;
+            param = p;
+            setParameter->eval(p);
+            return true;
+        }
+        if (s1 > 0.5 * s0) {
+            // slow convergence with the current Jacobian
+            evalJacobian(x, p);
+            newJac = true;
+            s0 = computeStep(x, p, dx, dp);
+        } else {
+            newJac = false;
+            s0 = s1;
+        }
+    }
+    debuglog("\nArc-length corrector did not converge.\n", loglevel);
+    return false;
+}
+
+double Sim1D::maxTemperature(const double* x, double* weights)
+{
+    double Tmax = -BigNumber;
+    size_t imax = npos;
+    for (size_t n = 0; n < nDomains(); n++) {
+        StFlow* flow = dynamic_cast<StFlow*>(&domain(n));
+        if (!flow) {
+            continue;
+        }
+        size_t nv = flow->nComponents();
+        for (size_t j = 0; j < flow->nPoints(); j++) {
+            size_t i = start(n) + nv*j + c_offset_T;
+            if (x[i] > Tmax) {
+                Tmax = x[i];
+                imax = i;
+            }
+        }
+    }
+    if (imax == npos) {
+        throw CanteraError("Sim1D::maxTemperature", "No flow domains found.");
+    }
+    if (weights) {
+        std::fill(weights, weights + size(), 0.0);
+        weights[imax] = 1.0;
+    }
+    return Tmax;
+}
+
 int Sim1D::refine(int loglevel)
 {
     int ianalyze, np = 0;
@@ -451,6 +843,13 @@ int Sim1D::refine(int loglevel)
         dsize.push_back(znew.size() - nstart);
     }
 
+    if (np == 0 && xnew.size() == m_x.size()) {
+        // The grid is unchanged, so the Jacobian of the current solution can
+        // still be used, for example by solveContinuation().
+        finalize();
+        return 0;
+    }
+
     // At this point, the new grid znew and the new solution vector xnew have
     // been constructed, but the domains themselves have not yet been modified.
     // Now update each domain with the new grid.
@@ -663,6 +1062,18 @@ void Sim1D::solveAdjoint(const double* b, double* lambda)
         D->forceFullUpdate(false);
     }
 
+    if (m_jac->sparse()) {
+        Eigen::SparseMatrix<double> Jt = m_jac->sparseMatrix().transpose();
+        Eigen::SparseLU<Eigen::SparseMatrix<double>> solver(Jt);
+        if (solver.info() != Eigen::Success) {
+            throw CanteraError("Sim1D::solveAdjoint",
+                "Sparse LU factorization failed:\n{}", solver.lastErrorMessage());
+        }
+        Eigen::Map<const Eigen::VectorXd> bVec(b, size());
+        Eigen::Map<Eigen::VectorXd>(lambda, size()) = solver.solve(bVec);
+        return;
+    }
+
     // Form J^T
     size_t bw = bandwidth();
     BandMatrix Jt(size(), bw, bw);
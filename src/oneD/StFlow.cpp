@@ -5,6 +5,7 @@
 
 #include "cantera/oneD/StFlow.h"
 #include "cantera/oneD/refine.h"
+#include "cantera/oneD/MultiJac.h"
 #include "cantera/transport/Transport.h"
 #include "cantera/numerics/funcs.h"
 #include "cantera/base/global.h"
@@ -28,6 +29,8 @@ StFlow::StFlow(ThermoPhase* ph, size_t nsp, size_t points) :
     m_do_soret(false),
     m_do_multicomponent(false),
     m_do_radiation(false),
+    m_analytic_chem_jac(false),
+    m_freeze_chem(false),
     m_kExcessLeft(0),
     m_kExcessRight(0),
     m_zfixed(Undef),
@@ -309,8 +312,76 @@ void StFlow::eval(size_t jg, doublereal* xg,
         jmax = std::min(jpt+1,m_points-1);
     }
 
+    // when the chemistry Jacobian is evaluated analytically, the production
+    // rates computed for the unperturbed solution are reused
+    m_freeze_chem = ((jg != npos || m_colored_jac) && m_analytic_chem_jac);
     updateProperties(jg, x, jmin, jmax);
     evalResidual(x, rsd, diag, rdt, jmin, jmax);
+    m_freeze_chem = false;
+}
+
+void StFlow::evalJacobian(double* xg, MultiJac& jac)
+{
+    if (!m_analytic_chem_jac) {
+        return;
+    }
+
+    double* x = xg + loc();
+    vector_fp X(m_nsp), dwdot_dT(m_nsp), dwdot_dC(m_nsp);
+    Eigen::MatrixXd dwdot_dY;
+    Eigen::VectorXd hdwdot_dY;
+
+    for (size_t j = 1; j < m_points - 1; j++) {
+        setGas(x, j);
+        double T = m_thermo->temperature();
+        double rho = m_thermo->density();
+        double ctot = m_thermo->molarDensity();
+        double wtm = m_thermo->meanMolecularWeight();
+        m_thermo->getMoleFractions(X.data());
+
+        // Derivatives with respect to temperature at constant pressure and
+        // mole fractions
+        m_kin->getNetProductionRates_ddT(dwdot_dT.data());
+        m_kin->getNetProductionRates_ddC(dwdot_dC.data());
+        for (size_t k = 0; k < m_nsp; k++) {
+            dwdot_dT[k] -= ctot / T * dwdot_dC[k];
+        }
+
+        // Derivatives with respect to the (unnormalized) mass fractions, where
+        // dX_i/dY_n = M_bar / W_n * (delta_in - X_i)
+        dwdot_dY = m_kin->netProductionRates_ddX();
+        Eigen::VectorXd dwdot_X = dwdot_dY * Eigen::Map<Eigen::VectorXd>(
+            X.data(), m_nsp);
+        for (size_t n = 0; n < m_nsp; n++) {
+            dwdot_dY.col(n) = (dwdot_dY.col(n) - dwdot_X) * (wtm / m_wt[n]);
+        }
+
+        // Species equations
+        size_t iT = loc() + index(c_offset_T, j);
+        for (size_t k = 0; k < m_nsp; k++) {
+            size_t iY = loc() + index(c_offset_Y + k, j);
+            double scale = m_wt[k] / rho;
+            jac.value(iY, iT) += scale * dwdot_dT[k];
+            for (size_t n = 0; n < m_nsp; n++) {
+                jac.value(iY, loc() + index(c_offset_Y + n, j))
+                    += scale * dwdot_dY(k, n);
+            }
+        }
+
+        // Heat release term of the energy equation
+        if (m_do_energy[j]) {
+            const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
+            Eigen::Map<const Eigen::VectorXd> h(h_RT.data(), m_nsp);
+            double scale = - GasConstant * T / (rho * m_thermo->cp_mass());
+            jac.value(iT, iT) += scale * h.dot(
+                Eigen::Map<Eigen::VectorXd>(dwdot_dT.data(), m_nsp));
+            hdwdot_dY = dwdot_dY.transpose() * h;
+            for (size_t n = 0; n < m_nsp; n++) {
+                jac.value(iT, loc() + index(c_offset_Y + n, j))
+                    += scale * hdwdot_dY[n];
+            }
+        }
+    }
 }
 
 void StFlow::updateProperties(size_t jg, double* x, size_t jmin, size_t jmax)
@@ -320,12 +391,13 @@ void StFlow::updateProperties(size_t jg, double* x, size_t jmin, size_t jmax)
     size_t j1 = std::min(jmax+1,m_points-1);
 
     updateThermo(x, j0, j1);
-    if (jg == npos || m_force_full_update) {
+    bool jac = (jg != npos || m_colored_jac);
+    if (!jac || m_force_full_update) {
         // update transport properties only if a Jacobian is not being
         // evaluated, or if specifically requested
         updateTransport(x, j0, j1);
     }
-    if (jg == npos) {
+    if (!jac) {
         double* Yleft = x + index(c_offset_Y, jmin);
         m_kExcessLeft = distance(Yleft, max_element(Yleft, Yleft + m_nsp));
         double* Yright = x + index(c_offset_Y, jmax);
@@ -476,7 +548,9 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
             //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
             //   = M_k\omega_k
             //-------------------------------------------------
-            getWdot(x,j);
+            if (!m_freeze_chem) {
+                getWdot(x,j);
+            }
             for (size_t k = 0; k < m_nsp; k++) {
                 double convec = rho_u(x,j)*dYdz(x,k,j);
                 double diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
@@ -552,11 +626,25 @@ void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
             }
         }
     } else { // mixture averaged transport
+        // evaluate the properties at all midpoints with a single call
+        size_t np = j1 - j0;
+        m_Tbar.resize(np);
+        m_Pbar.assign(np, m_press);
+        m_Xbar.resize(np * m_nsp);
         for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMixDiffCoeffs(&m_diff[j*m_nsp]);
-            m_tcon[j] = m_trans->thermalConductivity();
+            m_Tbar[j-j0] = 0.5*(T(x,j)+T(x,j+1));
+            const double* yyj = x + m_nv*j + c_offset_Y;
+            const double* yyjp = x + m_nv*(j+1) + c_offset_Y;
+            double* xx = &m_Xbar[(j-j0)*m_nsp];
+            // mole fractions are normalized by the transport model
+            for (size_t k = 0; k < m_nsp; k++) {
+                xx[k] = 0.5*(yyj[k] + yyjp[k]) / m_wt[k];
+            }
+        }
+        m_trans->getMixTransportProperties(np, m_Tbar.data(), m_Pbar.data(),
+            m_Xbar.data(), &m_visc[j0], &m_tcon[j0], &m_diff[j0*m_nsp]);
+        if (!m_dovisc) {
+            std::fill(m_visc.begin() + j0, m_visc.begin() + j1, 0.0);
         }
     }
 }
@@ -264,6 +264,57 @@ void IdealGasPhase::setToEquilState(const doublereal* mu_RT)
     setState_PX(pres, &m_pp[0]);
 }
 
+bool IdealGasPhase::setTemperatureFromEnergy(double target, double rtol,
+                                             bool doUV)
+{
+    double T0 = temperature();
+    double P0 = pressure();
+    const double* ym = moleFractdivMMW();
+    // The internal energy differs from the enthalpy by RT/M
+    double rmmw = doUV ? 1.0 / meanMolecularWeight() : 0.0;
+    double T = T0;
+    double Tlow = 0.0;
+    double Thigh = BigNumber;
+    for (int n = 0; n < 50; n++) {
+        setTemperature(T);
+        updateThermo();
+        double h_RT = -rmmw;
+        double cp_R = -rmmw;
+        for (size_t k = 0; k < m_kk; k++) {
+            h_RT += ym[k] * m_h0_RT[k];
+            cp_R += ym[k] * m_cp0_R[k];
+        }
+        double err = GasConstant * T * h_RT - target;
+        double cp = GasConstant * cp_R;
+        if (!(cp > 0.0) || !std::isfinite(err)) {
+            break;
+        }
+        double dT = -err / cp;
+        if (fabs(dT) <= rtol * T) {
+            // Accept the current iterate, for which the species properties
+            // are already up to date
+            if (!doUV) {
+                setPressure(P0);
+            }
+            return true;
+        }
+        if (err > 0.0) {
+            Thigh = T;
+        } else {
+            Tlow = T;
+        }
+        if (T + dT < Tlow || T + dT > Thigh) {
+            dT = 0.5 * (Tlow + Thigh) - T;
+            if (fabs(dT) <= rtol * T) {
+                break;
+            }
+        }
+        T += dT;
+    }
+    setTemperature(T0);
+    return false;
+}
+
 void IdealGasPhase::updateThermo() const
 {
     static const int cacheId = m_cache.getId();
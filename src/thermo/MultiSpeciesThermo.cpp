@@ -10,6 +10,7 @@
 
 #include "cantera/thermo/MultiSpeciesThermo.h"
 #include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/speciesThermoTypes.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/ctexceptions.h"
@@ -19,7 +20,8 @@ namespace Cantera
 MultiSpeciesThermo::MultiSpeciesThermo() :
     m_tlow_max(0.0),
     m_thigh_min(1.0E30),
-    m_p0(OneAtm)
+    m_p0(OneAtm),
+    m_nUpdates(0)
 {
 }
 
@@ -40,6 +42,10 @@ void MultiSpeciesThermo::install_STIT(size_t index,
         m_tpoly[type].resize(stit_ptr->temperaturePolySize());
     }
 
+    if (type == NASA2) {
+        addNasa(index, *stit_ptr);
+    }
+
     // Calculate max and min T
     m_tlow_max = std::max(stit_ptr->minTemp(), m_tlow_max);
     m_thigh_min = std::min(stit_ptr->maxTemp(), m_thigh_min);
@@ -76,6 +82,9 @@ void MultiSpeciesThermo::modifySpecies(size_t index,
     }
 
     m_sp[type][m_speciesLoc[index].second] = {index, spthermo};
+    if (type == NASA2) {
+        modifyNasa(index);
+    }
 }
 
 void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
@@ -90,9 +99,14 @@ void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
 void MultiSpeciesThermo::update(doublereal t, doublereal* cp_R,
                                   doublereal* h_RT, doublereal* s_R) const
 {
+    m_nUpdates++;
     auto iter = m_sp.begin();
     auto jter = m_tpoly.begin();
     for (; iter != m_sp.end(); iter++, jter++) {
+        if (iter->first == NASA2) {
+            updateNasa(t, cp_R, h_RT, s_R);
+            continue;
+        }
         const std::vector<index_STIT>& species = iter->second;
         double* tpoly = &jter->second[0];
         species[0].second->updateTemperaturePoly(t, tpoly);
@@ -194,6 +208,7 @@ void MultiSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298Ne
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
+        modifyNasa(k);
     }
 }
 
@@ -202,6 +217,7 @@ void MultiSpeciesThermo::resetHf298(const size_t k)
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->resetHf298();
+        modifyNasa(k);
     }
 }
 
@@ -224,4 +240,107 @@ void MultiSpeciesThermo::markInstalled(size_t k) {
     m_installed[k] = true;
 }
 
+void MultiSpeciesThermo::addNasa(size_t k, const SpeciesThermoInterpType& stit)
+{
+    // coefficient order: [Tmid, 7 high-T coeffs, 7 low-T coeffs]
+    double c[15];
+    size_t n;
+    int type;
+    double tlow, thigh, pref;
+    stit.reportParameters(n, type, tlow, thigh, pref, c);
+
+    size_t g = 0;
+    while (g < m_nasa.size() && m_nasa[g].Tmid != c[0]) {
+        g++;
+    }
+    if (g == m_nasa.size()) {
+        m_nasa.emplace_back();
+        m_nasa[g].Tmid = c[0];
+        m_nasa[g].low.resize(7);
+        m_nasa[g].high.resize(7);
+    }
+    NasaGroup& group = m_nasa[g];
+    m_nasaLoc[k] = {g, group.species.size()};
+    group.species.push_back(k);
+    for (size_t i = 0; i < 7; i++) {
+        group.high[i].push_back(c[1+i]);
+        group.low[i].push_back(c[8+i]);
+    }
+    size_t nmax = std::max(m_nasa_cp.size(), group.species.size());
+    m_nasa_cp.resize(nmax);
+    m_nasa_h.resize(nmax);
+    m_nasa_s.resize(nmax);
+}
+
+void MultiSpeciesThermo::removeNasa(size_t k)
+{
+    size_t g = m_nasaLoc.at(k).first;
+    size_t j = m_nasaLoc.at(k).second;
+    NasaGroup& group = m_nasa[g];
+    // Replace the species with the last species in the group
+    size_t last = group.species.size() - 1;
+    group.species[j] = group.species[last];
+    m_nasaLoc[group.species[j]].second = j;
+    group.species.pop_back();
+    for (size_t i = 0; i < 7; i++) {
+        group.low[i][j] = group.low[i][last];
+        group.low[i].pop_back();
+        group.high[i][j] = group.high[i][last];
+        group.high[i].pop_back();
+    }
+    m_nasaLoc.erase(k);
+}
+
+void MultiSpeciesThermo::modifyNasa(size_t k)
+{
+    if (m_nasaLoc.find(k) == m_nasaLoc.end()) {
+        return;
+    }
+    // The midpoint temperature may have changed, so the species is removed and
+    // added to the appropriate group again
+    removeNasa(k);
+    addNasa(k, *provideSTIT(k));
+}
+
+void MultiSpeciesThermo::updateNasa(double T, double* cp_R, double* h_RT,
+                                    double* s_R) const
+{
+    double T2 = T * T;
+    double T3 = T2 * T;
+    double T4 = T3 * T;
+    double rT = 1.0 / T;
+    double logT = std::log(T);
+    double* cp = m_nasa_cp.data();
+    double* h = m_nasa_h.data();
+    double* s = m_nasa_s.data();
+    for (const auto& group : m_nasa) {
+        const auto& a = (T <= group.Tmid) ? group.low : group.high;
+        const double* a0 = a[0].data();
+        const double* a1 = a[1].data();
+        const double* a2 = a[2].data();
+        const double* a3 = a[3].data();
+        const double* a4 = a[4].data();
+        const double* a5 = a[5].data();
+        const double* a6 = a[6].data();
+        size_t nsp = group.species.size();
+        // Same sequence of operations as NasaPoly1::updateProperties
+        for (size_t j = 0; j < nsp; j++) {
+            double ct0 = a0[j];
+            double ct1 = a1[j] * T;
+            double ct2 = a2[j] * T2;
+            double ct3 = a3[j] * T3;
+            double ct4 = a4[j] * T4;
+            cp[j] = ct0 + ct1 + ct2 + ct3 + ct4;
+            h[j] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4 + a5[j]*rT;
+            s[j] = ct0*logT + ct1 + 0.5*ct2 + 1.0/3.0*ct3 + 0.25*ct4 + a6[j];
+        }
+        for (size_t j = 0; j < nsp; j++) {
+            size_t k = group.species[j];
+            cp_R[k] = cp[j];
+            h_RT[k] = h[j];
+            s_R[k] = s[j];
+        }
+    }
+}
+
 }
@@ -336,6 +336,9 @@ void ThermoPhase::setState_HPorUV(double Htarget, double p,
         }
         setPressure(p);
     }
+    if (setTemperatureFromEnergy(Htarget, rtol, doUV)) {
+        return;
+    }
     double Tmax = maxTemp() + 0.1;
     double Tmin = minTemp() - 0.1;
 
@@ -0,0 +1,271 @@
+/**
+ *  @file BundledMixTransport.cpp
+ *  Mixture-averaged transport properties for ideal gas mixtures, evaluated
+ *  using bundles of species with similar binary diffusion coefficients.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/transport/BundledMixTransport.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/global.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+BundledMixTransport::BundledMixTransport() :
+    m_bundleTol(0.01),
+    m_bundleDiffTemp(-1.0)
+{
+}
+
+shared_ptr<Transport> BundledMixTransport::clone(ThermoPhase* thermo) const
+{
+    shared_ptr<BundledMixTransport> tr(new BundledMixTransport(*this));
+    tr->setThermo(*thermo);
+    return tr;
+}
+
+void BundledMixTransport::init(ThermoPhase* thermo, int mode, int log_level)
+{
+    MixTransport::init(thermo, mode, log_level);
+    setupBundles();
+}
+
+void BundledMixTransport::setBundleTolerance(double tol)
+{
+    if (tol < 0) {
+        throw CanteraError("BundledMixTransport::setBundleTolerance",
+                           "Tolerance must not be negative.");
+    }
+    m_bundleTol = tol;
+    if (m_diffcoeffs.nRows()) {
+        setupBundles();
+    }
+}
+
+void BundledMixTransport::setupBundles()
+{
+    size_t nsp = m_nsp;
+    size_t npairs = m_diffcoeffs.nRows();
+    auto pair = [nsp](size_t i, size_t j) {
+        if (i > j) {
+            std::swap(i, j);
+        }
+        return i * (2 * nsp - i + 1) / 2 + j - i;
+    };
+
+    // Logarithms of the binary diffusion coefficients and viscosities at a
+    // set of temperatures, up to terms which are the same for all species
+    const size_t nT = 5;
+    double Tmin = m_thermo->minTemp();
+    double Tmax = m_thermo->maxTemp();
+    vector_fp logtPowers(5);
+    std::vector<vector_fp> logD(nT, vector_fp(npairs));
+    std::vector<vector_fp> logVisc(nT, vector_fp(nsp));
+    for (size_t n = 0; n < nT; n++) {
+        double logt = log(Tmin + (Tmax - Tmin) * n / (nT - 1));
+        logtPowers[0] = 1.0;
+        logtPowers[1] = logt;
+        logtPowers[2] = logt*logt;
+        logtPowers[3] = logt*logt*logt;
+        logtPowers[4] = logt*logt*logt*logt;
+        evalPolynomials(m_diffcoeffs, logtPowers.data(), 1.0, logD[n].data());
+        evalPolynomials(m_visccoeffs, logtPowers.data(), 1.0, logVisc[n].data());
+        for (size_t i = 0; i < npairs; i++) {
+            logD[n][i] = log(logD[n][i]);
+        }
+        // In the default mode, the fit is for sqrt(visc/sqrt(T))
+        double scale = (m_mode == CK_Mode) ? 1.0 : 2.0;
+        for (size_t k = 0; k < nsp; k++) {
+            logVisc[n][k] = scale * log(logVisc[n][k]);
+        }
+    }
+
+    // Each species which is not yet part of a bundle becomes the
+    // representative species of a new bundle, which is then filled with all
+    // remaining species that are sufficiently similar to it. Comparisons are
+    // written so that NaN values (from invalid fits) are never similar.
+    double tol = m_bundleTol;
+    m_bundle.assign(nsp, npos);
+    m_bundleRep.clear();
+    for (size_t s = 0; s < nsp; s++) {
+        if (m_bundle[s] != npos) {
+            continue;
+        }
+        size_t b = m_bundleRep.size();
+        m_bundleRep.push_back(s);
+        m_bundle[s] = b;
+        for (size_t j = s + 1; j < nsp; j++) {
+            if (m_bundle[j] != npos) {
+                continue;
+            }
+            bool similar = true;
+            for (size_t n = 0; n < nT && similar; n++) {
+                const vector_fp& lD = logD[n];
+                similar = (std::abs(logVisc[n][j] - logVisc[n][s]) <= tol &&
+                           std::abs(lD[pair(j, j)] - lD[pair(s, s)]) <= tol);
+                for (size_t k = 0; k < nsp && similar; k++) {
+                    if (k != j && k != s) {
+                        similar = (std::abs(lD[pair(j, k)] - lD[pair(s, k)]) <= tol);
+                    }
+                }
+            }
+            if (similar) {
+                m_bundle[j] = b;
+            }
+        }
+    }
+
+    // Fits for each pair of bundles, taken from the representative species
+    size_t nb = nBundles();
+    size_t ncoeffs = m_diffcoeffs.nColumns();
+    m_bundleDiffCoeffs.resize(nb * (nb + 1) / 2, ncoeffs);
+    for (size_t a = 0; a < nb; a++) {
+        for (size_t b = a; b < nb; b++) {
+            size_t ic = pair(m_bundleRep[a], m_bundleRep[b]);
+            for (size_t m = 0; m < ncoeffs; m++) {
+                m_bundleDiffCoeffs(bundlePair(a, b), m) = m_diffcoeffs(ic, m);
+            }
+        }
+    }
+    m_bundleDiff.resize(nb * (nb + 1) / 2);
+    m_bundlePhi.resize(nb, nb);
+    m_bundleX.resize(nb);
+    m_bundleWork.resize(nb);
+    m_bundleDiffTemp = -1.0;
+    m_viscwt_ok = false;
+    m_bindiff_ok = false;
+    m_visc_ok = false;
+
+    if (m_log_level) {
+        writelog("\nSpecies bundles (tolerance {}): {} species in {} bundles\n",
+                 tol, nsp, nb);
+    }
+}
+
+void BundledMixTransport::updateBundleDiff_T()
+{
+    update_T();
+    if (m_bundleDiffTemp == m_temp) {
+        return;
+    }
+    evalPolynomials(m_bundleDiffCoeffs, m_polytempvec.data(), m_temp * m_sqrt_t,
+                    m_bundleDiff.data());
+    m_bundleDiffTemp = m_temp;
+}
+
+void BundledMixTransport::updateDiff_T()
+{
+    updateBundleDiff_T();
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            m_bdiff(i,j) = m_bundleDiff[bundlePair(m_bundle[i], m_bundle[j])];
+            m_bdiff(j,i) = m_bdiff(i,j);
+        }
+    }
+    m_bindiff_ok = true;
+}
+
+double BundledMixTransport::viscosity()
+{
+    update_T();
+    update_C();
+
+    if (m_visc_ok) {
+        return m_viscmix;
+    }
+    if (!m_spvisc_ok) {
+        updateSpeciesViscosities();
+    }
+
+    size_t nb = nBundles();
+    if (!m_viscwt_ok) {
+        // Wilke weighting functions for the representative species, as in
+        // GasTransport::updateViscosity_T()
+        for (size_t b = 0; b < nb; b++) {
+            size_t j = m_bundleRep[b];
+            double rsqvisc = 1.0 / m_sqvisc[j];
+            for (size_t a = 0; a < nb; a++) {
+                size_t k = m_bundleRep[a];
+                double factor1 = 1.0 + m_sqvisc[k] * rsqvisc * m_wratjk(k,j);
+                m_bundlePhi(a,b) = factor1 * factor1 * m_wratkj1(k,j);
+            }
+        }
+        m_viscwt_ok = true;
+    }
+
+    std::fill(m_bundleX.begin(), m_bundleX.end(), 0.0);
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_bundleX[m_bundle[k]] += m_molefracs[k];
+    }
+    multiply(m_bundlePhi, m_bundleX.data(), m_bundleWork.data());
+
+    double vismix = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        vismix += m_molefracs[k] * m_visc[k] / m_bundleWork[m_bundle[k]];
+    }
+    m_viscmix = vismix;
+    return vismix;
+}
+
+void BundledMixTransport::getMixDiffCoeffs(double* const d)
+{
+    update_T();
+    update_C();
+    updateBundleDiff_T();
+
+    double mmw = m_thermo->meanMolecularWeight();
+    double p = m_thermo->pressure();
+    if (m_nsp == 1) {
+        d[0] = m_bundleDiff[0] / p;
+        return;
+    }
+
+    size_t nb = nBundles();
+    std::fill(m_bundleX.begin(), m_bundleX.end(), 0.0);
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_bundleX[m_bundle[k]] += m_molefracs[k];
+    }
+
+    // contributions of all other bundles to the sum for each bundle
+    std::fill(m_bundleWork.begin(), m_bundleWork.end(), 0.0);
+    size_t ic = 0;
+    for (size_t a = 0; a < nb; a++) {
+        ic++; // skip the diagonal
+        for (size_t b = a + 1; b < nb; b++) {
+            m_bundleWork[a] += m_bundleX[b] / m_bundleDiff[ic];
+            m_bundleWork[b] += m_bundleX[a] / m_bundleDiff[ic];
+            ic++;
+        }
+    }
+
+    for (size_t k = 0; k < m_nsp; k++) {
+        size_t a = m_bundle[k];
+        double Daa = m_bundleDiff[bundlePair(a, a)];
+        double sum2 = m_bundleWork[a] + (m_bundleX[a] - m_molefracs[k]) / Daa;
+        if (sum2 <= 0.0) {
+            d[k] = Daa / p;
+        } else {
+            d[k] = (mmw - m_molefracs[k] * m_mw[k])/(p * mmw * sum2);
+        }
+    }
+}
+
+void BundledMixTransport::setViscosityPolynomial(size_t i, double* coeffs)
+{
+    MixTransport::setViscosityPolynomial(i, coeffs);
+    setupBundles();
+}
+
+void BundledMixTransport::setBinDiffusivityPolynomial(size_t i, size_t j,
+                                                      double* coeffs)
+{
+    MixTransport::setBinDiffusivityPolynomial(i, j, coeffs);
+    setupBundles();
+}
+
+}
@@ -104,16 +104,17 @@ void GasTransport::updateViscosity_T()
         updateSpeciesViscosities();
     }
 
-    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling
+    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling. The factors depending
+    // only on the molecular weights are precomputed, so that each column of
+    // m_phi is evaluated without square roots or divisions.
     for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t k = j; k < m_nsp; k++) {
-            double vratiokj = m_visc[k]/m_visc[j];
-            double wratiojk = m_mw[j]/m_mw[k];
-
-            // Note that m_wratjk(k,j) holds the square root of m_wratjk(j,k)!
-            double factor1 = 1.0 + (m_sqvisc[k]/m_sqvisc[j]) * m_wratjk(k,j);
-            m_phi(k,j) = factor1*factor1 / (sqrt(8.0) * m_wratkj1(j,k));
-            m_phi(j,k) = m_phi(k,j)/(vratiokj * wratiojk);
+        double rsqvisc = 1.0 / m_sqvisc[j];
+        const double* wrat = m_wratjk.ptrColumn(j);
+        const double* wden = m_wratkj1.ptrColumn(j);
+        double* phi = m_phi.ptrColumn(j);
+        for (size_t k = 0; k < m_nsp; k++) {
+            double factor1 = 1.0 + m_sqvisc[k] * rsqvisc * wrat[k];
+            phi[k] = factor1 * factor1 * wden[k];
         }
     }
     m_viscwt_ok = true;
@@ -123,14 +124,15 @@ void GasTransport::updateSpeciesViscosities()
 {
     update_T();
     if (m_mode == CK_Mode) {
+        evalPolynomials(m_visccoeffs, m_polytempvec.data(), 1.0, m_visc.data());
         for (size_t k = 0; k < m_nsp; k++) {
-            m_visc[k] = exp(dot4(m_polytempvec, m_visccoeffs[k]));
             m_sqvisc[k] = sqrt(m_visc[k]);
         }
     } else {
+        // the polynomial fit is done for sqrt(visc/sqrt(T))
+        evalPolynomials(m_visccoeffs, m_polytempvec.data(), m_t14,
+                        m_sqvisc.data());
         for (size_t k = 0; k < m_nsp; k++) {
-            // the polynomial fit is done for sqrt(visc/sqrt(T))
-            m_sqvisc[k] = m_t14 * dot5(m_polytempvec, m_visccoeffs[k]);
             m_visc[k] = (m_sqvisc[k] * m_sqvisc[k]);
         }
     }
@@ -141,26 +143,48 @@ void GasTransport::updateDiff_T()
 {
     update_T();
     // evaluate binary diffusion coefficients at unit pressure
+    evalPolynomials(m_diffcoeffs, m_polytempvec.data(), m_temp * m_sqrt_t,
+                    m_bdiff_pairs.data());
     size_t ic = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            m_bdiff(i,j) = m_bdiff_pairs[ic];
+            m_bdiff(j,i) = m_bdiff_pairs[ic];
+            ic++;
+        }
+    }
+    m_bindiff_ok = true;
+}
+
+void GasTransport::evalPolynomials(const DenseMatrix& coeffs,
+                                   const double* logtPowers, double prefactor,
+                                   double* values) const
+{
+    size_t n = coeffs.nRows();
+    if (n == 0) {
+        return;
+    }
+    // Terms are added in the same order as in dot4() / dot5()
+    const double* c0 = coeffs.ptrColumn(0);
+    for (size_t i = 0; i < n; i++) {
+        values[i] = c0[i];
+    }
+    for (size_t m = 1; m < coeffs.nColumns(); m++) {
+        double logt_m = logtPowers[m];
+        const double* cm = coeffs.ptrColumn(m);
+        for (size_t i = 0; i < n; i++) {
+            values[i] += logt_m * cm[i];
+        }
+    }
     if (m_mode == CK_Mode) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
+        for (size_t i = 0; i < n; i++) {
+            values[i] = exp(values[i]);
         }
     } else {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
+        for (size_t i = 0; i < n; i++) {
+            values[i] *= prefactor;
         }
     }
-    m_bindiff_ok = true;
 }
 
 void GasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
@@ -296,13 +320,17 @@ void GasTransport::init(ThermoPhase* thermo, int mode, int log_level)
     // make a local copy of the molecular weights
     m_mw = m_thermo->molecularWeights();
 
+    setupWilkeFactors();
+}
+
+void GasTransport::setupWilkeFactors()
+{
     m_wratjk.resize(m_nsp, m_nsp, 0.0);
     m_wratkj1.resize(m_nsp, m_nsp, 0.0);
     for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t k = j; k < m_nsp; k++) {
-            m_wratjk(j,k) = sqrt(m_mw[j]/m_mw[k]);
-            m_wratjk(k,j) = sqrt(m_wratjk(j,k));
-            m_wratkj1(j,k) = sqrt(1.0 + m_mw[k]/m_mw[j]);
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_wratjk(k,j) = sqrt(sqrt(m_mw[j]/m_mw[k]));
+            m_wratkj1(k,j) = 1.0 / sqrt(8.0 * (1.0 + m_mw[k]/m_mw[j]));
         }
     }
 }
@@ -520,8 +548,8 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
     vector_fp tlog(np), spvisc(np), spcond(np);
     vector_fp w(np), w2(np);
 
-    m_visccoeffs.clear();
-    m_condcoeffs.clear();
+    m_visccoeffs.resize(m_nsp, degree + 1);
+    m_condcoeffs.resize(m_nsp, degree + 1);
 
     // generate array of log(t) values
     for (size_t n = 0; n < np; n++) {
@@ -650,8 +678,8 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
             mxerr_cond = std::max(mxerr_cond, fabs(err));
             mxrelerr_cond = std::max(mxrelerr_cond, fabs(relerr));
         }
-        m_visccoeffs.push_back(c);
-        m_condcoeffs.push_back(c2);
+        m_visccoeffs.setRow(k, c.data());
+        m_condcoeffs.setRow(k, c2.data());
 
         if (m_log_level >= 2) {
             writelog(m_thermo->speciesName(k) + ": [" + vec2str(c) + "]\n");
@@ -671,8 +699,9 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         }
         if (m_log_level >= 2) {
             for (size_t k = 0; k < m_nsp; k++) {
+                m_condcoeffs.getRow(k, c2.data());
                 writelog(m_thermo->speciesName(k) + ": [" +
-                         vec2str(m_condcoeffs[k]) + "]\n");
+                         vec2str(c2) + "]\n");
             }
         }
         writelogf("Maximum conductivity absolute error:  %12.6g\n", mxerr_cond);
@@ -711,7 +740,10 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
                mxerr = 0.0, mxrelerr = 0.0;
 
     vector_fp diff(np + 1);
-    m_diffcoeffs.clear();
+    size_t npairs = m_nsp * (m_nsp + 1) / 2;
+    m_diffcoeffs.resize(npairs, degree + 1);
+    m_bdiff_pairs.resize(npairs);
+    size_t ic = 0;
     for (size_t k = 0; k < m_nsp; k++) {
         for (size_t j = k; j < m_nsp; j++) {
             for (size_t n = 0; n < np; n++) {
@@ -754,7 +786,7 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
                 mxerr = std::max(mxerr, fabs(err));
                 mxrelerr = std::max(mxrelerr, fabs(relerr));
             }
-            m_diffcoeffs.push_back(c);
+            m_diffcoeffs.setRow(ic++, c.data());
             if (m_log_level >= 2) {
                 writelog(m_thermo->speciesName(k) + "__" +
                          m_thermo->speciesName(j) + ": [" + vec2str(c) + "]\n");
@@ -824,14 +856,14 @@ void GasTransport::getBinDiffCorrection(double t, MMCollisionInt& integrals,
 void GasTransport::getViscosityPolynomial(size_t i, double* coeffs) const
 {
     for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        coeffs[k] = m_visccoeffs[i][k];
+        coeffs[k] = m_visccoeffs(i,k);
     }
 }
 
 void GasTransport::getConductivityPolynomial(size_t i, double* coeffs) const
 {
     for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        coeffs[k] = m_condcoeffs[i][k];
+        coeffs[k] = m_condcoeffs(i,k);
     }
 }
 
@@ -846,7 +878,7 @@ void GasTransport::getBinDiffusivityPolynomial(size_t i, size_t j, double* coeff
     ic += mj - mi;
 
     for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        coeffs[k] = m_diffcoeffs[ic][k];
+        coeffs[k] = m_diffcoeffs(ic,k);
     }
 }
 
@@ -865,7 +897,7 @@ void GasTransport::getCollisionIntegralPolynomial(size_t i, size_t j,
 void GasTransport::setViscosityPolynomial(size_t i, double* coeffs)
 {
     for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        m_visccoeffs[i][k] = coeffs[k];
+        m_visccoeffs(i,k) = coeffs[k];
     }
 
     m_visc_ok = false;
@@ -878,7 +910,7 @@ void GasTransport::setViscosityPolynomial(size_t i, double* coeffs)
 void GasTransport::setConductivityPolynomial(size_t i, double* coeffs)
 {
     for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        m_condcoeffs[i][k] = coeffs[k];
+        m_condcoeffs(i,k) = coeffs[k];
     }
 
     m_visc_ok = false;
@@ -899,7 +931,7 @@ void GasTransport::setBinDiffusivityPolynomial(size_t i, size_t j, double* coeff
     ic += mj - mi;
 
     for (size_t k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        m_diffcoeffs[ic][k] = coeffs[k];
+        m_diffcoeffs(ic,k) = coeffs[k];
     }
 
     m_visc_ok = false;
@@ -31,6 +31,13 @@ HighPressureGasTransport::HighPressureGasTransport(ThermoPhase* thermo)
 {
 }
 
+shared_ptr<Transport> HighPressureGasTransport::clone(ThermoPhase* thermo) const
+{
+    shared_ptr<HighPressureGasTransport> tr(new HighPressureGasTransport(*this));
+    tr->setThermo(*thermo);
+    return tr;
+}
+
 double HighPressureGasTransport::thermalConductivity()
 {
     //  Method of Ely and Hanley:
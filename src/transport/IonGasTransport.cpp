@@ -18,6 +18,13 @@ IonGasTransport::IonGasTransport() :
 {
 }
 
+shared_ptr<Transport> IonGasTransport::clone(ThermoPhase* thermo) const
+{
+    shared_ptr<IonGasTransport> tr(new IonGasTransport(*this));
+    tr->setThermo(*thermo);
+    return tr;
+}
+
 void IonGasTransport::init(ThermoPhase* thermo, int mode, int log_level)
 {
     m_thermo = thermo;
@@ -86,15 +93,7 @@ void IonGasTransport::init(ThermoPhase* thermo, int mode, int log_level)
     // make a local copy of the molecular weights
     m_mw = m_thermo->molecularWeights();
 
-    m_wratjk.resize(m_nsp, m_nsp, 0.0);
-    m_wratkj1.resize(m_nsp, m_nsp, 0.0);
-    for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t k = j; k < m_nsp; k++) {
-            m_wratjk(j,k) = sqrt(m_mw[j]/m_mw[k]);
-            m_wratjk(k,j) = sqrt(m_wratjk(j,k));
-            m_wratkj1(j,k) = sqrt(1.0 + m_mw[k]/m_mw[j]);
-        }
-    }
+    setupWilkeFactors();
 }
 
 double IonGasTransport::viscosity()
@@ -232,7 +231,7 @@ void IonGasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
                 mxrelerr = std::max(mxrelerr, fabs(relerr));
             }
             size_t sum = k * (k + 1) / 2;
-            m_diffcoeffs[k*m_nsp+j-sum] = c;
+            m_diffcoeffs.setRow(k*m_nsp+j-sum, c.data());
             if (m_log_level >= 2) {
                 writelog(m_thermo->speciesName(k) + "__" +
                          m_thermo->speciesName(j) + ": [" + vec2str(c) + "]\n");
@@ -22,6 +22,13 @@ MixTransport::MixTransport() :
 {
 }
 
+shared_ptr<Transport> MixTransport::clone(ThermoPhase* thermo) const
+{
+    shared_ptr<MixTransport> tr(new MixTransport(*this));
+    tr->setThermo(*thermo);
+    return tr;
+}
+
 void MixTransport::init(ThermoPhase* thermo, int mode, int log_level)
 {
     GasTransport::init(thermo, mode, log_level);
@@ -119,17 +126,118 @@ void MixTransport::update_C()
     }
 }
 
-void MixTransport::updateCond_T()
+void MixTransport::getMixTransportProperties(size_t nPoints, const double* T,
+                                             const double* P, const double* X,
+                                             double* visc, double* cond,
+                                             double* Dmix)
 {
-    if (m_mode == CK_Mode) {
-        for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = exp(dot4(m_polytempvec, m_condcoeffs[k]));
+    if (m_thermo->nSpecies() != m_nsp) {
+        // Rebuild data structures if number of species has changed
+        init(m_thermo, m_mode, m_log_level);
+    }
+
+    // Only local work arrays are modified, so that different sets of points
+    // can be evaluated concurrently
+    size_t nsp = m_nsp;
+    vector_fp logtPowers(5), x(nsp), spvisc(nsp), sqvisc(nsp), spcond(nsp);
+    vector_fp sum(nsp), bdiff(m_diffcoeffs.nRows());
+    for (size_t n = 0; n < nPoints; n++) {
+        if (T[n] < 0.0) {
+            throw CanteraError("MixTransport::getMixTransportProperties",
+                               "negative temperature {}", T[n]);
         }
-    } else {
-        for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = m_sqrt_t * dot5(m_polytempvec, m_condcoeffs[k]);
+        double logt = log(T[n]);
+        double sqrt_t = sqrt(T[n]);
+        logtPowers[0] = 1.0;
+        logtPowers[1] = logt;
+        logtPowers[2] = logt*logt;
+        logtPowers[3] = logt*logt*logt;
+        logtPowers[4] = logt*logt*logt*logt;
+
+        // normalize the mole fractions, and add an offset to avoid a pure
+        // species condition
+        const double* Xn = X + n * nsp;
+        double sumX = 0.0;
+        double mmw = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            sumX += Xn[k];
+            mmw += Xn[k] * m_mw[k];
+        }
+        mmw /= sumX;
+        for (size_t k = 0; k < nsp; k++) {
+            x[k] = std::max(Tiny, Xn[k] / sumX);
+        }
+
+        // viscosity, using the Wilke mixture rule as in updateViscosity_T()
+        if (m_mode == CK_Mode) {
+            evalPolynomials(m_visccoeffs, logtPowers.data(), 1.0, spvisc.data());
+            for (size_t k = 0; k < nsp; k++) {
+                sqvisc[k] = sqrt(spvisc[k]);
+            }
+        } else {
+            evalPolynomials(m_visccoeffs, logtPowers.data(), sqrt(sqrt_t),
+                            sqvisc.data());
+            for (size_t k = 0; k < nsp; k++) {
+                spvisc[k] = sqvisc[k] * sqvisc[k];
+            }
+        }
+        std::fill(sum.begin(), sum.end(), 0.0);
+        for (size_t j = 0; j < nsp; j++) {
+            double rsqvisc = 1.0 / sqvisc[j];
+            const double* wrat = m_wratjk.ptrColumn(j);
+            const double* wden = m_wratkj1.ptrColumn(j);
+            for (size_t k = 0; k < nsp; k++) {
+                double factor1 = 1.0 + sqvisc[k] * rsqvisc * wrat[k];
+                sum[k] += factor1 * factor1 * wden[k] * x[j];
+            }
+        }
+        visc[n] = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            visc[n] += x[k] * spvisc[k] / sum[k];
+        }
+
+        // thermal conductivity
+        evalPolynomials(m_condcoeffs, logtPowers.data(), sqrt_t, spcond.data());
+        double sum1 = 0.0, sum2 = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            sum1 += x[k] * spcond[k];
+            sum2 += x[k] / spcond[k];
+        }
+        cond[n] = 0.5*(sum1 + 1.0/sum2);
+
+        // mixture-averaged diffusion coefficients, as in getMixDiffCoeffs().
+        // The binary diffusion coefficients are only evaluated for each pair
+        // of species (i, j) with j >= i.
+        evalPolynomials(m_diffcoeffs, logtPowers.data(), T[n] * sqrt_t,
+                        bdiff.data());
+        double* d = Dmix + n * nsp;
+        if (nsp == 1) {
+            d[0] = bdiff[0] / P[n];
+            continue;
+        }
+        std::fill(sum.begin(), sum.end(), 0.0);
+        size_t ic = 0;
+        for (size_t i = 0; i < nsp; i++) {
+            ic++; // skip the diagonal
+            for (size_t j = i + 1; j < nsp; j++) {
+                sum[i] += x[j] / bdiff[ic];
+                sum[j] += x[i] / bdiff[ic];
+                ic++;
+            }
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            if (sum[k] <= 0.0) {
+                d[k] = bdiff[k * nsp - k * (k - 1) / 2] / P[n];
+            } else {
+                d[k] = (mmw - x[k] * m_mw[k]) / (P[n] * mmw * sum[k]);
+            }
         }
     }
+}
+
+void MixTransport::updateCond_T()
+{
+    evalPolynomials(m_condcoeffs, m_polytempvec.data(), m_sqrt_t, m_cond.data());
     m_spcond_ok = true;
     m_condmix_ok = false;
 }
@@ -39,6 +39,13 @@ MultiTransport::MultiTransport(ThermoPhase* thermo)
 {
 }
 
+shared_ptr<Transport> MultiTransport::clone(ThermoPhase* thermo) const
+{
+    shared_ptr<MultiTransport> tr(new MultiTransport(*this));
+    tr->setThermo(*thermo);
+    return tr;
+}
+
 void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
 {
     GasTransport::init(thermo, mode, log_level);
@@ -23,6 +23,26 @@ Transport::Transport(ThermoPhase* thermo, size_t ndim) :
 {
 }
 
+Transport::Transport(const Transport& other) :
+    m_thermo(other.m_thermo),
+    m_ready(other.m_ready),
+    m_nsp(other.m_nsp),
+    m_nDim(other.m_nDim),
+    m_velocityBasis(other.m_velocityBasis)
+{
+}
+
+shared_ptr<Transport> Transport::clone(ThermoPhase* thermo) const
+{
+    if (typeid(*this) != typeid(Transport)) {
+        throw NotImplementedError("Transport::clone",
+            "Not implemented for transport model '{}'.", transportModel());
+    }
+    shared_ptr<Transport> tr(new Transport(*this));
+    tr->setThermo(*thermo);
+    return tr;
+}
+
 bool Transport::ready()
 {
     return m_ready;
@@ -88,6 +108,20 @@ void Transport::setRoot(std::shared_ptr<Solution> root)
     m_root = root;
 }
 
+void Transport::getMixTransportProperties(size_t nPoints, const double* T,
+                                          const double* P, const double* X,
+                                          double* visc, double* cond,
+                                          double* Dmix)
+{
+    size_t nsp = m_thermo->nSpecies();
+    for (size_t n = 0; n < nPoints; n++) {
+        m_thermo->setState_TPX(T[n], P[n], X + n * nsp);
+        visc[n] = viscosity();
+        cond[n] = thermalConductivity();
+        getMixDiffCoeffs(Dmix + n * nsp);
+    }
+}
+
 void Transport::finalize()
 {
     if (!ready()) {
@@ -6,6 +6,7 @@
 // known transport models
 #include "cantera/transport/MultiTransport.h"
 #include "cantera/transport/MixTransport.h"
+#include "cantera/transport/BundledMixTransport.h"
 #include "cantera/transport/UnityLewisTransport.h"
 #include "cantera/transport/IonGasTransport.h"
 #include "cantera/transport/WaterTransport.h"
@@ -38,6 +39,10 @@ TransportFactory::TransportFactory()
     addAlias("mixture-averaged", "Mix");
     reg("mixture-averaged-CK", []() { return new MixTransport(); });
     addAlias("mixture-averaged-CK", "CK_Mix");
+    reg("mixture-averaged-bundled", []() { return new BundledMixTransport(); });
+    addAlias("mixture-averaged-bundled", "BundledMix");
+    reg("mixture-averaged-bundled-CK", []() { return new BundledMixTransport(); });
+    addAlias("mixture-averaged-bundled-CK", "CK_BundledMix");
     reg("multicomponent", []() { return new MultiTransport(); });
     addAlias("multicomponent", "Multi");
     reg("multicomponent-CK", []() { return new MultiTransport(); });
@@ -49,6 +54,7 @@ TransportFactory::TransportFactory()
     reg("high-pressure", []() { return new HighPressureGasTransport(); });
     addAlias("high-pressure", "HighP");
     m_CK_mode["CK_Mix"] = m_CK_mode["mixture-averaged-CK"] = true;
+    m_CK_mode["CK_BundledMix"] = m_CK_mode["mixture-averaged-bundled-CK"] = true;
     m_CK_mode["CK_Multi"] = m_CK_mode["multicomponent-CK"] = true;
 }
 
@@ -143,4 +143,12 @@ std::string ConstPressureMoleReactor::componentName(size_t k) {
                        "Index is out of bounds.");
 }
 
+void ConstPressureMoleReactor::getProductionRateAdjoint(const double* lambda,
+                                                        double* mu)
+{
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k + m_sidx] * m_vol;
+    }
+}
+
 }
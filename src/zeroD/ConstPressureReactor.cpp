@@ -158,4 +158,13 @@ std::string ConstPressureReactor::componentName(size_t k) {
                        "Index is out of bounds.");
 }
 
+void ConstPressureReactor::getProductionRateAdjoint(const double* lambda,
+                                                    double* mu)
+{
+    const vector_fp& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k+2] * m_vol * mw[k] / m_mass;
+    }
+}
+
 }
@@ -117,4 +117,9 @@ size_t FlowReactor::componentIndex(const string& nm) const
     }
 }
 
+void FlowReactor::getProductionRateAdjoint(const double* lambda, double* mu)
+{
+    throw NotImplementedError("FlowReactor::getProductionRateAdjoint");
+}
+
 }
@@ -149,6 +149,9 @@ Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::jacobian()
         }
     }
 
+    // surface species and reactions
+    addSurfaceJacobian(m_sidx, m_jac_trips);
+
     // Temperature Derivatives
     if (m_energy) {
         // getting perturbed state for finite difference
@@ -236,4 +239,17 @@ std::string IdealGasConstPressureMoleReactor::componentName(size_t k) {
                        "Index is out of bounds.");
 }
 
+void IdealGasConstPressureMoleReactor::getProductionRateAdjoint(
+    const double* lambda, double* mu)
+{
+    ConstPressureMoleReactor::getProductionRateAdjoint(lambda, mu);
+    if (m_energy) {
+        m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+        double mcp = m_mass * m_thermo->cp_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            mu[k] -= lambda[0] * m_hk[k] * m_vol / mcp;
+        }
+    }
+}
+
 }
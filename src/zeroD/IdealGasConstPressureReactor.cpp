@@ -154,4 +154,17 @@ std::string IdealGasConstPressureReactor::componentName(size_t k) {
     }
 }
 
+void IdealGasConstPressureReactor::getProductionRateAdjoint(const double* lambda,
+                                                            double* mu)
+{
+    ConstPressureReactor::getProductionRateAdjoint(lambda, mu);
+    if (m_energy) {
+        m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+        double mcp = m_mass * m_thermo->cp_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            mu[k] -= lambda[1] * m_hk[k] * m_vol / mcp;
+        }
+    }
+}
+
 }
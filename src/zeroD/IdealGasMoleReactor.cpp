@@ -175,6 +175,9 @@ Eigen::SparseMatrix<double> IdealGasMoleReactor::jacobian()
             m_jac_trips.emplace_back(it.row() + m_sidx, it.col() + m_sidx, it.value());
         }
     }
+    // surface species and reactions
+    addSurfaceJacobian(m_sidx, m_jac_trips);
+
     // Temperature Derivatives
     if (m_energy) {
         // getting perturbed state for finite difference
@@ -245,4 +248,17 @@ Eigen::SparseMatrix<double> IdealGasMoleReactor::jacobian()
     return jac;
 }
 
+void IdealGasMoleReactor::getProductionRateAdjoint(const double* lambda,
+                                                   double* mu)
+{
+    MoleReactor::getProductionRateAdjoint(lambda, mu);
+    if (m_energy) {
+        m_thermo->getPartialMolarIntEnergies(&m_uk[0]);
+        double mcv = m_mass * m_thermo->cv_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            mu[k] -= lambda[0] * m_uk[k] * m_vol / mcv;
+        }
+    }
+}
+
 }
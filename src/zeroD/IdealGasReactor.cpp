@@ -161,5 +161,16 @@ std::string IdealGasReactor::componentName(size_t k) {
     }
 }
 
+void IdealGasReactor::getProductionRateAdjoint(const double* lambda, double* mu)
+{
+    Reactor::getProductionRateAdjoint(lambda, mu);
+    if (m_energy) {
+        m_thermo->getPartialMolarIntEnergies(&m_uk[0]);
+        double mcv = m_mass * m_thermo->cv_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            mu[k] -= lambda[2] * m_uk[k] * m_vol / mcv;
+        }
+    }
+}
 
 }
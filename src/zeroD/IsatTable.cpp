@@ -0,0 +1,406 @@
+//! @file IsatTable.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/IsatTable.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorFactory.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/numerics/eigen_dense.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/AnyMap.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+struct IsatTable::Record
+{
+    Eigen::VectorXd x0; //!< Initial state
+    Eigen::VectorXd x1; //!< Final state
+    Eigen::MatrixXd A; //!< Mapping gradient
+    Eigen::MatrixXd B; //!< Matrix of the EOA quadratic form
+};
+
+IsatTable::IsatTable(shared_ptr<Solution> sol, const string& reactorType)
+    : m_nsp(sol->thermo()->nSpecies())
+    , m_nv(m_nsp + 2)
+    , m_reactorType(reactorType)
+    , m_dt(1e-5)
+    , m_tol(1e-4)
+    , m_Tscale(1000.0)
+    , m_Pscale(OneAtm)
+    , m_rtol(1e-9)
+    , m_atol(1e-15)
+    , m_maxRecords(2000)
+    , m_maxSearch(50)
+    , m_nQueries(0)
+    , m_nRetrieves(0)
+    , m_nGrows(0)
+    , m_nAdds(0)
+    , m_nDirect(0)
+{
+    if (!sol->thermo()->isIdeal() || sol->thermo()->nDim() != 3) {
+        throw CanteraError("IsatTable::IsatTable",
+            "Phase '{}' of type '{}' is not supported; an ideal gas is required.",
+            sol->thermo()->name(), sol->thermo()->type());
+    }
+    if (!sol->kinetics() || sol->kinetics()->nPhases() != 1) {
+        throw CanteraError("IsatTable::IsatTable",
+            "A single-phase kinetics model is required.");
+    }
+    // The template is only used while holding the pool lock, so it is not
+    // affected by the use of the original Solution by other threads
+    m_sol = sol->clone();
+    // Create the first worker to check the reactor type
+    releaseWorker(acquireWorker());
+}
+
+IsatTable::~IsatTable()
+{
+}
+
+void IsatTable::setTimeStep(double dt)
+{
+    if (dt <= 0) {
+        throw CanteraError("IsatTable::setTimeStep",
+                           "Time step must be positive.");
+    }
+    m_dt = dt;
+    clear();
+}
+
+void IsatTable::setTolerance(double tol)
+{
+    if (tol <= 0) {
+        throw CanteraError("IsatTable::setTolerance",
+                           "Tolerance must be positive.");
+    }
+    m_tol = tol;
+    clear();
+}
+
+void IsatTable::setScales(double Tscale, double Pscale)
+{
+    if (Tscale <= 0 || Pscale <= 0) {
+        throw CanteraError("IsatTable::setScales",
+                           "Scales must be positive.");
+    }
+    m_Tscale = Tscale;
+    m_Pscale = Pscale;
+    clear();
+}
+
+void IsatTable::setIntegratorTolerances(double rtol, double atol)
+{
+    {
+        unique_lock<mutex> lock(m_poolMutex);
+        m_rtol = rtol;
+        m_atol = atol;
+        for (auto& w : m_pool) {
+            w->net->setTolerances(m_rtol, m_atol);
+        }
+    }
+    clear();
+}
+
+void IsatTable::setMaxRecords(size_t nmax)
+{
+    m_maxRecords = nmax;
+}
+
+void IsatTable::setMaxSearch(size_t nmax)
+{
+    m_maxSearch = nmax;
+}
+
+size_t IsatTable::nRecords() const
+{
+    shared_lock<shared_timed_mutex> lock(m_tableMutex);
+    return m_records.size();
+}
+
+void IsatTable::clear()
+{
+    unique_lock<shared_timed_mutex> lock(m_tableMutex);
+    m_records.clear();
+    m_nodes.clear();
+    m_nQueries = 0;
+    m_nRetrieves = 0;
+    m_nGrows = 0;
+    m_nAdds = 0;
+    m_nDirect = 0;
+}
+
+void IsatTable::advance(double& T, double& P, double* Y)
+{
+    m_nQueries++;
+    vector_fp x(m_nv), x1(m_nv);
+    x[0] = T / m_Tscale;
+    x[1] = P / m_Pscale;
+    copy(Y, Y + m_nsp, x.begin() + 2);
+    Eigen::Map<Eigen::VectorXd> xv(x.data(), m_nv);
+    Eigen::Map<Eigen::VectorXd> x1v(x1.data(), m_nv);
+
+    auto unscale = [&]() {
+        T = x1[0] * m_Tscale;
+        P = x1[1] * m_Pscale;
+        for (size_t k = 0; k < m_nsp; k++) {
+            Y[k] = std::max(x1[k + 2], 0.0);
+        }
+    };
+
+    // Retrieve
+    {
+        shared_lock<shared_timed_mutex> lock(m_tableMutex);
+        size_t r = retrieve(x.data());
+        if (r != npos) {
+            const Record& rec = *m_records[r];
+            x1v = rec.x1 + rec.A * (xv - rec.x0);
+            lock.unlock();
+            m_nRetrieves++;
+            unscale();
+            return;
+        }
+    }
+
+    unique_ptr<Worker> w = acquireWorker();
+    try {
+        integrate(*w, x.data(), x1.data());
+
+        // Grow the closest record if its linear approximation is sufficiently
+        // accurate. If another thread has added a record which covers the
+        // query in the meantime, the table is not modified.
+        bool done = false;
+        {
+            unique_lock<shared_timed_mutex> lock(m_tableMutex);
+            size_t closest = npos;
+            if (retrieve(x.data(), &closest) != npos) {
+                done = true;
+                m_nDirect++;
+            } else if (closest != npos) {
+                Record& rec = *m_records[closest];
+                Eigen::VectorXd d = xv - rec.x0;
+                double err = (x1v - rec.x1 - rec.A * d).norm();
+                if (err <= m_tol) {
+                    // Smallest change of B such that d is on the boundary of
+                    // the EOA, leaving directions conjugate to d unchanged
+                    Eigen::VectorXd Bd = rec.B * d;
+                    double s = d.dot(Bd);
+                    rec.B += (1.0 / s - 1.0) / s * Bd * Bd.transpose();
+                    done = true;
+                    m_nGrows++;
+                }
+            }
+            if (!done && m_records.size() >= m_maxRecords) {
+                done = true;
+                m_nDirect++;
+            }
+        }
+
+        if (!done) {
+            // Add a new record, with the mapping gradient computed by forward
+            // differences
+            unique_ptr<Record> rec(new Record());
+            rec->x0 = xv;
+            rec->x1 = x1v;
+            rec->A.resize(m_nv, m_nv);
+            vector_fp xp(x), x1p(m_nv);
+            for (size_t j = 0; j < m_nv; j++) {
+                double dx = 1e-5 * std::max(std::abs(x[j]), 0.01);
+                xp[j] = x[j] + dx;
+                integrate(*w, xp.data(), x1p.data());
+                xp[j] = x[j];
+                for (size_t i = 0; i < m_nv; i++) {
+                    rec->A(i, j) = (x1p[i] - x1[i]) / dx;
+                }
+            }
+
+            // Initial EOA where |A d| <= tol, with the singular values of A
+            // bounded below by 1/2
+            Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(
+                rec->A.transpose() * rec->A);
+            Eigen::VectorXd lambda = eig.eigenvalues().cwiseMax(0.25);
+            rec->B = eig.eigenvectors() * lambda.asDiagonal()
+                     * eig.eigenvectors().transpose() / (m_tol * m_tol);
+
+            unique_lock<shared_timed_mutex> lock(m_tableMutex);
+            if (m_records.size() < m_maxRecords) {
+                m_records.push_back(std::move(rec));
+                insert(m_records.size() - 1);
+                m_nAdds++;
+            } else {
+                m_nDirect++;
+            }
+        }
+    } catch (...) {
+        releaseWorker(std::move(w));
+        throw;
+    }
+    releaseWorker(std::move(w));
+    unscale();
+}
+
+void IsatTable::integrate(double& T, double& P, double* Y)
+{
+    vector_fp x(m_nv), x1(m_nv);
+    x[0] = T / m_Tscale;
+    x[1] = P / m_Pscale;
+    copy(Y, Y + m_nsp, x.begin() + 2);
+    unique_ptr<Worker> w = acquireWorker();
+    try {
+        integrate(*w, x.data(), x1.data());
+    } catch (...) {
+        releaseWorker(std::move(w));
+        throw;
+    }
+    releaseWorker(std::move(w));
+    T = x1[0] * m_Tscale;
+    P = x1[1] * m_Pscale;
+    copy(x1.begin() + 2, x1.end(), Y);
+}
+
+AnyMap IsatTable::stats() const
+{
+    AnyMap stats;
+    stats["queries"] = static_cast<long int>(m_nQueries);
+    stats["retrieves"] = static_cast<long int>(m_nRetrieves);
+    stats["grows"] = static_cast<long int>(m_nGrows);
+    stats["adds"] = static_cast<long int>(m_nAdds);
+    stats["direct"] = static_cast<long int>(m_nDirect);
+    stats["records"] = static_cast<long int>(nRecords());
+    return stats;
+}
+
+unique_ptr<IsatTable::Worker> IsatTable::acquireWorker()
+{
+    unique_lock<mutex> lock(m_poolMutex);
+    if (!m_pool.empty()) {
+        unique_ptr<Worker> w = std::move(m_pool.back());
+        m_pool.pop_back();
+        return w;
+    }
+    unique_ptr<Worker> w(new Worker());
+    w->sol = m_sol->clone();
+    ReactorBase* r = newReactor(m_reactorType);
+    w->reactor.reset(dynamic_cast<Reactor*>(r));
+    if (!w->reactor) {
+        delete r;
+        throw CanteraError("IsatTable::acquireWorker",
+            "Reactor type '{}' cannot be integrated.", m_reactorType);
+    }
+    w->reactor->insert(w->sol);
+    w->net.reset(new ReactorNet());
+    w->net->addReactor(*w->reactor);
+    w->net->setTolerances(m_rtol, m_atol);
+    return w;
+}
+
+void IsatTable::releaseWorker(unique_ptr<Worker> w)
+{
+    unique_lock<mutex> lock(m_poolMutex);
+    m_pool.push_back(std::move(w));
+}
+
+void IsatTable::integrate(Worker& w, const double* x0, double* x1)
+{
+    auto thermo = w.sol->thermo();
+    thermo->setState_TPY(x0[0] * m_Tscale, x0[1] * m_Pscale, x0 + 2);
+    w.reactor->syncState();
+    w.net->setInitialTime(0.0);
+    w.net->advance(m_dt);
+    x1[0] = thermo->temperature() / m_Tscale;
+    x1[1] = thermo->pressure() / m_Pscale;
+    thermo->getMassFractions(x1 + 2);
+}
+
+size_t IsatTable::retrieve(const double* x, size_t* closest) const
+{
+    if (m_nodes.empty()) {
+        return npos;
+    }
+    Eigen::Map<const Eigen::VectorXd> xv(x, m_nv);
+    Eigen::VectorXd d(m_nv);
+    double qmin = INFINITY;
+    auto contains = [&](size_t r) {
+        const Record& rec = *m_records[r];
+        d = xv - rec.x0;
+        double q = d.dot(rec.B * d);
+        if (closest && q < qmin) {
+            qmin = q;
+            *closest = r;
+        }
+        return q <= 1.0;
+    };
+
+    // Primary retrieve using the binary tree
+    size_t n = 0;
+    while (m_nodes[n].record == npos) {
+        const Node& node = m_nodes[n];
+        double vx = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            vx += node.v[i] * x[i];
+        }
+        n = (vx > node.a) ? node.right : node.left;
+    }
+    size_t leaf = m_nodes[n].record;
+    if (contains(leaf)) {
+        return leaf;
+    }
+
+    // Secondary retrieve checking the most recently added records
+    size_t nRecords = m_records.size();
+    for (size_t i = 0; i < std::min(m_maxSearch, nRecords); i++) {
+        size_t r = nRecords - 1 - i;
+        if (r != leaf && contains(r)) {
+            return r;
+        }
+    }
+    return npos;
+}
+
+void IsatTable::insert(size_t r)
+{
+    const Eigen::VectorXd& x0 = m_records[r]->x0;
+    Node leaf;
+    leaf.record = r;
+    leaf.left = leaf.right = npos;
+    leaf.a = 0.0;
+    if (m_nodes.empty()) {
+        m_nodes.push_back(leaf);
+        return;
+    }
+
+    size_t n = 0;
+    while (m_nodes[n].record == npos) {
+        const Node& node = m_nodes[n];
+        double vx = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            vx += node.v[i] * x0[i];
+        }
+        n = (vx > node.a) ? node.right : node.left;
+    }
+
+    // Replace the leaf by a node with a cutting plane halfway between the two
+    // records, with the new record on the side where v . x > a
+    Node old = m_nodes[n];
+    const Eigen::VectorXd& xold = m_records[old.record]->x0;
+    Node cut;
+    cut.record = npos;
+    cut.v.resize(m_nv);
+    cut.a = 0.0;
+    for (size_t i = 0; i < m_nv; i++) {
+        cut.v[i] = x0[i] - xold[i];
+        cut.a += 0.5 * cut.v[i] * (x0[i] + xold[i]);
+    }
+    cut.left = m_nodes.size();
+    cut.right = m_nodes.size() + 1;
+    m_nodes.push_back(old);
+    m_nodes.push_back(leaf);
+    m_nodes[n] = std::move(cut);
+}
+
+}
@@ -84,6 +84,50 @@ void MoleReactor::evalSurfaces(double* LHS, double* RHS, double* sdot)
     }
 }
 
+void MoleReactor::addSurfaceJacobian(size_t sidx,
+                                     vector<Eigen::Triplet<double>>& trips)
+{
+    size_t loc = sidx + m_nsp; // offset of surface species
+    for (auto S : m_surfaces) {
+        Kinetics* kin = S->kinetics();
+        SurfPhase* surf = S->thermo();
+        double wallarea = S->area();
+        size_t nk = surf->nSpecies();
+        S->syncState();
+        size_t surfloc = kin->kineticsSpeciesIndex(0, kin->surfacePhaseIndex());
+        size_t bulkloc = kin->kineticsSpeciesIndex(m_thermo->speciesName(0));
+        Eigen::SparseMatrix<double> dwdot = kin->netProductionRates_ddCi();
+        for (int col = 0; col < dwdot.outerSize(); col++) {
+            // state vector index of the species and derivative of its
+            // concentration with respect to its moles
+            size_t j = col;
+            size_t ycol;
+            double dCdn;
+            if (j >= surfloc && j < surfloc + nk) {
+                ycol = loc + j - surfloc;
+                dCdn = 1.0 / wallarea;
+            } else if (j >= bulkloc && j < bulkloc + m_nsp) {
+                ycol = sidx + j - bulkloc;
+                dCdn = 1.0 / m_vol;
+            } else {
+                continue;
+            }
+            for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, col); it; ++it) {
+                size_t k = it.row();
+                if (k >= surfloc && k < surfloc + nk) {
+                    trips.emplace_back(static_cast<int>(loc + k - surfloc),
+                        static_cast<int>(ycol),
+                        it.value() * wallarea / surf->size(k - surfloc) * dCdn);
+                } else if (k >= bulkloc && k < bulkloc + m_nsp) {
+                    trips.emplace_back(static_cast<int>(sidx + k - bulkloc),
+                        static_cast<int>(ycol), it.value() * wallarea * dCdn);
+                }
+            }
+        }
+        loc += nk;
+    }
+}
+
 void MoleReactor::getMoles(double* y)
 {
     // Use inverse molecular weights to convert to moles
@@ -266,4 +310,11 @@ std::string MoleReactor::componentName(size_t k) {
     throw CanteraError("MoleReactor::componentName", "Index is out of bounds.");
 }
 
+void MoleReactor::getProductionRateAdjoint(const double* lambda, double* mu)
+{
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k + m_sidx] * m_vol;
+    }
+}
+
 }
@@ -10,6 +10,7 @@
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/ReactorSurface.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/MechanismReducer.h"
 #include "cantera/base/Solution.h"
 #include "cantera/base/utilities.h"
 
@@ -27,7 +28,10 @@ Reactor::Reactor() :
     m_mass(0.0),
     m_chem(false),
     m_energy(true),
-    m_nv(0)
+    m_nv(0),
+    m_dacThreshold(1e-3),
+    m_dacMaxDeltaT(10.0),
+    m_dacT(NAN)
 {}
 
 void Reactor::insert(shared_ptr<Solution> sol) {
@@ -42,6 +46,10 @@ void Reactor::setDerivativeSettings(AnyMap& settings)
 
 void Reactor::setKineticsMgr(Kinetics& kin)
 {
+    if (m_reducer) {
+        m_reducer->clear();
+        m_reducer.reset();
+    }
     m_kin = &kin;
     if (m_kin->nReactions() == 0) {
         setChemistry(false);
@@ -139,35 +147,40 @@ void Reactor::updateState(doublereal* y)
 
     if (m_energy) {
         double U = y[2];
-        // Residual function: error in internal energy as a function of T
-        auto u_err = [this, U](double T) {
-            m_thermo->setState_TR(T, m_mass / m_vol);
-            return m_thermo->intEnergy_mass() * m_mass - U;
-        };
-
-        double T = m_thermo->temperature();
-        boost::uintmax_t maxiter = 100;
-        std::pair<double, double> TT;
-        try {
-            TT = bmt::bracket_and_solve_root(
-                u_err, T, 1.2, true, bmt::eps_tolerance<double>(48), maxiter);
-        } catch (std::exception&) {
-            // Try full-range bisection if bracketing fails (for example, near
-            // temperature limits for the phase's equation of state)
-            try {
-                TT = bmt::bisect(u_err, m_thermo->minTemp(), m_thermo->maxTemp(),
-                    bmt::eps_tolerance<double>(48), maxiter);
-            } catch (std::exception& err2) {
-                // Set m_thermo back to a reasonable state if root finding fails
+        m_thermo->setDensity(m_mass / m_vol);
+        // Use the specialized method provided by the phase, if any. Otherwise,
+        // solve for the temperature using a general root finding method.
+        if (!m_thermo->setTemperatureFromEnergy(U / m_mass, 1e-12, true)) {
+            // Residual function: error in internal energy as a function of T
+            auto u_err = [this, U](double T) {
                 m_thermo->setState_TR(T, m_mass / m_vol);
-                throw CanteraError("Reactor::updateState",
-                    "{}\nat U = {}, rho = {}", err2.what(), U, m_mass / m_vol);
+                return m_thermo->intEnergy_mass() * m_mass - U;
+            };
+
+            double T = m_thermo->temperature();
+            boost::uintmax_t maxiter = 100;
+            std::pair<double, double> TT;
+            try {
+                TT = bmt::bracket_and_solve_root(
+                    u_err, T, 1.2, true, bmt::eps_tolerance<double>(48), maxiter);
+            } catch (std::exception&) {
+                // Try full-range bisection if bracketing fails (for example, near
+                // temperature limits for the phase's equation of state)
+                try {
+                    TT = bmt::bisect(u_err, m_thermo->minTemp(), m_thermo->maxTemp(),
+                        bmt::eps_tolerance<double>(48), maxiter);
+                } catch (std::exception& err2) {
+                    // Set m_thermo back to a reasonable state if root finding fails
+                    m_thermo->setState_TR(T, m_mass / m_vol);
+                    throw CanteraError("Reactor::updateState",
+                        "{}\nat U = {}, rho = {}", err2.what(), U, m_mass / m_vol);
+                }
             }
+            if (fabs(TT.first - TT.second) > 1e-7*TT.first) {
+                throw CanteraError("Reactor::updateState", "root finding failed");
+            }
+            m_thermo->setState_TR(TT.second, m_mass / m_vol);
         }
-        if (fabs(TT.first - TT.second) > 1e-7*TT.first) {
-            throw CanteraError("Reactor::updateState", "root finding failed");
-        }
-        m_thermo->setState_TR(TT.second, m_mass / m_vol);
     } else {
         m_thermo->setDensity(m_mass/m_vol);
     }
@@ -498,6 +511,46 @@ void Reactor::resetSensitivity(double* params)
     }
 }
 
+size_t Reactor::nAdjointParams() const
+{
+    return (m_chem && m_kin) ? m_kin->nReactions() : 0;
+}
+
+void Reactor::getAdjointParamDerivatives(const double* lambda, double* dfdp)
+{
+    size_t nr = nAdjointParams();
+    if (nr == 0) {
+        return;
+    }
+    if (m_kin->nPhases() != 1) {
+        throw CanteraError("Reactor::getAdjointParamDerivatives",
+            "Adjoint sensitivities require the kinetics of the homogeneous "
+            "phase to involve a single phase.");
+    }
+    if (static_cast<size_t>(m_netStoich.cols()) != nr) {
+        m_netStoich = m_kin->productStoichCoeffs() - m_kin->reactantStoichCoeffs();
+    }
+    m_thermo->restoreState(m_state);
+    vector_fp mu(m_nsp);
+    getProductionRateAdjoint(lambda, mu.data());
+    m_kin->getNetRatesOfProgress(dfdp);
+    // The net production rates are linear in the rates of progress, which are
+    // proportional to the rate multipliers
+    Eigen::VectorXd numu = m_netStoich.transpose()
+        * Eigen::Map<const Eigen::VectorXd>(mu.data(), m_nsp);
+    for (size_t i = 0; i < nr; i++) {
+        dfdp[i] *= numu[i];
+    }
+}
+
+void Reactor::getProductionRateAdjoint(const double* lambda, double* mu)
+{
+    const vector_fp& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k+3] * m_vol * mw[k] / m_mass;
+    }
+}
+
 void Reactor::setAdvanceLimits(const double *limits)
 {
     if (m_thermo == 0) {
@@ -557,4 +610,66 @@ void Reactor::setAdvanceLimit(const string& nm, const double limit)
     }
 }
 
+void Reactor::setAdaptiveChemistry(const vector<string>& targets,
+                                   double threshold, double maxDeltaT)
+{
+    if (targets.empty()) {
+        throw CanteraError("Reactor::setAdaptiveChemistry",
+                           "At least one target species is required.");
+    }
+    if (threshold < 0 || threshold > 1) {
+        throw CanteraError("Reactor::setAdaptiveChemistry",
+            "Threshold must be between 0 and 1; got {}.", threshold);
+    }
+    clearAdaptiveChemistry();
+    m_dacTargets = targets;
+    m_dacThreshold = threshold;
+    m_dacMaxDeltaT = maxDeltaT;
+}
+
+void Reactor::clearAdaptiveChemistry()
+{
+    if (m_reducer) {
+        m_reducer->clear();
+        m_reducer.reset();
+    }
+    m_dacTargets.clear();
+    m_dacT = NAN;
+}
+
+size_t Reactor::nActiveReactions() const
+{
+    if (!m_kin) {
+        return 0;
+    } else if (m_reducer) {
+        return m_reducer->nActiveReactions();
+    }
+    return m_kin->nReactions();
+}
+
+bool Reactor::updateActiveReactions(bool force)
+{
+    if (m_dacTargets.empty() || !m_chem) {
+        return false;
+    }
+    if (!m_reducer) {
+        if (!m_kin) {
+            throw CanteraError("Reactor::updateActiveReactions",
+                "Reactor contents not set for reactor '{}'.", m_name);
+        }
+        m_reducer = make_shared<MechanismReducer>(*m_kin);
+        m_reducer->setTargets(m_dacTargets);
+        m_reducer->setThreshold(m_dacThreshold);
+        force = true;
+    }
+    restoreState();
+    double T = m_thermo->temperature();
+    if (!force && std::abs(T - m_dacT) <= m_dacMaxDeltaT) {
+        return false;
+    }
+    m_reducer->update();
+    m_dacT = T;
+    return true;
+}
+
 }
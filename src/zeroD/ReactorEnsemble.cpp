@@ -0,0 +1,216 @@
+//! @file ReactorEnsemble.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorFactory.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/global.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace Cantera
+{
+
+ReactorEnsemble::ReactorEnsemble(shared_ptr<Solution> sol,
+                                 const string& reactorType, size_t nThreads)
+    : m_nsp(sol->thermo()->nSpecies())
+    , m_tEnd(1.0)
+    , m_rtol(1.0e-9)
+    , m_atol(1.0e-15)
+    , m_deltaT(400.0)
+{
+    if (!sol->thermo()->isIdeal() || sol->thermo()->nDim() != 3) {
+        throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+            "Phase '{}' of type '{}' is not supported; an ideal gas is required.",
+            sol->thermo()->name(), sol->thermo()->type());
+    }
+    if (!sol->kinetics() || sol->kinetics()->nPhases() != 1) {
+        throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+            "A single-phase kinetics model is required.");
+    }
+    if (nThreads == 0) {
+        nThreads = std::max(thread::hardware_concurrency(), 1u);
+    }
+
+    // All objects are created here, before any worker threads are started
+    m_workers.resize(nThreads);
+    for (auto& w : m_workers) {
+        w.sol = sol->clone();
+        ReactorBase* r = newReactor(reactorType);
+        w.reactor.reset(dynamic_cast<Reactor*>(r));
+        if (!w.reactor) {
+            delete r;
+            throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+                "Reactor type '{}' cannot be integrated.", reactorType);
+        }
+        w.reactor->insert(w.sol);
+        w.net.reset(new ReactorNet());
+        w.net->addReactor(*w.reactor);
+    }
+}
+
+ReactorEnsemble::~ReactorEnsemble()
+{
+}
+
+void ReactorEnsemble::setInitialStates(size_t nStates, const double* T,
+                                       const double* P, const double* Y)
+{
+    m_T0.assign(T, T + nStates);
+    m_P0.assign(P, P + nStates);
+    m_Y0.assign(Y, Y + nStates * m_nsp);
+}
+
+void ReactorEnsemble::setEndTime(double tEnd)
+{
+    if (tEnd <= 0) {
+        throw CanteraError("ReactorEnsemble::setEndTime",
+                           "End time must be positive.");
+    }
+    m_tEnd = tEnd;
+}
+
+void ReactorEnsemble::setTolerances(double rtol, double atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+}
+
+void ReactorEnsemble::setIgnitionTemperatureRise(double deltaT)
+{
+    m_deltaT = deltaT;
+}
+
+void ReactorEnsemble::setOutputTimes(const vector_fp& times)
+{
+    for (size_t m = 1; m < times.size(); m++) {
+        if (times[m] <= times[m-1]) {
+            throw CanteraError("ReactorEnsemble::setOutputTimes",
+                               "Output times must be increasing.");
+        }
+    }
+    m_times = times;
+}
+
+void ReactorEnsemble::integrate()
+{
+    if (!m_times.empty() && m_times.back() > m_tEnd) {
+        throw CanteraError("ReactorEnsemble::integrate",
+            "Last output time ({}) exceeds the end time ({}).",
+            m_times.back(), m_tEnd);
+    }
+    size_t nStates = m_T0.size();
+    size_t nTimes = m_times.size();
+    m_tig.assign(nStates, NAN);
+    m_Tf.assign(nStates, 0.0);
+    m_Pf.assign(nStates, 0.0);
+    m_Yf.assign(nStates * m_nsp, 0.0);
+    m_Ts.assign(nStates * nTimes, 0.0);
+    m_Ps.assign(nStates * nTimes, 0.0);
+    m_Ys.assign(nStates * nTimes * m_nsp, 0.0);
+
+    // Each worker takes the next state which has not been started yet, which
+    // balances the load when integration times vary between states.
+    std::atomic<size_t> next(0);
+    std::exception_ptr error;
+    size_t errorState = npos;
+    std::mutex errorMutex;
+    auto work = [&](Worker& w) {
+        for (size_t i = next++; i < nStates; i = next++) {
+            try {
+                run(w, i);
+            } catch (...) {
+                std::unique_lock<std::mutex> lock(errorMutex);
+                if (i < errorState) {
+                    errorState = i;
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+
+    for (auto& w : m_workers) {
+        w.net->setTolerances(m_rtol, m_atol);
+    }
+    std::vector<std::thread> threads;
+    for (size_t n = 1; n < m_workers.size(); n++) {
+        threads.emplace_back([&work, &w=m_workers[n]]() {
+            work(w);
+            thread_complete();
+        });
+    }
+    work(m_workers[0]);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    if (error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (std::exception& err) {
+            throw CanteraError("ReactorEnsemble::integrate",
+                "Integration failed for initial state {}:\n{}",
+                errorState, err.what());
+        }
+    }
+}
+
+void ReactorEnsemble::run(Worker& w, size_t i)
+{
+    auto thermo = w.sol->thermo();
+    Reactor& reactor = *w.reactor;
+    ReactorNet& net = *w.net;
+    size_t nTimes = m_times.size();
+
+    thermo->setState_TPY(m_T0[i], m_P0[i], &m_Y0[i * m_nsp]);
+    reactor.syncState();
+    net.setInitialTime(0.0);
+
+    auto store = [&](double* T, double* P, double* Y) {
+        *T = thermo->temperature();
+        *P = thermo->pressure();
+        thermo->getMassFractions(Y);
+    };
+
+    double Tign = m_T0[i] + m_deltaT;
+    double tPrev = 0.0;
+    double TPrev = m_T0[i];
+    size_t m = 0;
+    bool ignited = false;
+    while (true) {
+        double t = net.step();
+        double T = reactor.temperature();
+        if (!ignited && T >= Tign) {
+            // interpolate linearly between the last two steps
+            m_tig[i] = tPrev + (t - tPrev) * (Tign - TPrev) / (T - TPrev);
+            ignited = true;
+        }
+        tPrev = t;
+        TPrev = T;
+
+        // The integrator interpolates to sample times within the last step
+        while (m < nTimes && m_times[m] <= t) {
+            net.advance(m_times[m]);
+            size_t n = i * nTimes + m;
+            store(&m_Ts[n], &m_Ps[n], &m_Ys[n * m_nsp]);
+            m++;
+        }
+        if (t >= m_tEnd) {
+            net.advance(m_tEnd);
+            store(&m_Tf[i], &m_Pf[i], &m_Yf[i * m_nsp]);
+            break;
+        }
+    }
+}
+
+}
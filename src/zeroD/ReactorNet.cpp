@@ -5,23 +5,133 @@
 
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/FlowDevice.h"
+#include "cantera/zeroD/flowControllers.h"
 #include "cantera/zeroD/Wall.h"
+#include "cantera/zeroD/ReactorSurface.h"
+#include "cantera/zeroD/ReactorDelegator.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/Array.h"
 #include "cantera/numerics/Integrator.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+
 using namespace std;
 
 namespace Cantera
 {
 
+//! Persistent worker threads used to evaluate the reactors of a network
+class ReactorNet::EvalPool
+{
+public:
+    explicit EvalPool(size_t nWorkers) {
+        for (size_t i = 0; i < nWorkers; i++) {
+            m_threads.emplace_back(&EvalPool::work, this);
+        }
+    }
+
+    ~EvalPool() {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_start.notify_all();
+        for (auto& t : m_threads) {
+            t.join();
+        }
+    }
+
+    //! Call `task(i)` for `i` from 0 to `n-1`, using the worker threads and
+    //! the calling thread. If any tasks fail, the exception for the lowest
+    //! index is rethrown after all tasks have finished.
+    void run(size_t n, const function<void(size_t)>& task) {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_task = &task;
+            m_n = n;
+            m_next = 0;
+            m_busy = m_threads.size();
+            m_error = nullptr;
+            m_errorIndex = npos;
+            m_generation++;
+        }
+        m_start.notify_all();
+        process();
+        unique_lock<mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_busy == 0; });
+        m_task = nullptr;
+        if (m_error) {
+            rethrow_exception(m_error);
+        }
+    }
+
+private:
+    void work() {
+        size_t generation = 0;
+        while (true) {
+            {
+                unique_lock<mutex> lock(m_mutex);
+                m_start.wait(lock, [&]() {
+                    return m_stop || m_generation != generation;
+                });
+                if (m_stop) {
+                    return;
+                }
+                generation = m_generation;
+            }
+            process();
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_busy--;
+            }
+            m_done.notify_one();
+        }
+    }
+
+    void process() {
+        for (size_t i = m_next++; i < m_n; i = m_next++) {
+            try {
+                (*m_task)(i);
+            } catch (...) {
+                lock_guard<mutex> lock(m_mutex);
+                if (i < m_errorIndex) {
+                    m_error = current_exception();
+                    m_errorIndex = i;
+                }
+            }
+        }
+    }
+
+    vector<thread> m_threads;
+    mutex m_mutex;
+    condition_variable m_start; //!< Signals a new set of tasks
+    condition_variable m_done; //!< Signals that a worker has finished
+    const function<void(size_t)>* m_task = nullptr;
+    size_t m_n = 0; //!< Number of tasks
+    atomic<size_t> m_next{0}; //!< Index of the next task
+    size_t m_busy = 0; //!< Number of workers which have not finished
+    size_t m_generation = 0; //!< Counter identifying the current set of tasks
+    bool m_stop = false;
+    exception_ptr m_error;
+    size_t m_errorIndex = npos;
+};
+
 ReactorNet::ReactorNet() :
     m_integ(newIntegrator("CVODE")),
     m_time(0.0), m_init(false), m_integrator_init(false),
     m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4),
     m_atols(1.0e-15), m_atolsens(1.0e-6),
     m_maxstep(0.0), m_maxErrTestFails(0),
-    m_verbose(false)
+    m_verbose(false), m_stepTime(0.0),
+    m_dacInterval(20), m_dacSteps(0),
+    m_coupledPrecon(false), m_nthreads(1),
+    m_adjIntegrand(npos), m_adjScale(1.0), m_adjTime(NAN)
 {
     suppressErrors(true);
 
@@ -41,6 +151,22 @@ void ReactorNet::setInitialTime(double time)
     m_integrator_init = false;
 }
 
+void ReactorNet::setCoupledPreconditioner(bool coupled)
+{
+    m_coupledPrecon = coupled;
+    m_integrator_init = false;
+}
+
+void ReactorNet::setNumThreads(size_t nThreads)
+{
+    if (nThreads == 0) {
+        nThreads = std::max(thread::hardware_concurrency(), 1u);
+    }
+    m_nthreads = nThreads;
+    m_pool.reset();
+    m_init = false;
+}
+
 void ReactorNet::setMaxTimeStep(double maxstep)
 {
     m_maxstep = maxstep;
@@ -101,6 +227,14 @@ void ReactorNet::initialize()
         }
     }
 
+    updateCoupling();
+    if (m_nthreads > 1) {
+        checkThreadSafety();
+        if (!m_pool) {
+            m_pool.reset(new EvalPool(m_nthreads - 1));
+        }
+    }
+
     m_ydot.resize(m_nv,0.0);
     m_yest.resize(m_nv,0.0);
     m_advancelimits.resize(m_nv,-1.0);
@@ -115,6 +249,10 @@ void ReactorNet::initialize()
         writelog("Maximum time step:   {:14.6g}\n", m_maxstep);
     }
     m_integ->initialize(m_time, *this);
+    m_stepTime = m_time;
+    m_dacSteps = m_dacInterval;
+    m_dacTimes.clear();
+    m_dacActive.clear();
     if (m_integ->preconditionerSide() != PreconditionerSide::NO_PRECONDITION) {
         checkPreconditionerSupported();
     }
@@ -127,6 +265,10 @@ void ReactorNet::reinitialize()
     if (m_init) {
         debuglog("Re-initializing reactor network.\n", m_verbose);
         m_integ->reinitialize(m_time, *this);
+        m_stepTime = m_time;
+        m_dacSteps = m_dacInterval;
+        m_dacTimes.clear();
+        m_dacActive.clear();
         if (m_integ->preconditionerSide() != PreconditionerSide::NO_PRECONDITION) {
             checkPreconditionerSupported();
         }
@@ -165,7 +307,19 @@ void ReactorNet::advance(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
+    bool adaptive = false;
+    for (auto r : m_reactors) {
+        adaptive = adaptive || r->adaptiveChemistryEnabled();
+    }
+    if (adaptive) {
+        // Take individual steps so the sets of active reactions can be updated
+        // between steps, then interpolate to the requested time
+        while (m_stepTime < time) {
+            step();
+        }
+    }
     m_integ->integrate(time);
+    m_stepTime = std::max(m_stepTime, time);
     m_time = time;
     updateState(m_integ->solution());
 }
@@ -232,7 +386,10 @@ double ReactorNet::step()
     } else if (!m_integrator_init) {
         reinitialize();
     }
+    updateActiveReactions();
     m_time = m_integ->step(m_time + 1.0);
+    m_stepTime = m_time;
+    m_dacSteps++;
     updateState(m_integ->solution());
     return m_time;
 }
@@ -262,6 +419,138 @@ int ReactorNet::lastOrder()
     return m_integ->lastOrder();
 }
 
+void ReactorNet::setAdaptiveChemistryInterval(size_t nSteps)
+{
+    if (nSteps == 0) {
+        throw CanteraError("ReactorNet::setAdaptiveChemistryInterval",
+                           "Interval must be at least one step.");
+    }
+    m_dacInterval = nSteps;
+}
+
+void ReactorNet::updateActiveReactions()
+{
+    bool force = (m_dacSteps >= m_dacInterval);
+    bool adaptive = false;
+    bool updated = false;
+    size_t nActive = 0;
+    for (auto r : m_reactors) {
+        if (r->adaptiveChemistryEnabled()) {
+            adaptive = true;
+            updated = r->updateActiveReactions(force) || updated;
+            nActive += r->nActiveReactions();
+        }
+    }
+    if (adaptive && force) {
+        m_dacSteps = 0;
+    }
+    if (updated) {
+        m_dacTimes.push_back(m_time);
+        m_dacActive.push_back(nActive);
+    }
+}
+
+void ReactorNet::updateCoupling()
+{
+    size_t nr = m_reactors.size();
+    map<const ReactorBase*, size_t> index;
+    for (size_t n = 0; n < nr; n++) {
+        index[m_reactors[n]] = n;
+    }
+    vector<set<size_t>> coupled(nr);
+    // Couple all pairs of the given reactors which are part of the network
+    auto couple = [&](const vector<const ReactorBase*>& reactors) {
+        for (auto a : reactors) {
+            auto ia = index.find(a);
+            if (ia == index.end()) {
+                continue;
+            }
+            for (auto b : reactors) {
+                auto ib = index.find(b);
+                if (ib != index.end()) {
+                    coupled[ia->second].insert(ib->second);
+                }
+            }
+        }
+    };
+    // The mass flow rate of a flow device may depend on the states of the
+    // reactors on both sides, and for a PressureController, also on the mass
+    // flow rate of its master flow controller
+    auto coupleDevice = [&](FlowDevice* dev) {
+        vector<const ReactorBase*> reactors;
+        set<FlowDevice*> visited;
+        while (dev && visited.insert(dev).second) {
+            reactors.push_back(&dev->in());
+            reactors.push_back(&dev->out());
+            auto controller = dynamic_cast<PressureController*>(dev);
+            dev = controller ? controller->master() : nullptr;
+        }
+        couple(reactors);
+    };
+
+    for (size_t n = 0; n < nr; n++) {
+        Reactor& r = *m_reactors[n];
+        coupled[n].insert(n);
+        for (size_t i = 0; i < r.nInlets(); i++) {
+            coupleDevice(&r.inlet(i));
+        }
+        for (size_t i = 0; i < r.nOutlets(); i++) {
+            coupleDevice(&r.outlet(i));
+        }
+        for (size_t i = 0; i < r.nWalls(); i++) {
+            WallBase& w = r.wall(i);
+            couple({&w.left(), &w.right()});
+        }
+    }
+    m_coupling.resize(nr);
+    for (size_t n = 0; n < nr; n++) {
+        m_coupling[n].assign(coupled[n].begin(), coupled[n].end());
+    }
+
+    // Greedy assignment of reactors to groups, such that no two reactors in a
+    // group are coupled to a common reactor
+    m_jacGroups.clear();
+    vector<size_t> group(nr, npos);
+    for (size_t b = 0; b < nr; b++) {
+        vector<bool> used(m_jacGroups.size(), false);
+        for (size_t a : m_coupling[b]) {
+            for (size_t c : m_coupling[a]) {
+                if (group[c] != npos) {
+                    used[group[c]] = true;
+                }
+            }
+        }
+        size_t g = std::find(used.begin(), used.end(), false) - used.begin();
+        if (g == m_jacGroups.size()) {
+            m_jacGroups.emplace_back();
+        }
+        group[b] = g;
+        m_jacGroups[g].push_back(b);
+    }
+}
+
+void ReactorNet::checkThreadSafety()
+{
+    set<const ThermoPhase*> phases;
+    for (auto r : m_reactors) {
+        if (dynamic_cast<ReactorAccessor*>(r)) {
+            throw CanteraError("ReactorNet::checkThreadSafety",
+                "Reactor '{}' of type '{}' cannot be evaluated concurrently.",
+                r->name(), r->type());
+        }
+        bool unique = phases.insert(&r->contents()).second;
+        for (size_t i = 0; i < r->nSurfs(); i++) {
+            unique = phases.insert(r->surface(i)->thermo()).second && unique;
+        }
+        if (!unique) {
+            throw CanteraError("ReactorNet::checkThreadSafety",
+                "Reactor '{}' shares a phase with another reactor. Concurrent "
+                "evaluation requires separate phase and kinetics objects for "
+                "each reactor.", r->name());
+        }
+    }
+}
+
 void ReactorNet::addReactor(Reactor& r)
 {
     r.setNetwork(this);
@@ -275,7 +564,7 @@ void ReactorNet::eval(doublereal t, doublereal* y,
     updateState(y);
     m_LHS.assign(m_nv, 1);
     m_RHS.assign(m_nv, 0);
-    for (size_t n = 0; n < m_reactors.size(); n++) {
+    auto evalReactor = [&](size_t n) {
         m_reactors[n]->applySensitivity(p);
         m_reactors[n]->eval(t, m_LHS.data() + m_start[n], m_RHS.data() + m_start[n]);
         size_t yEnd = 0;
@@ -288,6 +577,13 @@ void ReactorNet::eval(doublereal t, doublereal* y,
             ydot[i] = m_RHS[i] / m_LHS[i];
         }
         m_reactors[n]->resetSensitivity(p);
+    };
+    if (m_pool) {
+        m_pool->run(m_reactors.size(), evalReactor);
+    } else {
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            evalReactor(n);
+        }
     }
     checkFinite("ydot", ydot, m_nv);
 }
@@ -331,6 +627,234 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
     }
 }
 
+void ReactorNet::evalSparseJacobian(double t, double* y, double* ydot,
+                                    double* p, Eigen::SparseMatrix<double>& jac)
+{
+    if (!m_init) {
+        initialize();
+    }
+    // evaluate the unperturbed ydot
+    eval(t, y, ydot, p);
+    vector<Eigen::Triplet<double>> trips;
+    vector_fp ysave(m_reactors.size());
+    for (const auto& group : m_jacGroups) {
+        size_t nvmax = 0;
+        for (size_t b : group) {
+            nvmax = std::max(nvmax, m_start[b+1] - m_start[b]);
+        }
+        for (size_t k = 0; k < nvmax; k++) {
+            // perturb component k of all reactors in the group
+            for (size_t b : group) {
+                size_t i = m_start[b] + k;
+                if (i < m_start[b+1]) {
+                    ysave[b] = y[i];
+                    y[i] = ysave[b] + m_atol[i] + fabs(ysave[b])*m_rtol;
+                }
+            }
+
+            // calculate perturbed residual
+            eval(t, y, m_ydot.data(), p);
+
+            // compute the columns of the Jacobian for the coupled reactors
+            for (size_t b : group) {
+                size_t i = m_start[b] + k;
+                if (i >= m_start[b+1]) {
+                    continue;
+                }
+                double dy = y[i] - ysave[b];
+                for (size_t a : m_coupling[b]) {
+                    for (size_t m = m_start[a]; m < m_start[a+1]; m++) {
+                        trips.emplace_back(static_cast<int>(m), static_cast<int>(i),
+                                           (m_ydot[m] - ydot[m]) / dy);
+                    }
+                }
+                y[i] = ysave[b];
+            }
+        }
+    }
+    updateState(y);
+    jac.resize(m_nv, m_nv);
+    jac.setFromTriplets(trips.begin(), trips.end());
+}
+
+double ReactorNet::solveAdjoint(double tf, const string& output,
+                                const string& component, size_t reactor,
+                                double threshold)
+{
+    if (output != "final" && output != "integral" && output != "ignition") {
+        throw CanteraError("ReactorNet::solveAdjoint",
+                           "Unknown output type '{}'", output);
+    }
+    if (m_init) {
+        reinitialize();
+    } else {
+        initialize();
+    }
+    if (tf <= m_time) {
+        throw CanteraError("ReactorNet::solveAdjoint", "Final time ({}) must be "
+                           "later than the current time ({})", tf, m_time);
+    }
+    size_t k = globalComponentIndex(component, reactor);
+    m_adjStart.assign(1, 0);
+    for (auto r : m_reactors) {
+        m_adjStart.push_back(m_adjStart.back() + r->nAdjointParams());
+    }
+    m_adjIntegrand = npos;
+    m_adjTime = NAN;
+
+    // Integrate forward, checkpointing the solution every 100 steps
+    m_integ->initializeAdjoint(100);
+    double t0 = m_time;
+    double y0 = m_integ->solution()[k];
+    double value = 0.0;
+    double tB0 = tf;
+    double t = t0;
+    double tprev = t0;
+    bool found = false;
+    while (t < tf) {
+        t = m_integ->step(tf);
+        if (output == "integral") {
+            // Three-point Gauss-Legendre quadrature of the interpolant, which
+            // is exact for the polynomials of degree up to five used by the
+            // integrator
+            double tend = std::min(t, tf);
+            double tmid = 0.5 * (tprev + tend);
+            double h = 0.5 * (tend - tprev);
+            double dt = sqrt(0.6) * h;
+            value += h / 9.0 * (5.0 * m_integ->derivative(tmid - dt, 0)[k]
+                                + 8.0 * m_integ->derivative(tmid, 0)[k]
+                                + 5.0 * m_integ->derivative(tmid + dt, 0)[k]);
+        } else if (output == "ignition"
+                   && (m_integ->solution()[k] - threshold) * (y0 - threshold) <= 0) {
+            // Locate the crossing within the last step by bisection of the
+            // interpolant
+            double ta = tprev;
+            double tb = t;
+            for (int i = 0; i < 100 && tb - ta > 1e-14 * tb; i++) {
+                double tm = 0.5 * (ta + tb);
+                if ((m_integ->derivative(tm, 0)[k] - threshold)
+                    * (y0 - threshold) > 0) {
+                    ta = tm;
+                } else {
+                    tb = tm;
+                }
+            }
+            tB0 = tb;
+            found = true;
+            break;
+        }
+        tprev = t;
+    }
+
+    // Integration is restarted from the state at the end of the output interval
+    m_integrator_init = false;
+    m_stepTime = t;
+    double* yend = m_integ->derivative(std::min(tB0, t), 0);
+    vector_fp yB0(yend, yend + m_nv);
+    if (output == "ignition" && !found) {
+        m_time = t;
+        updateState(yB0.data());
+        throw CanteraError("ReactorNet::solveAdjoint", "Component '{}' did not "
+                           "reach the value {} before t = {}", component,
+                           threshold, tf);
+    }
+
+    // Terminal condition of the adjoint variables
+    vector_fp yB(m_nv, 0.0);
+    if (output == "final") {
+        value = yB0[k];
+        m_adjScale = 1.0;
+        yB[k] = 1.0;
+    } else if (output == "ignition") {
+        // The derivative of the ignition time is that of the component at
+        // the ignition time, divided by its negative rate of change
+        value = tB0;
+        double dydt = m_integ->derivative(tB0, 1)[k];
+        m_adjScale = 1.0 / std::abs(dydt);
+        yB[k] = (dydt > 0) ? -1.0 : 1.0;
+    } else {
+        m_adjScale = tf - t0;
+        m_adjIntegrand = k;
+    }
+
+    vector_fp qB(nAdjointQuadratures());
+    m_integ->solveAdjoint(tB0, t0, yB.data(), qB.data());
+    m_adjointSens.resize(m_reactors.size());
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_adjointSens[n].assign(qB.begin() + m_adjStart[n],
+                                qB.begin() + m_adjStart[n+1]);
+        for (auto& dGdp : m_adjointSens[n]) {
+            dGdp *= m_adjScale;
+        }
+    }
+    m_adjIntegrand = npos;
+    m_adjTime = NAN;
+
+    m_time = tB0;
+    updateState(yB0.data());
+    return value;
+}
+
+const vector_fp& ReactorNet::adjointSensitivities(size_t n) const
+{
+    if (n >= m_adjointSens.size()) {
+        throw CanteraError("ReactorNet::adjointSensitivities",
+            "No adjoint sensitivities are available for reactor {}.", n);
+    }
+    return m_adjointSens[n];
+}
+
+void ReactorNet::updateAdjointJacobian(double t, double* y)
+{
+    if (t == m_adjTime && m_adjState.size() == m_nv
+        && std::equal(y, y + m_nv, m_adjState.begin())) {
+        return;
+    }
+    m_adjState.assign(y, y + m_nv);
+    m_adjTime = t;
+    m_adjWork.resize(m_nv);
+    evalSparseJacobian(t, y, m_adjWork.data(), m_sens_params.data(), m_adjJac);
+}
+
+void ReactorNet::evalAdjoint(double t, double* y, double* yB, double* yBdot)
+{
+    // The adjoint system is d(yB)/dt = -J^T yB - dg/dy, where g is the
+    // integrand of the output
+    updateAdjointJacobian(t, y);
+    Eigen::Map<Eigen::VectorXd>(yBdot, m_nv) = -(m_adjJac.transpose()
+        * Eigen::Map<const Eigen::VectorXd>(yB, m_nv));
+    if (m_adjIntegrand != npos) {
+        yBdot[m_adjIntegrand] -= 1.0 / m_adjScale;
+    }
+}
+
+void ReactorNet::evalAdjointJacobian(double t, double* y, double* jac)
+{
+    updateAdjointJacobian(t, y);
+    std::fill(jac, jac + m_nv * m_nv, 0.0);
+    for (int j = 0; j < m_adjJac.outerSize(); j++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(m_adjJac, j); it; ++it) {
+            // element (j, i) of -J^T, in column-major order
+            jac[it.col() + it.row() * m_nv] = -it.value();
+        }
+    }
+}
+
+void ReactorNet::evalAdjointQuadrature(double t, double* y, double* yB,
+                                       double* qBdot)
+{
+    // The gradient of the output is the integral of yB^T df/dp from the
+    // initial to the final time, which is integrated backward
+    updateState(y);
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_reactors[n]->getAdjointParamDerivatives(yB + m_start[n],
+                                                  qBdot + m_adjStart[n]);
+    }
+    for (size_t i = 0; i < nAdjointQuadratures(); i++) {
+        qBdot[i] = -qBdot[i];
+    }
+}
+
 void ReactorNet::updateState(doublereal* y)
 {
     checkFinite("y", y, m_nv);
@@ -441,6 +965,22 @@ void ReactorNet::preconditionerSolve(double* rhs, double* output)
 
 void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
 {
+    if (m_coupledPrecon) {
+        auto precon = m_integ->preconditioner();
+        precon->reset();
+        precon->setGamma(gamma);
+        vector_fp ydot(m_nv);
+        Eigen::SparseMatrix<double> jac;
+        evalSparseJacobian(t, y, ydot.data(), m_sens_params.data(), jac);
+        for (int k = 0; k < jac.outerSize(); k++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(jac, k); it; ++it) {
+                precon->setValue(it.row(), it.col(), it.value());
+            }
+        }
+        precon->setup();
+        return;
+    }
+
     // ensure state is up to date.
     updateState(y);
     // get the preconditioner
@@ -473,6 +1013,9 @@ void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
 
 void ReactorNet::checkPreconditionerSupported()
 {
+    if (m_coupledPrecon) {
+        return;
+    }
     // preconditioner currently not supported for surfaces
     for (size_t i = 0; i < m_reactors.size(); i++) {
         if (m_reactors[i]->nSurfs() > 0) {
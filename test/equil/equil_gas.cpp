@@ -5,6 +5,9 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/equil/MultiPhase.h"
+#include "cantera/equil/vcs_MultiPhaseEquil.h"
+#include "cantera/equil/ChemEquilBatch.h"
+#include "cantera/base/Solution.h"
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
@@ -310,6 +313,101 @@ TEST_F(PropertyPairs, ChemEquil_UV) { check_UV("element_potential"); }
 // TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); } // not implemented
 TEST_F(PropertyPairs, VcsNonideal_UV) { check_UV("vcs"); }
 
+TEST(ChemEquilBatch, mixture_fraction_sweep)
+{
+    // Equilibrium states of methane/air mixtures at two pressures
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    vector_fp Yfuel(nsp), Yox(nsp);
+    gas->setState_TPX(300, OneAtm, "CH4:1");
+    gas->getMassFractions(Yfuel.data());
+    gas->setState_TPX(300, OneAtm, "O2:0.21, N2:0.78, AR:0.01");
+    gas->getMassFractions(Yox.data());
+
+    size_t nZ = 20;
+    vector_fp T, P, Y;
+    for (double p : {OneAtm, 10 * OneAtm}) {
+        for (size_t i = 0; i < nZ; i++) {
+            double Z = 0.15 * i / (nZ - 1);
+            T.push_back(300.0);
+            P.push_back(p);
+            for (size_t k = 0; k < nsp; k++) {
+                Y.push_back(Z * Yfuel[k] + (1 - Z) * Yox[k]);
+            }
+        }
+    }
+    size_t nStates = T.size();
+
+    ChemEquilBatch batch(sol, 1);
+    batch.setChunkSize(16);
+    batch.setStates(nStates, T.data(), P.data(), Y.data());
+    batch.equilibrate("HP");
+    EXPECT_EQ(batch.nWarmStarts() + batch.nColdStarts(), nStates);
+    EXPECT_GE(batch.nWarmStarts(), nStates - 6);
+    for (size_t i = 0; i < nStates; i++) {
+        gas->setState_TPY(T[i], P[i], &Y[i * nsp]);
+        gas->equilibrate("HP");
+        EXPECT_NEAR(batch.temperatures()[i], gas->temperature(),
+                    1e-6 * gas->temperature());
+        EXPECT_NEAR(batch.pressures()[i], P[i], 1e-8 * P[i]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(batch.massFractions()[i * nsp + k],
+                        gas->massFraction(k), 1e-7);
+        }
+    }
+
+    // The results do not depend on the number of threads
+    ChemEquilBatch batch3(sol, 3);
+    batch3.setChunkSize(16);
+    batch3.setStates(nStates, T.data(), P.data(), Y.data());
+    batch3.equilibrate("HP");
+    EXPECT_EQ(batch3.nWarmStarts(), batch.nWarmStarts());
+    for (size_t i = 0; i < nStates; i++) {
+        EXPECT_DOUBLE_EQ(batch3.temperatures()[i], batch.temperatures()[i]);
+    }
+
+    EXPECT_THROW(batch.equilibrate("XY"), CanteraError);
+    EXPECT_THROW(batch.setChunkSize(0), CanteraError);
+}
+
+TEST(MultiPhaseEquil, reuse_vcs_solver)
+{
+    unique_ptr<ThermoPhase> gas1(newPhase("gri30.yaml", "gri30"));
+    unique_ptr<ThermoPhase> gr1(newPhase("graphite.yaml"));
+    unique_ptr<ThermoPhase> gas2(newPhase("gri30.yaml", "gri30"));
+    unique_ptr<ThermoPhase> gr2(newPhase("graphite.yaml"));
+    MultiPhase mix1, mix2;
+    mix1.addPhase(gas1.get(), 1.0);
+    mix1.addPhase(gr1.get(), 0.0);
+    mix1.init();
+    mix2.addPhase(gas2.get(), 1.0);
+    mix2.addPhase(gr2.get(), 0.0);
+    mix2.init();
+    mix2.setReuseVcsSolver(true);
+
+    for (int i = 0; i < 20; i++) {
+        double T = 800.0 + 30.0 * i;
+        for (MultiPhase* mix : {&mix1, &mix2}) {
+            mix->setMolesByName("CH4:1, O2:0.8, N2:3");
+            mix->setState_TP(T, OneAtm);
+            mix->equilibrate("TP", "vcs");
+        }
+        for (size_t k = 0; k < mix1.nSpecies(); k++) {
+            EXPECT_NEAR(mix2.speciesMoles(k), mix1.speciesMoles(k),
+                        1e-8 * (mix1.speciesMoles(k) + 1e-10));
+        }
+    }
+    EXPECT_TRUE(mix1.vcsSolver() == nullptr);
+    ASSERT_TRUE(mix2.vcsSolver() != nullptr);
+    EXPECT_GT(mix2.vcsSolver()->nBasisUpdates(), 0);
+    EXPECT_LT(mix2.vcsSolver()->nBasisFactorizations(),
+              mix2.vcsSolver()->nBasisUpdates());
+
+    mix2.setReuseVcsSolver(false);
+    EXPECT_TRUE(mix2.vcsSolver() == nullptr);
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from equil_gas.cpp\n");
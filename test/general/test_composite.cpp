@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 #include "cantera/base/Interface.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/transport/Transport.h"
 
 using namespace Cantera;
 
@@ -27,3 +31,97 @@ TEST(Interface, from_AnyMap_and_Solution)
     ASSERT_EQ(gas.get(), surf->adjacent(0).get());
     ASSERT_EQ(surf->kinetics()->nReactions(), 24);
 }
+
+TEST(Solution, clone)
+{
+    auto sol = newSolution("h2o2.yaml", "", "mixture-averaged");
+    sol->thermo()->setState_TPX(1200, 2 * OneAtm, "H2:1.0, O2:0.5, AR:4.0");
+    auto copy = sol->clone();
+    auto gas = sol->thermo();
+    auto gas2 = copy->thermo();
+    ASSERT_NE(gas.get(), gas2.get());
+    ASSERT_EQ(gas2->nSpecies(), gas->nSpecies());
+    EXPECT_EQ(gas2->name(), gas->name());
+    EXPECT_DOUBLE_EQ(gas2->temperature(), 1200);
+    EXPECT_DOUBLE_EQ(gas2->pressure(), 2 * OneAtm);
+
+    // mechanism data is shared
+    for (size_t k = 0; k < gas->nSpecies(); k++) {
+        EXPECT_EQ(gas2->species(k).get(), gas->species(k).get());
+    }
+    auto kin = sol->kinetics();
+    auto kin2 = copy->kinetics();
+    ASSERT_EQ(kin2->nReactions(), kin->nReactions());
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        EXPECT_EQ(kin2->reaction(i).get(), kin->reaction(i).get());
+    }
+    EXPECT_EQ(copy->transport()->transportModel(),
+              sol->transport()->transportModel());
+
+    // state is independent
+    gas2->setState_TP(1500, OneAtm);
+    EXPECT_DOUBLE_EQ(gas->temperature(), 1200);
+    size_t nsp = gas->nSpecies();
+    vector_fp wdot(nsp), wdot2(nsp);
+    gas->setState_TP(1500, OneAtm);
+    kin->getNetProductionRates(wdot.data());
+    kin2->getNetProductionRates(wdot2.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-12 * std::abs(wdot[k]));
+    }
+    EXPECT_NEAR(copy->transport()->viscosity(), sol->transport()->viscosity(),
+                1e-12 * sol->transport()->viscosity());
+}
+
+TEST(Solution, clone_adjacent)
+{
+    auto surf = newInterface("ptcombust.yaml", "Pt_surf");
+    auto copy = surf->clone();
+    ASSERT_EQ(copy->nAdjacent(), 1u);
+    EXPECT_NE(copy->adjacent(0).get(), surf->adjacent(0).get());
+    EXPECT_EQ(copy->adjacent(0)->name(), "gas");
+    auto kin2 = copy->kinetics();
+    ASSERT_EQ(kin2->nReactions(), 24u);
+    EXPECT_EQ(&kin2->thermo(kin2->phaseIndex("gas")),
+              copy->adjacent("gas")->thermo().get());
+}
+
+TEST(Solution, clone_copies_mechanism_data)
+{
+    auto sol = newSolution("h2o2.yaml", "", "mixture-averaged");
+    sol->thermo()->setState_TPX(1200, OneAtm, "H2:1.0, O2:0.5, AR:4.0");
+    auto kin = sol->kinetics();
+    auto tran = sol->transport();
+    kin->setMultiplier(2, 3.0);
+    vector_fp coeffs(5), coeffs2(5);
+    tran->getViscosityPolynomial(1, coeffs.data());
+    coeffs[0] += 0.5;
+    tran->setViscosityPolynomial(1, coeffs.data());
+
+    // Rate evaluators and transport fits of the original are copied, rather
+    // than being set up again from the reactions and species
+    auto copy = sol->clone();
+    auto kin2 = copy->kinetics();
+    auto tran2 = copy->transport();
+    EXPECT_DOUBLE_EQ(kin2->multiplier(2), 3.0);
+    tran2->getViscosityPolynomial(1, coeffs2.data());
+    for (size_t n = 0; n < coeffs.size(); n++) {
+        EXPECT_DOUBLE_EQ(coeffs2[n], coeffs[n]);
+    }
+    EXPECT_NEAR(tran2->viscosity(), tran->viscosity(), 1e-12 * tran->viscosity());
+
+    // The copies are independent of the original
+    double visc2 = tran2->viscosity();
+    kin->setMultiplier(2, 1.0);
+    coeffs[0] -= 0.5;
+    tran->setViscosityPolynomial(1, coeffs.data());
+    EXPECT_DOUBLE_EQ(kin2->multiplier(2), 3.0);
+    EXPECT_DOUBLE_EQ(tran2->viscosity(), visc2);
+    tran2->getViscosityPolynomial(1, coeffs2.data());
+    EXPECT_DOUBLE_EQ(coeffs2[0], coeffs[0] + 0.5);
+    size_t nr = kin->nReactions();
+    vector_fp kf(nr), kf2(nr);
+    kin->getFwdRatesOfProgress(kf.data());
+    kin2->getFwdRatesOfProgress(kf2.data());
+    EXPECT_NEAR(kf2[2], 3.0 * kf[2], 1e-12 * kf2[2]);
+}
@@ -8,6 +8,7 @@
 #include "cantera/base/Solution.h"
 #include "cantera/kinetics.h"
 #include "cantera/transport/TransportData.h"
+#include "cantera/transport/Transport.h"
 
 using namespace Cantera;
 using namespace YAML;
@@ -398,3 +399,38 @@ TEST(YamlWriter, customHeader)
               "Copy of H2O2 mechanism");
     ASSERT_EQ(soln->header()["spam"].asString(), "eggs");
 }
+
+TEST(YamlWriter, binary)
+{
+    auto original = newSolution("gri30.yaml", "gri30", "Mix");
+    YamlWriter writer;
+    writer.addPhase(original);
+    writer.toBinaryFile("generated-gri30.ctb");
+    auto duplicate = newSolution("generated-gri30.ctb", "gri30", "Mix");
+
+    auto thermo1 = original->thermo();
+    auto thermo2 = duplicate->thermo();
+    ASSERT_EQ(thermo1->nSpecies(), thermo2->nSpecies());
+    thermo1->setState_TPX(1200, 2 * OneAtm, "CH4: 1.0, O2: 2.0, N2: 7.52, OH: 0.01");
+    thermo2->setState_TPX(1200, 2 * OneAtm, "CH4: 1.0, O2: 2.0, N2: 7.52, OH: 0.01");
+    EXPECT_DOUBLE_EQ(thermo1->cp_mass(), thermo2->cp_mass());
+    EXPECT_DOUBLE_EQ(thermo1->enthalpy_mass(), thermo2->enthalpy_mass());
+    EXPECT_NEAR(original->transport()->viscosity(),
+                duplicate->transport()->viscosity(),
+                1e-12 * original->transport()->viscosity());
+
+    auto kin1 = original->kinetics();
+    auto kin2 = duplicate->kinetics();
+    ASSERT_EQ(kin1->nReactions(), kin2->nReactions());
+    vector_fp kf1(kin1->nReactions()), kf2(kin1->nReactions());
+    kin1->getFwdRateConstants(kf1.data());
+    kin2->getFwdRateConstants(kf2.data());
+    for (size_t i = 0; i < kin1->nReactions(); i++) {
+        EXPECT_NEAR(kf1[i], kf2[i], 1e-13 * kf1[i]) << "for reaction i = " << i;
+    }
+
+    std::string data = writer.toBinaryString();
+    EXPECT_THROW(AnyMap::fromBinaryString(data.substr(0, data.size() / 2)),
+                 CanteraError);
+    EXPECT_THROW(AnyMap::fromBinaryString("phases: []"), CanteraError);
+}
@@ -550,6 +550,93 @@ TEST(Kinetics, GasKineticsFromYaml2)
     EXPECT_EQ(kin->nReactions(), (size_t) 3);
 }
 
+TEST(Kinetics, GasKineticsMultipleStates)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto gas = sol->thermo();
+    auto kin = std::dynamic_pointer_cast<GasKinetics>(sol->kinetics());
+    ASSERT_TRUE(kin);
+    size_t nsp = gas->nSpecies();
+    kin->setMultiplier(3, 2.5);
+
+    vector_fp T{1200.0, 1500.0, 1500.0, 900.0};
+    vector_fp P{OneAtm, 2 * OneAtm, OneAtm, 0.1 * OneAtm};
+    std::vector<std::string> comp{
+        "CH4:1, O2:2, N2:7.52", "H2:2, O2:1, OH:0.01, AR:3", "CO:1, H2O:1, O:0.1",
+        "CH4:1, O2:2, H2O:0.5, CO2:0.2, H:0.001, CH3:0.001, N2:7.52"};
+    size_t nStates = T.size();
+    vector_fp Y(nsp * nStates), Yn(nsp);
+    for (size_t n = 0; n < nStates; n++) {
+        gas->setState_TPX(T[n], P[n], comp[n]);
+        gas->getMassFractions(Yn.data());
+        for (size_t k = 0; k < nsp; k++) {
+            Y[k * nStates + n] = Yn[k];
+        }
+    }
+
+    gas->setState_TPX(800.0, 0.5 * OneAtm, "H2:1, O2:1");
+    vector_fp wdot(nsp * nStates);
+    kin->getNetProductionRates(nStates, T.data(), P.data(), Y.data(), wdot.data());
+
+    // state of the phase is not modified
+    EXPECT_DOUBLE_EQ(gas->temperature(), 800.0);
+    EXPECT_DOUBLE_EQ(gas->pressure(), 0.5 * OneAtm);
+
+    vector_fp wdot_ref(nsp), cdot(nsp), ddot(nsp);
+    for (size_t n = 0; n < nStates; n++) {
+        for (size_t k = 0; k < nsp; k++) {
+            Yn[k] = Y[k * nStates + n];
+        }
+        gas->setState_TPY(T[n], P[n], Yn.data());
+        kin->getNetProductionRates(wdot_ref.data());
+        kin->getCreationRates(cdot.data());
+        kin->getDestructionRates(ddot.data());
+        for (size_t k = 0; k < nsp; k++) {
+            // The summation order differs from the single-state evaluation
+            EXPECT_NEAR(wdot[k * nStates + n], wdot_ref[k],
+                        1e-12 * (cdot[k] + ddot[k]) + 1e-300)
+                << "species " << gas->speciesName(k) << ", state " << n;
+        }
+    }
+}
+
+TEST(Kinetics, ArrheniusRateConstants)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    gas->setState_TPX(1350.0, OneAtm, "CH4:1, O2:2, N2:7.52");
+
+    // replace an existing rate by one with a negative pre-exponential factor
+    size_t iMod = 0;
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        if (kin->reaction(i)->type() == "Arrhenius") {
+            iMod = i;
+            break;
+        }
+    }
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: '" + kin->reaction(iMod)->equation() + "',"
+        " rate-constant: [-2.7e+13, 0.5, 355 cal/mol],"
+        " negative-A: true}");
+    kin->modifyReaction(iMod, newReaction(rxn, *kin));
+
+    vector_fp kf(kin->nReactions());
+    kin->getFwdRateConstants(kf.data());
+    size_t nArrhenius = 0;
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        auto R = kin->reaction(i);
+        if (R->type() != "Arrhenius" && R->type() != "three-body-Arrhenius") {
+            continue;
+        }
+        double k = R->rate()->eval(gas->temperature());
+        EXPECT_NEAR(kf[i], k, 1e-14 * std::abs(k)) << R->equation();
+        nArrhenius++;
+    }
+    EXPECT_GT(nArrhenius, (size_t) 200);
+    EXPECT_LT(kf[iMod], 0.);
+}
+
 TEST(Kinetics, EfficienciesFromYaml)
 {
     AnyMap infile = AnyMap::fromYamlFile("ideal-gas.yaml");
@@ -5,6 +5,8 @@
 #include "cantera/kinetics/GasKinetics.h"
 #include "cantera/base/Solution.h"
 #include "cantera/base/Interface.h"
+#include "cantera/thermo/SurfPhase.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
@@ -176,4 +178,143 @@ TEST(InterfaceReaction, CoverageDependency) {
     EXPECT_NEAR(kf[1], 3.7e20 * exp(-(67.4e6-6e6*0.3)/(GasConstant*T)), 1e-14*kf[1]);
 }
 
+class InterfaceDerivatives : public testing::Test
+{
+public:
+    InterfaceDerivatives() {
+        gas = newSolution("ptcombust.yaml", "gas");
+        auto iface = newInterface("ptcombust.yaml", "Pt_surf", {gas});
+        surf = std::dynamic_pointer_cast<SurfPhase>(iface->thermo());
+        kin = iface->kinetics();
+        gas->thermo()->setState_TPX(900, OneAtm,
+            "CH4:0.095, O2:0.21, AR:0.655, H2O:0.01, CO:0.02, H2:0.01");
+        surf->setTemperature(900);
+        surf->setCoveragesByName(
+            "PT(S):0.5, O(S):0.2, H(S):0.1, CO(S):0.1, OH(S):0.05, C(S):0.05");
+        nRxn = kin->nReactions();
+        ropNet.resize(nRxn);
+        ropPert.resize(nRxn);
+        kin->getNetRatesOfProgress(ropNet.data());
+    }
+
+    //! Compare the finite difference of the net rates of progress with the
+    //! directional derivative `drop`, allowing for round-off errors
+    void check(const vector_fp& drop, double delta, const std::string& label) {
+        kin->getNetRatesOfProgress(ropPert.data());
+        for (size_t i = 0; i < nRxn; i++) {
+            double fd = (ropPert[i] - ropNet[i]) / delta;
+            EXPECT_NEAR(drop[i], fd, 1e-4 * std::abs(fd) + 1e-12 * std::abs(ropNet[i]) / delta)
+                << label << ", reaction " << i;
+        }
+    }
+
+    shared_ptr<Solution> gas;
+    shared_ptr<SurfPhase> surf;
+    shared_ptr<Kinetics> kin;
+    size_t nRxn;
+    vector_fp ropNet, ropPert;
+};
+
+TEST_F(InterfaceDerivatives, SurfaceConcentrations)
+{
+    Eigen::MatrixXd jac = kin->netRatesOfProgress_ddCi();
+    size_t ns = surf->nSpecies();
+    size_t k0 = kin->kineticsSpeciesIndex(0, kin->surfacePhaseIndex());
+    size_t kPt = surf->speciesIndex("PT(S)");
+    vector_fp theta(ns), theta2;
+    surf->getCoverages(theta.data());
+    double eps = 1e-7;
+    vector_fp drop(nRxn);
+    for (size_t j = 0; j < ns; j++) {
+        if (j == kPt) {
+            continue;
+        }
+        // Perturb species j at the expense of the empty site species, keeping
+        // the total site density constant
+        theta2 = theta;
+        theta2[j] += eps;
+        theta2[kPt] -= eps * surf->size(j) / surf->size(kPt);
+        surf->setCoveragesNoNorm(theta2.data());
+        double dC = eps * surf->siteDensity() / surf->size(j);
+        for (size_t i = 0; i < nRxn; i++) {
+            drop[i] = jac(i, k0 + j) - jac(i, k0 + kPt) * surf->size(j) / surf->size(kPt);
+        }
+        check(drop, dC, "species " + surf->speciesName(j));
+        surf->setCoveragesNoNorm(theta.data());
+    }
+}
+
+TEST_F(InterfaceDerivatives, GasConcentrations)
+{
+    Eigen::MatrixXd jac = kin->netRatesOfProgress_ddCi();
+    auto thermo = gas->thermo();
+    size_t ng = thermo->nSpecies();
+    size_t k0 = kin->kineticsSpeciesIndex(0, kin->phaseIndex("gas"));
+    vector_fp conc(ng), conc2;
+    thermo->getConcentrations(conc.data());
+    vector_fp drop(nRxn);
+    for (size_t j = 0; j < ng; j++) {
+        double dC = 1e-7 * (conc[j] + 1e-3 * thermo->molarDensity());
+        conc2 = conc;
+        conc2[j] += dC;
+        thermo->setConcentrations(conc2.data());
+        for (size_t i = 0; i < nRxn; i++) {
+            drop[i] = jac(i, k0 + j);
+        }
+        check(drop, dC, "species " + thermo->speciesName(j));
+        thermo->setConcentrations(conc.data());
+    }
+}
+
+TEST_F(InterfaceDerivatives, Temperature)
+{
+    vector_fp drop(nRxn);
+    kin->getNetRatesOfProgress_ddT(drop.data());
+    auto thermo = gas->thermo();
+    double T = thermo->temperature();
+    double dT = 1e-3;
+    thermo->setState_TR(T + dT, thermo->density());
+    surf->setTemperature(T + dT);
+    check(drop, dT, "temperature");
+}
+
+TEST_F(InterfaceDerivatives, SkipCoverageDependence)
+{
+    Eigen::MatrixXd jac = kin->netRatesOfProgress_ddCi();
+    AnyMap settings;
+    settings["skip-coverage-dependence"] = true;
+    kin->setDerivativeSettings(settings);
+    Eigen::MatrixXd jacMassAction = kin->netRatesOfProgress_ddCi();
+    EXPECT_GT((jac - jacMassAction).cwiseAbs().maxCoeff(), 0.0);
+    settings.clear();
+    kin->getDerivativeSettings(settings);
+    EXPECT_TRUE(settings["skip-coverage-dependence"].asBool());
+}
+
+TEST(RateTabulation, gri30)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    size_t nr = kin->nReactions();
+    vector_fp kf_ref(nr), kf(nr), dkf_ref(nr), dkf(nr);
+
+    for (double T : {250.0, 300.0, 712.3, 1475.0, 2499.9, 2500.0, 3200.0}) {
+        gas->setState_TPX(T, OneAtm, "CH4:1, O2:2, N2:7.52, H:0.01, OH:0.01");
+        kin->clearRateTabulation();
+        kin->getFwdRateConstants(kf_ref.data());
+        kin->getFwdRateConstants_ddT(dkf_ref.data());
+        kin->setRateTabulation(300, 2500, 1e-8);
+        kin->getFwdRateConstants(kf.data());
+        kin->getFwdRateConstants_ddT(dkf.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_NEAR(kf[i], kf_ref[i], 5e-8 * std::abs(kf_ref[i]))
+                << "reaction " << i << " at T = " << T;
+            EXPECT_NEAR(dkf[i], dkf_ref[i], 1e-6 * std::abs(dkf_ref[i]) + 1e-300)
+                << "reaction " << i << " at T = " << T;
+        }
+    }
+    EXPECT_THROW(kin->setRateTabulation(2500, 300), CanteraError);
+}
+
 }
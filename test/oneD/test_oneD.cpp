@@ -0,0 +1,350 @@
+#include "gtest/gtest.h"
+#include "cantera/core.h"
+#include "cantera/onedim.h"
+#include "cantera/base/AnyMap.h"
+
+using namespace Cantera;
+
+//! Compare the Jacobian evaluated by MultiJac, which perturbs groups of grid
+//! points at once, to the finite difference Jacobian obtained by perturbing
+//! each component at each grid point separately and evaluating the residual
+//! in the neighborhood of that point.
+void checkColoredJacobian(Sim1D& sim)
+{
+    sim.evalSSJacobian();
+    OneDim& resid = sim;
+    MultiJac& jac = resid.jacobian();
+    size_t N = resid.size();
+    vector_fp x(N), r0(N), r1(N);
+    for (size_t d = 0; d < sim.nDomains(); d++) {
+        Domain1D& dom = sim.domain(d);
+        size_t nc = dom.nComponents();
+        for (size_t j = 0; j < dom.nPoints(); j++) {
+            for (size_t n = 0; n < nc; n++) {
+                x[dom.loc() + nc * j + n] = sim.value(d, n, j);
+            }
+        }
+    }
+    resid.eval(npos, x.data(), r0.data(), 0.0, 0);
+
+    // perturbations used by MultiJac
+    double rtol = 1.0e-5;
+    double atol = std::sqrt(std::numeric_limits<double>::epsilon());
+    size_t np = resid.points();
+    for (size_t j = 0; j < np; j++) {
+        for (size_t n = 0; n < resid.nVars(j); n++) {
+            size_t ipt = resid.loc(j) + n;
+            double xsave = x[ipt];
+            if (xsave >= 0) {
+                x[ipt] = xsave + xsave*rtol + atol;
+            } else {
+                x[ipt] = xsave + xsave*rtol - atol;
+            }
+            double rdx = 1.0 / (x[ipt] - xsave);
+            resid.eval(j, x.data(), r1.data(), 0.0, 0);
+            x[ipt] = xsave;
+
+            for (size_t i = (j > 0) ? j - 1 : 0; i < std::min(j + 2, np); i++) {
+                for (size_t m = 0; m < resid.nVars(i); m++) {
+                    size_t k = resid.loc(i) + m;
+                    double expected = (r1[k] - r0[k]) * rdx;
+                    EXPECT_NEAR(jac.value(k, ipt), expected,
+                                1e-12 * std::abs(expected) + 1e-300)
+                        << "row " << k << ", column " << ipt;
+                }
+            }
+        }
+    }
+}
+
+TEST(FlameletTable, h2_branches)
+{
+    auto sol = newSolution("h2o2.yaml", "", "mixture-averaged");
+    FlameletTable table(sol, 2);
+    table.setFuel("H2:1.0, AR:1.0", 300);
+    table.setOxidizer("O2:0.2, AR:0.8", 300);
+    table.setMassFluxes(0.24, 0.72);
+    table.setPressures({OneAtm, 1.2 * OneAtm});
+    table.setMixtureFractionGrid({0.0, 0.1, 0.2, 0.3, 0.5, 1.0});
+    table.setArcLength(0.2, 1e-3, 1.0);
+    table.setRefineCriteria(3.0, 0.2, 0.3, 0.1);
+    table.build();
+
+    ASSERT_EQ(table.nBranches(), 2u);
+    size_t nZ = table.nMixtureFractions();
+    size_t nsp = sol->thermo()->nSpecies();
+    for (size_t b = 0; b < table.nBranches(); b++) {
+        size_t n = table.nFlamelets(b);
+        ASSERT_GT(n, 5u);
+        EXPECT_EQ(table.temperatures(b).size(), n * nZ);
+        EXPECT_EQ(table.massFractions(b).size(), n * nZ * nsp);
+        EXPECT_EQ(table.progressSources(b).size(), n * nZ);
+
+        // The progress variable is strictly increasing
+        const auto& Lambda = table.progress(b);
+        for (size_t i = 1; i < n; i++) {
+            EXPECT_GT(Lambda[i], Lambda[i-1]);
+        }
+
+        // The branch is continued past the extinction point, where the strain
+        // factor has its maximum
+        const auto& s = table.strainFactors(b);
+        size_t iext = std::max_element(s.begin(), s.end()) - s.begin();
+        EXPECT_GT(iext, 0u);
+        EXPECT_LT(iext, n - 1);
+        const auto& Tmax = table.maxTemperatures(b);
+        EXPECT_LT(Tmax[0], Tmax[iext]);
+        EXPECT_LT(Tmax[iext], Tmax[n-1]);
+
+        // Pure oxidizer and pure fuel
+        EXPECT_NEAR(table.temperatures(b)[0], 300, 1e-6);
+        EXPECT_NEAR(table.temperatures(b)[nZ-1], 300, 1e-6);
+    }
+
+    AnyMap data = table.table();
+    auto branches = data["branches"].asVector<AnyMap>();
+    ASSERT_EQ(branches.size(), 2u);
+    EXPECT_DOUBLE_EQ(branches[1]["pressure"].asDouble(), 1.2 * OneAtm);
+    EXPECT_EQ(branches[1]["progress"].asVector<double>().size(),
+              table.nFlamelets(1));
+}
+
+TEST(Sim1D, binary_save_restore)
+{
+    auto sol = newSolution("h2o2.yaml", "", "mixture-averaged");
+    sol->thermo()->setState_TPX(300, OneAtm, "H2:1.1, O2:1, AR:5");
+    StFlow flow(sol);
+    flow.setFreeFlow();
+    vector_fp z{0.0, 0.01, 0.02, 0.03, 0.04};
+    flow.setupGrid(z.size(), z.data());
+    Inlet1D inlet;
+    Outlet1D outlet;
+    std::vector<Domain1D*> domains{&inlet, &flow, &outlet};
+    Sim1D sim(domains);
+    vector_fp locs{0.0, 1.0};
+    vector_fp T{300, 2000};
+    sim.setInitialGuess("T", locs, T);
+    size_t nv = flow.nComponents();
+    size_t np = flow.nPoints();
+
+    std::string fname = "generated-sim1d.ctsol";
+    std::remove(fname.c_str());
+    sim.save(fname, "first", "initial guess", 0);
+    sim.setValue(1, flow.componentIndex("T"), 2, 1234.5);
+    sim.save(fname, "second", "modified", 0);
+    vector_fp x(nv * np);
+    for (size_t j = 0; j < np; j++) {
+        for (size_t n = 0; n < nv; n++) {
+            x[nv * j + n] = sim.value(1, n, j);
+        }
+    }
+
+    // Saving with an existing id replaces that solution
+    sim.setValue(1, flow.componentIndex("T"), 2, 987.6);
+    sim.save(fname, "first", "replaced", 0);
+
+    // Restore into a different simulation with a dummy grid
+    StFlow flow2(sol);
+    flow2.setFreeFlow();
+    Inlet1D inlet2;
+    Outlet1D outlet2;
+    std::vector<Domain1D*> domains2{&inlet2, &flow2, &outlet2};
+    Sim1D sim2(domains2);
+    sim2.restore(fname, "second", 0);
+    ASSERT_EQ(flow2.nPoints(), np);
+    for (size_t j = 0; j < np; j++) {
+        EXPECT_DOUBLE_EQ(flow2.grid(j), z[j]);
+        for (size_t n = 0; n < nv; n++) {
+            EXPECT_DOUBLE_EQ(sim2.value(1, n, j), x[nv * j + n]);
+        }
+    }
+
+    sim2.restore(fname, "first", 0);
+    EXPECT_DOUBLE_EQ(sim2.value(1, flow2.componentIndex("T"), 2), 987.6);
+    EXPECT_THROW(sim2.restore(fname, "third", 0), CanteraError);
+}
+
+TEST(Sim1D, toggle_energy_unchanged_grid)
+{
+    auto sol = newSolution("h2o2.yaml", "", "mixture-averaged");
+    auto gas = sol->thermo();
+    gas->setState_TPX(500, 0.1 * OneAtm, "H2:0.5, O2:0.5, AR:1.5");
+    size_t nsp = gas->nSpecies();
+    vector_fp yin(nsp), yeq(nsp);
+    gas->getMassFractions(yin.data());
+    double mdot = 0.15 * gas->density();
+    double u0 = 0.15;
+    gas->equilibrate("HP");
+    gas->getMassFractions(yeq.data());
+    double Teq = gas->temperature();
+    double u1 = mdot / gas->density();
+
+    StFlow flow(sol);
+    flow.setAxisymmetricFlow();
+    vector_fp z{0.0, 0.4, 0.8, 1.2, 1.6, 2.0};
+    flow.setupGrid(z.size(), z.data());
+    Inlet1D burner;
+    burner.setMoleFractions("H2:0.5, O2:0.5, AR:1.5");
+    burner.setMdot(mdot);
+    burner.setTemperature(500);
+    Outlet1D outlet;
+    std::vector<Domain1D*> domains{&burner, &flow, &outlet};
+    Sim1D sim(domains);
+
+    vector_fp locs{0.0, 0.2, 1.0};
+    vector_fp values{u0, u1, u1};
+    sim.setInitialGuess("velocity", locs, values);
+    values = {500, Teq, Teq};
+    sim.setInitialGuess("T", locs, values);
+    for (size_t k = 0; k < nsp; k++) {
+        values = {yin[k], yeq[k], yeq[k]};
+        sim.setInitialGuess(gas->speciesName(k), locs, values);
+    }
+
+    flow.setSteadyTolerances(1e-8, 1e-14);
+    flow.fixTemperature();
+    sim.solve(0, false);
+    flow.solveEnergyEqn();
+    sim.solve(0, true);
+
+    size_t np = flow.nPoints();
+    size_t nv = flow.nComponents();
+    size_t iT = flow.componentIndex("T");
+    vector_fp x0(nv * np);
+    for (size_t j = 0; j < np; j++) {
+        for (size_t n = 0; n < nv; n++) {
+            x0[nv * j + n] = sim.value(1, n, j);
+        }
+    }
+
+    // Solving again on the same grid, with the temperature fixed to the
+    // converged profile or with the energy equation enabled again, does not
+    // change the solution beyond the solver tolerances
+    flow.fixTemperature();
+    sim.solve(0, true);
+    ASSERT_EQ(flow.nPoints(), np);
+    for (size_t j = 0; j < np; j++) {
+        EXPECT_DOUBLE_EQ(sim.value(1, iT, j), x0[nv * j + iT]);
+        for (size_t n = 0; n < nv; n++) {
+            EXPECT_NEAR(sim.value(1, n, j), x0[nv * j + n],
+                        1e-6 * std::abs(x0[nv * j + n]) + 1e-12)
+                << flow.componentName(n) << " at point " << j;
+        }
+    }
+
+    flow.solveEnergyEqn();
+    sim.solve(0, true);
+    ASSERT_EQ(flow.nPoints(), np);
+    for (size_t j = 0; j < np; j++) {
+        for (size_t n = 0; n < nv; n++) {
+            EXPECT_NEAR(sim.value(1, n, j), x0[nv * j + n],
+                        1e-6 * std::abs(x0[nv * j + n]) + 1e-12)
+                << flow.componentName(n) << " at point " << j;
+        }
+    }
+}
+
+TEST(MultiJac, colored_free_flame)
+{
+    auto sol = newSolution("h2o2.yaml", "", "mixture-averaged");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    gas->setState_TPX(300, OneAtm, "H2:1.1, O2:1, AR:5");
+    vector_fp yin(nsp), yeq(nsp);
+    gas->getMassFractions(yin.data());
+    double rho_in = gas->density();
+    gas->equilibrate("HP");
+    gas->getMassFractions(yeq.data());
+    double Tad = gas->temperature();
+    double uout = 0.5 * rho_in / gas->density();
+
+    StFlow flow(sol);
+    flow.setFreeFlow();
+    vector_fp z{0.0, 0.005, 0.01, 0.012, 0.014, 0.016, 0.02, 0.03};
+    flow.setupGrid(z.size(), z.data());
+    Inlet1D inlet;
+    inlet.setMoleFractions("H2:1.1, O2:1, AR:5");
+    inlet.setMdot(0.5 * rho_in);
+    inlet.setTemperature(300);
+    Outlet1D outlet;
+    std::vector<Domain1D*> domains{&inlet, &flow, &outlet};
+    Sim1D sim(domains);
+
+    vector_fp locs{0.0, 0.3, 0.7, 1.0};
+    vector_fp values{0.5, 0.5, uout, uout};
+    sim.setInitialGuess("velocity", locs, values);
+    values = {300, 300, Tad, Tad};
+    sim.setInitialGuess("T", locs, values);
+    for (size_t k = 0; k < nsp; k++) {
+        values = {yin[k], yin[k], yeq[k], yeq[k]};
+        sim.setInitialGuess(gas->speciesName(k), locs, values);
+    }
+    flow.solveEnergyEqn();
+
+    // The fixed temperature point is added between two existing grid points
+    sim.setFixedTemperature(0.5 * (300 + Tad));
+    ASSERT_EQ(flow.nPoints(), z.size() + 1);
+    double zfixed = sim.fixedTemperatureLocation();
+    EXPECT_TRUE(std::find(flow.grid().begin(), flow.grid().end(), zfixed)
+                != flow.grid().end());
+
+    checkColoredJacobian(sim);
+}
+
+TEST(MultiJac, colored_counterflow_flame)
+{
+    auto sol = newSolution("h2o2.yaml", "", "mixture-averaged");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    vector_fp yf(nsp), yo(nsp), yeq(nsp);
+    gas->setState_TPX(300, OneAtm, "H2:1, AR:1");
+    gas->getMassFractions(yf.data());
+    double rho_f = gas->density();
+    gas->setState_TPX(300, OneAtm, "O2:0.21, AR:0.79");
+    gas->getMassFractions(yo.data());
+    double rho_o = gas->density();
+    gas->setState_TPX(300, OneAtm, "H2:0.42, O2:0.21, AR:1.21");
+    gas->equilibrate("HP");
+    gas->getMassFractions(yeq.data());
+    double Tad = gas->temperature();
+
+    StFlow flow(sol);
+    flow.setAxisymmetricFlow();
+    vector_fp z{0.0, 0.002, 0.004, 0.006, 0.008, 0.01, 0.012, 0.016, 0.02};
+    flow.setupGrid(z.size(), z.data());
+    Inlet1D fuel;
+    fuel.setMoleFractions("H2:1, AR:1");
+    fuel.setMdot(0.2);
+    fuel.setTemperature(300);
+    Inlet1D oxidizer;
+    oxidizer.setMoleFractions("O2:0.21, AR:0.79");
+    oxidizer.setMdot(0.3);
+    oxidizer.setTemperature(300);
+    std::vector<Domain1D*> domains{&fuel, &flow, &oxidizer};
+    Sim1D sim(domains);
+
+    vector_fp locs{0.0, 0.5, 1.0};
+    vector_fp values{0.2 / rho_f, 0.0, -0.3 / rho_o};
+    sim.setInitialGuess("velocity", locs, values);
+    values = {0.0, 100.0, 0.0};
+    sim.setInitialGuess("spread_rate", locs, values);
+    values = {300, Tad, 300};
+    sim.setInitialGuess("T", locs, values);
+    for (size_t k = 0; k < nsp; k++) {
+        values = {yf[k], yeq[k], yo[k]};
+        sim.setInitialGuess(gas->speciesName(k), locs, values);
+    }
+    flow.solveEnergyEqn();
+
+    checkColoredJacobian(sim);
+}
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from test_oneD.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    Cantera::make_deprecation_warnings_fatal();
+    int result = RUN_ALL_TESTS();
+    Cantera::appdelete();
+    return result;
+}
@@ -438,6 +438,52 @@ class TestFreeFlame(utilities.CanteraTest):
         self.assertNear(Su_multi, Su_soret, 2e-1)
         self.assertNotEqual(Su_multi, Su_soret)
 
+    def test_analytic_chemistry_jacobian(self):
+        reactants = 'H2:1.1, O2:1, AR:5.3'
+        self.create_sim(ct.one_atm, 300, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su_fd = self.sim.velocity[0]
+        T_fd = self.sim.T
+
+        self.assertFalse(self.sim.flame.analytic_chemistry_jacobian)
+        self.create_sim(ct.one_atm, 300, reactants)
+        self.sim.flame.analytic_chemistry_jacobian = True
+        self.assertTrue(self.sim.flame.analytic_chemistry_jacobian)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        # The Jacobian only affects the Newton iterations, not the solution
+        self.assertNear(Su_fd, self.sim.velocity[0], 1e-3)
+        self.assertNear(T_fd[-1], self.sim.T[-1], 1e-4)
+
+    def test_sparse_jacobian(self):
+        reactants = 'H2:1.1, O2:1, AR:5.3'
+        self.create_sim(ct.one_atm, 300, reactants)
+        self.solve_fixed_T()
+        self.solve_mix()
+        Su_band = self.sim.velocity[0]
+        T_band = self.sim.T
+
+        self.assertFalse(self.sim.sparse_jacobian)
+        self.create_sim(ct.one_atm, 300, reactants)
+        self.sim.sparse_jacobian = True
+        self.assertTrue(self.sim.sparse_jacobian)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        # The linear solver only affects the Newton iterations
+        self.assertNear(Su_band, self.sim.velocity[0], 1e-4)
+        self.assertNear(T_band[-1], self.sim.T[-1], 1e-5)
+
+        # Sensitivities rely on the adjoint solver
+        dSdk = self.sim.get_flame_speed_reaction_sensitivities()
+        self.sim.sparse_jacobian = False
+        self.assertFalse(self.sim.sparse_jacobian)
+        self.sim.solve(loglevel=0, refine_grid=False)
+        dSdk_band = self.sim.get_flame_speed_reaction_sensitivities()
+        self.assertArrayNear(dSdk, dSdk_band, 1e-4, 1e-6)
+
     def test_unity_lewis(self):
         self.create_sim(ct.one_atm, 300, 'H2:1.1, O2:1, AR:5.3')
         self.sim.transport_model = 'UnityLewis'
@@ -887,6 +933,35 @@ class TestDiffusionFlame(utilities.CanteraTest):
                                             rtol=1e-2, atol=1e-8, xtol=1e-2)
             self.assertFalse(bad, bad)
 
+    def test_continuation(self):
+        self.create_sim(p=ct.one_atm)
+        self.solve_fixed_T()
+        self.solve_mix()
+
+        def set_strain(factor):
+            self.sim.fuel_inlet.mdot = 0.24 * factor
+            self.sim.oxidizer_inlet.mdot = 0.72 * factor
+
+        factors = [1.2, 1.4, 1.6, 1.8]
+        solved = []
+        Tmax = []
+        def store(factor):
+            solved.append(factor)
+            Tmax.append(max(self.sim.T))
+
+        nsaved = self.sim.solve_continuation(factors, set_strain, store)
+        self.assertEqual(solved, factors)
+        self.assertGreater(nsaved, 0)
+        self.assertLessEqual(nsaved, len(factors))
+        self.assertNear(self.sim.fuel_inlet.mdot, 0.24 * factors[-1])
+
+        # Compare with a solution computed without continuation
+        self.create_sim(p=ct.one_atm, mdot_fuel=0.24 * factors[-1],
+                        mdot_ox=0.72 * factors[-1])
+        self.solve_fixed_T()
+        self.solve_mix()
+        self.assertNear(Tmax[-1], max(self.sim.T), 1e-3)
+
     def run_extinction(self, mdot_fuel, mdot_ox, T_ox, width, P):
         self.create_sim(fuel='H2:1.0', oxidizer='O2:1.0', p=ct.one_atm*P,
                         mdot_fuel=mdot_fuel, mdot_ox=mdot_ox, T_ox=T_ox, width=width)
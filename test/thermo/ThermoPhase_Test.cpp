@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/MultiSpeciesThermo.h"
 #include "cantera/base/Solution.h"
 
 namespace Cantera
@@ -92,6 +93,37 @@ TEST_F(TestThermoMethods, setState_AnyMap)
     EXPECT_NEAR(thermo->temperature(), 298.15, 1e-6);
 }
 
+TEST_F(TestThermoMethods, setState_HP_UV_ideal_gas)
+{
+    thermo->setState_TPX(1200, 2e5, "H2:0.3, O2:0.2, H2O:0.1, AR:0.4");
+    auto& spthermo = thermo->speciesThermo();
+    for (double T : {250.0, 800.0, 1500.0, 2500.0, 4000.0}) {
+        thermo->setState_TP(T, 2e5);
+        double h = thermo->enthalpy_mass();
+        double u = thermo->intEnergy_mass();
+        double v = 1.0 / thermo->density();
+
+        thermo->setState_TP(1200, 1e5);
+        spthermo.resetUpdateCount();
+        thermo->setState_HP(h, 2e5, 1e-12);
+        EXPECT_NEAR(thermo->temperature(), T, 1e-9 * T);
+        EXPECT_DOUBLE_EQ(thermo->pressure(), 2e5);
+        EXPECT_LE(spthermo.nUpdates(), 8u);
+
+        thermo->setState_TP(1200, 1e5);
+        spthermo.resetUpdateCount();
+        thermo->setState_UV(u, v, 1e-12);
+        EXPECT_NEAR(thermo->temperature(), T, 1e-9 * T);
+        EXPECT_DOUBLE_EQ(thermo->density(), 1.0 / v);
+        EXPECT_LE(spthermo.nUpdates(), 8u);
+
+        // Starting from the solution requires no additional evaluations
+        spthermo.resetUpdateCount();
+        EXPECT_TRUE(thermo->setTemperatureFromEnergy(u, 1e-12, true));
+        EXPECT_EQ(spthermo.nUpdates(), 0u);
+    }
+}
+
 TEST_F(TestThermoMethods, setConcentrations)
 {
     vector_fp C0(thermo->nSpecies());
@@ -89,6 +89,60 @@ TEST_F(SpeciesThermoInterpTypeTest, install_nasa)
     EXPECT_DOUBLE_EQ(p2.cp_mass(), p.cp_mass());
 }
 
+TEST_F(SpeciesThermoInterpTypeTest, nasa_groups)
+{
+    // NasaPoly2 species with different midpoint temperatures, mixed with
+    // another parameterization
+    double o2_coeffs[15], h2_coeffs[15];
+    std::copy(o2_nasa_coeffs, o2_nasa_coeffs + 15, o2_coeffs);
+    std::copy(h2_nasa_coeffs, h2_nasa_coeffs + 15, h2_coeffs);
+    o2_coeffs[0] = 1200;
+    auto sO2 = make_shared<Species>("O2", parseCompString("O:2"));
+    auto sH2 = make_shared<Species>("H2", parseCompString("H:2"));
+    auto sCO = make_shared<Species>("CO", parseCompString("C:1 O:1"));
+    auto sH2O = make_shared<Species>("H2O", parseCompString("H:2 O:1"));
+    sO2->thermo.reset(new NasaPoly2(200, 3500, 101325, o2_coeffs));
+    sH2->thermo.reset(new NasaPoly2(200, 3500, 101325, h2_coeffs));
+    sCO->thermo.reset(new ShomatePoly2(200, 6000, 101325, co_shomate_coeffs));
+    sH2O->thermo.reset(new NasaPoly2(200, 3500, 101325, h2o_nasa_coeffs));
+    std::vector<shared_ptr<Species>> species{sO2, sH2, sCO, sH2O};
+    for (auto& sp : species) {
+        p.addSpecies(sp);
+    }
+    p.initThermo();
+
+    vector_fp cp(4), h(4), s(4);
+    auto check = [&](double T) {
+        p.setState_TP(T, OneAtm);
+        p.getCp_R_ref(cp.data());
+        p.getEnthalpy_RT_ref(h.data());
+        p.getEntropy_R_ref(s.data());
+        for (size_t k = 0; k < 4; k++) {
+            double cp_ref, h_ref, s_ref;
+            species[k]->thermo->updatePropertiesTemp(T, &cp_ref, &h_ref, &s_ref);
+            EXPECT_DOUBLE_EQ(cp[k], cp_ref) << "species " << k << ", T = " << T;
+            EXPECT_DOUBLE_EQ(h[k], h_ref) << "species " << k << ", T = " << T;
+            EXPECT_DOUBLE_EQ(s[k], s_ref) << "species " << k << ", T = " << T;
+        }
+    };
+    for (double T : {500.0, 1100.0, 1500.0}) {
+        check(T);
+    }
+
+    // Modified heat of formation
+    p.modifyOneHf298SS(0, -1e6);
+    check(1100.0);
+    p.resetHf298(0);
+    check(1100.0);
+
+    // Modified midpoint temperature
+    auto sO2b = make_shared<Species>("O2", parseCompString("O:2"));
+    sO2b->thermo.reset(new NasaPoly2(200, 3500, 101325, o2_nasa_coeffs));
+    species[0] = sO2b;
+    p.modifySpecies(0, sO2b);
+    check(1100.0);
+}
+
 TEST_F(SpeciesThermoInterpTypeTest, install_shomate)
 {
     // Compare against instantiation from YAML file
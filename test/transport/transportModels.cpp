@@ -2,6 +2,7 @@
 
 #include "cantera/base/Solution.h"
 #include "cantera/transport/TransportFactory.h"
+#include "cantera/transport/BundledMixTransport.h"
 #include "cantera/thermo/ThermoFactory.h"
 
 using namespace Cantera;
@@ -139,3 +140,84 @@ TEST_F(DefaultTransportTest, check_scalar)
     EXPECT_GE(tr->thermalConductivity(), 0.);
     EXPECT_FALSE(tr->CKMode());
 }
+
+TEST(MixTransport, batchedProperties)
+{
+    for (std::string model : {"Mix", "UnityLewis", "Multi"}) {
+        auto soln = newSolution("h2o2.yaml", "", model);
+        auto gas = soln->thermo();
+        auto tr = soln->transport();
+        size_t nsp = gas->nSpecies();
+        size_t nPoints = 4;
+        vector_fp T{300.0, 900.0, 1500.0, 2400.0};
+        vector_fp P{OneAtm, 2 * OneAtm, 0.5 * OneAtm, OneAtm};
+        vector_fp X(nPoints * nsp, 0.0);
+        for (size_t n = 0; n < nPoints; n++) {
+            X[n * nsp + gas->speciesIndex("H2")] = 0.2 + 0.1 * n;
+            X[n * nsp + gas->speciesIndex("O2")] = 0.3;
+            X[n * nsp + gas->speciesIndex("H2O")] = 0.05 * n;
+            X[n * nsp + gas->speciesIndex("AR")] = 0.5 - 0.15 * n;
+        }
+        X[3 * nsp + gas->speciesIndex("AR")] = 0.0;
+
+        vector_fp visc(nPoints), cond(nPoints), D(nPoints * nsp);
+        tr->getMixTransportProperties(nPoints, T.data(), P.data(), X.data(),
+                                      visc.data(), cond.data(), D.data());
+        vector_fp Dref(nsp);
+        for (size_t n = 0; n < nPoints; n++) {
+            gas->setState_TPX(T[n], P[n], &X[n * nsp]);
+            EXPECT_NEAR(visc[n], tr->viscosity(), 1e-12 * visc[n]) << model;
+            EXPECT_NEAR(cond[n], tr->thermalConductivity(), 1e-12 * cond[n])
+                << model;
+            tr->getMixDiffCoeffs(Dref.data());
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(D[n * nsp + k], Dref[k], 1e-12 * Dref[k]) << model;
+            }
+        }
+    }
+}
+
+TEST(BundledMixTransport, compareMix)
+{
+    auto mix = newSolution("gri30.yaml", "", "mixture-averaged");
+    auto bundled = newSolution("gri30.yaml", "", "mixture-averaged-bundled");
+    auto tr = dynamic_cast<BundledMixTransport*>(bundled->transport().get());
+    ASSERT_TRUE(tr != nullptr);
+    EXPECT_EQ(tr->transportModel(), "BundledMix");
+    size_t nsp = mix->thermo()->nSpecies();
+    vector_fp Dmix(nsp), Dbundled(nsp);
+    std::string X = "CH4:0.3, O2:1.0, N2:3.76, H2O:0.2, CO2:0.1, H:0.01, OH:0.01";
+
+    auto compare = [&](double rtol) {
+        for (double T : {400.0, 1200.0, 2200.0}) {
+            mix->thermo()->setState_TPX(T, OneAtm, X);
+            bundled->thermo()->setState_TPX(T, OneAtm, X);
+            double mu = mix->transport()->viscosity();
+            EXPECT_NEAR(tr->viscosity(), mu, rtol * mu);
+            mix->transport()->getMixDiffCoeffs(Dmix.data());
+            tr->getMixDiffCoeffs(Dbundled.data());
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(Dbundled[k], Dmix[k], rtol * Dmix[k]) << k;
+            }
+        }
+    };
+
+    // Only species with identical fits (for example, CH2 and CH2(S)) are
+    // combined
+    tr->setBundleTolerance(0.0);
+    EXPECT_LT(tr->nBundles(), nsp);
+    EXPECT_EQ(tr->bundleIndex(mix->thermo()->speciesIndex("CH2")),
+              tr->bundleIndex(mix->thermo()->speciesIndex("CH2(S)")));
+    compare(1e-12);
+    size_t nExact = tr->nBundles();
+
+    tr->setBundleTolerance(0.05);
+    EXPECT_LT(tr->nBundles(), nExact);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_EQ(tr->bundleIndex(tr->bundleRepresentative(tr->bundleIndex(k))),
+                  tr->bundleIndex(k));
+    }
+    compare(0.05);
+
+    EXPECT_THROW(tr->setBundleTolerance(-1.0), CanteraError);
+}
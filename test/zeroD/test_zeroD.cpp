@@ -4,9 +4,13 @@
 #include "cantera/zerodim.h"
 #include "cantera/base/Interface.h"
 #include "cantera/numerics/eigen_sparse.h"
+#include "cantera/numerics/eigen_dense.h"
+#include "cantera/base/Array.h"
 #include "cantera/numerics/PreconditionerFactory.h"
 #include "cantera/numerics/AdaptivePreconditioner.h"
 
+#include <thread>
+
 using namespace Cantera;
 
 // This test ensures that prior reactor initialization of a reactor does
@@ -133,6 +137,53 @@ TEST(AdaptivePreconditionerTests, test_adaptive_precon_utils)
     EXPECT_TRUE(precon.matrix().isApprox(identity));
 }
 
+TEST(AdaptivePreconditionerTests, test_precon_pattern_reuse)
+{
+    size_t testSize = 5;
+    AdaptivePreconditioner precon;
+    precon.initialize(testSize);
+    precon.setThreshold(0.0);
+    double gamma = 0.1;
+    precon.setGamma(gamma);
+    // tridiagonal jacobian with a duplicate entry in the first row
+    auto setJacobian = [&](double scale) {
+        precon.reset();
+        for (size_t i = 0; i < testSize; i++) {
+            precon.setValue(i, i, -2.0 * scale * (i + 1));
+            if (i > 0) {
+                precon.setValue(i, i - 1, scale);
+            }
+            if (i + 1 < testSize) {
+                precon.setValue(i, i + 1, scale * (i + 3));
+            }
+        }
+        precon.setValue(0, 1, 0.5 * scale);
+    };
+    for (double scale : {1.0, 3.0, -0.5}) {
+        setJacobian(scale);
+        precon.setup();
+        Eigen::SparseMatrix<double> identity(testSize, testSize);
+        identity.setIdentity();
+        Eigen::SparseMatrix<double> expected = identity - gamma * precon.jacobian();
+        EXPECT_TRUE(precon.matrix().isApprox(expected));
+        EXPECT_DOUBLE_EQ(precon.matrix().coeff(0, 1), -gamma * 3.5 * scale);
+        // solution of the preconditioned system
+        vector_fp rhs(testSize, 1.0);
+        vector_fp output(testSize, 0.0);
+        precon.solve(testSize, rhs.data(), output.data());
+        Eigen::Map<Eigen::VectorXd> x(output.data(), testSize);
+        Eigen::VectorXd residual = expected * x - Eigen::VectorXd::Ones(testSize);
+        EXPECT_LT(residual.norm(), 1e-10);
+    }
+    // pattern is only analyzed once as long as it does not change
+    EXPECT_EQ(precon.nPatternUpdates(), 1u);
+    // a new pattern is detected
+    precon.setValue(testSize - 1, 0, 1.0);
+    precon.setup();
+    EXPECT_EQ(precon.nPatternUpdates(), 2u);
+    EXPECT_DOUBLE_EQ(precon.matrix().coeff(testSize - 1, 0), -gamma);
+}
+
 TEST(AdaptivePreconditionerTests, test_precon_solver_stats)
 {
     // setting up solution object and thermo/kinetics pointers
@@ -165,6 +216,250 @@ TEST(AdaptivePreconditionerTests, test_precon_solver_stats)
     EXPECT_GE(stats["nonlinear_conv_fails"].asInt(), 0);
 }
 
+TEST(MoleReactorTestSet, test_surface_jacobian)
+{
+    auto gas = newSolution("ptcombust.yaml", "gas");
+    auto iface = newInterface("ptcombust.yaml", "Pt_surf", {gas});
+    gas->thermo()->setState_TPX(900, OneAtm,
+        "CH4:0.095, O2:0.21, AR:0.655, H2O:0.01, CO:0.02, H2:0.01");
+    IdealGasMoleReactor reactor;
+    reactor.insert(gas);
+    reactor.setInitialVolume(1e-3);
+    reactor.setEnergy(false);
+    ReactorSurface surf;
+    surf.setKinetics(iface->kinetics().get());
+    surf.setArea(0.1);
+    surf.setCoverages(
+        "PT(S):0.5, O(S):0.2, H(S):0.1, CO(S):0.1, OH(S):0.05, C(S):0.05");
+    reactor.addSurface(&surf);
+    ReactorNet net;
+    net.addReactor(reactor);
+    net.initialize();
+
+    Eigen::MatrixXd jac = reactor.jacobian();
+    Eigen::MatrixXd fdJac = reactor.finiteDifferenceJacobian();
+    size_t nv = reactor.neq();
+    size_t nsp = gas->thermo()->nSpecies();
+    size_t surfStart = nv - iface->thermo()->nSpecies();
+    // Compare rows of the surface species and the columns of the surface
+    // species in the rows of the gas species, which do not depend on the
+    // derivatives of the gas-phase reactions. The tolerance accounts for the
+    // round-off error of the finite differences of the small surface moles.
+    for (size_t i = surfStart - nsp; i < nv; i++) {
+        double scale = fdJac.row(i).cwiseAbs().maxCoeff();
+        size_t j0 = (i < surfStart) ? surfStart : surfStart - nsp;
+        for (size_t j = j0; j < nv; j++) {
+            EXPECT_NEAR(jac(i, j), fdJac(i, j), 1e-3 * scale)
+                << "row " << i << ", column " << j;
+        }
+    }
+}
+
+TEST(ReactorEnsemble, ignition_delays)
+{
+    auto sol = newSolution("h2o2.yaml");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    gas->setState_TPX(300.0, OneAtm, "H2:2.0, O2:1.0, AR:4.0");
+    vector_fp Y0(gas->massFractions(), gas->massFractions() + nsp);
+
+    size_t nStates = 5;
+    vector_fp T0(nStates), P0(nStates, OneAtm), Y(nStates * nsp);
+    for (size_t i = 0; i < nStates; i++) {
+        T0[i] = 1100.0 + 50.0 * i;
+        std::copy(Y0.begin(), Y0.end(), Y.begin() + i * nsp);
+    }
+    P0[2] = 5 * OneAtm;
+
+    ReactorEnsemble ensemble(sol, "IdealGasConstPressureReactor", 3);
+    EXPECT_EQ(ensemble.nThreads(), 3u);
+    ensemble.setInitialStates(nStates, T0.data(), P0.data(), Y.data());
+    ensemble.setEndTime(2e-3);
+    ensemble.setOutputTimes({1e-4, 1e-3});
+    ensemble.integrate();
+
+    // The state of the original Solution is not modified
+    EXPECT_DOUBLE_EQ(gas->temperature(), 300.0);
+
+    // Compare with reactors integrated one at a time
+    for (size_t i = 0; i < nStates; i++) {
+        gas->setState_TPY(T0[i], P0[i], Y0.data());
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setTolerances(1e-9, 1e-15);
+        while (reactor.temperature() < T0[i] + 400) {
+            net.step();
+        }
+        double tig = ensemble.ignitionDelays()[i];
+        EXPECT_GT(tig, 0.0);
+        EXPECT_LE(tig, net.time());
+        EXPECT_NEAR(tig, net.time(), 0.05 * net.time());
+
+        net.advance(1e-3);
+        EXPECT_NEAR(ensemble.sampledTemperatures()[2*i + 1],
+                    reactor.temperature(), 1e-4 * reactor.temperature());
+        net.advance(2e-3);
+        EXPECT_NEAR(ensemble.finalTemperatures()[i], reactor.temperature(),
+                    1e-4 * reactor.temperature());
+        EXPECT_NEAR(ensemble.finalPressures()[i], P0[i], 1e-8 * P0[i]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(ensemble.finalMassFractions()[i * nsp + k],
+                        gas->massFraction(k), 1e-6);
+        }
+    }
+}
+
+TEST(ZeroDim, adaptive_chemistry)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    std::string X0 = "CH4:1.0, O2:2.0, N2:7.52";
+    double T0 = 1600.0;
+
+    auto integrate = [&](bool adaptive, double& tig) {
+        gas->setState_TPX(T0, OneAtm, X0);
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        if (adaptive) {
+            reactor.setAdaptiveChemistry({"CH4", "O2", "CO2", "H2O"}, 1e-3);
+        }
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setTolerances(1e-7, 1e-14);
+        // Resolve the ignition time using the internal time steps of the
+        // integrator, interpolating linearly within the step where the
+        // temperature rise exceeds 400 K
+        double Tig = T0 + 400;
+        double tprev = net.time();
+        double Tprev = reactor.temperature();
+        tig = NAN;
+        while (std::isnan(tig) && net.time() < 1e-3) {
+            double t = net.step();
+            double T = reactor.temperature();
+            if (T > Tig) {
+                tig = tprev + (t - tprev) * (Tig - Tprev) / (T - Tprev);
+            }
+            tprev = t;
+            Tprev = T;
+        }
+        net.advance(1e-3);
+        if (adaptive) {
+            // Inactive reactions have zero rates of progress
+            vector_fp ropf(kin->nReactions());
+            kin->getFwdRatesOfProgress(ropf.data());
+            size_t nZero = std::count(ropf.begin(), ropf.end(), 0.0);
+            EXPECT_GE(nZero, kin->nReactions() - reactor.nActiveReactions());
+
+            const auto& times = net.adaptiveChemistryTimes();
+            const auto& nActive = net.adaptiveChemistryActiveReactions();
+            EXPECT_EQ(times.size(), nActive.size());
+            EXPECT_GT(times.size(), 10u);
+            EXPECT_LT(*std::min_element(nActive.begin(), nActive.end()),
+                      kin->nReactions() / 2);
+            EXPECT_EQ(nActive.back(), reactor.nActiveReactions());
+            reactor.clearAdaptiveChemistry();
+            EXPECT_EQ(reactor.nActiveReactions(), kin->nReactions());
+        }
+        return reactor.temperature();
+    };
+
+    double tigFull, tigReduced;
+    double Tfull = integrate(false, tigFull);
+    double Treduced = integrate(true, tigReduced);
+    EXPECT_NEAR(Treduced, Tfull, 1e-3 * Tfull);
+    EXPECT_FALSE(std::isnan(tigFull));
+    EXPECT_NEAR(tigReduced, tigFull, 1e-2 * tigFull);
+}
+
+TEST(IsatTable, retrieve_grow_add)
+{
+    auto sol = newSolution("h2o2.yaml");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    gas->setState_TPX(1200.0, OneAtm, "H2:2.0, O2:1.0, AR:4.0, H:1e-5");
+    vector_fp Y0(gas->massFractions(), gas->massFractions() + nsp);
+
+    // The time step ends in the induction period, where the temperature and
+    // the radical mass fractions change significantly but smoothly
+    double tol = 1e-4;
+    IsatTable table(sol);
+    table.setTimeStep(2e-5);
+    table.setTolerance(tol);
+    table.setIntegratorTolerances(1e-10, 1e-16);
+
+    // Error of the scaled composition vector (T / 1000 K, P / 1 atm, Y)
+    auto scaledError = [&](double Ta, double Tb, double Pa, double Pb,
+                           const vector_fp& Ya, const vector_fp& Yb) {
+        double err2 = pow((Ta - Tb) / 1000.0, 2) + pow((Pa - Pb) / OneAtm, 2);
+        for (size_t k = 0; k < nsp; k++) {
+            err2 += pow(Ya[k] - Yb[k], 2);
+        }
+        return sqrt(err2);
+    };
+
+    // The first query adds a record, and the same state is retrieved exactly
+    double T1 = 1200.0, P1 = OneAtm;
+    vector_fp Y1 = Y0;
+    table.advance(T1, P1, Y1.data());
+    EXPECT_EQ(table.nRecords(), 1u);
+    // The mapping is far from the identity compared to the tolerance
+    EXPECT_GT(scaledError(T1, 1200.0, P1, OneAtm, Y1, Y0), 10 * tol);
+    EXPECT_GT(T1, 1202.0);
+    double T2 = 1200.0, P2 = OneAtm;
+    vector_fp Y2 = Y0;
+    table.advance(T2, P2, Y2.data());
+    EXPECT_DOUBLE_EQ(T2, T1);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_DOUBLE_EQ(Y2[k], Y1[k]);
+    }
+
+    // Nearby states are retrieved, grown or added, and agree with direct
+    // integration
+    for (size_t n = 0; n < 20; n++) {
+        double T = 1200.0 + 0.01 * n, P = OneAtm;
+        vector_fp Y = Y0;
+        Y[gas->speciesIndex("H")] *= 1.0 + 0.001 * n;
+        double Td = T, Pd = P;
+        vector_fp Yd = Y;
+        table.advance(T, P, Y.data());
+        table.integrate(Td, Pd, Yd.data());
+        EXPECT_LE(scaledError(T, Td, P, Pd, Y, Yd), tol) << "query " << n;
+    }
+
+    AnyMap stats = table.stats();
+    EXPECT_EQ(stats["queries"].asInt(), 22);
+    EXPECT_EQ(stats["retrieves"].asInt() + stats["grows"].asInt()
+              + stats["adds"].asInt() + stats["direct"].asInt(), 22);
+    EXPECT_GE(stats["retrieves"].asInt(), 1);
+    EXPECT_EQ(stats["records"].asInt(), stats["adds"].asInt());
+
+    // Concurrent queries
+    table.clear();
+    std::vector<std::thread> threads;
+    std::vector<double> Tout(4);
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([&, i]() {
+            for (size_t n = 0; n < 5; n++) {
+                double T = 1200.0 + 0.01 * n, P = OneAtm;
+                vector_fp Y = Y0;
+                table.advance(T, P, Y.data());
+                Tout[i] = T;
+            }
+            thread_complete();
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(table.stats()["queries"].asInt(), 20);
+    for (size_t i = 1; i < 4; i++) {
+        EXPECT_NEAR(Tout[i], Tout[0], 2 * tol * 1000.0);
+    }
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from test_zeroD.cpp\n");
@@ -174,3 +469,228 @@ int main(int argc, char** argv)
     Cantera::appdelete();
     return result;
 }
+
+TEST(ReactorNet, sparse_jacobian)
+{
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    std::vector<std::shared_ptr<Solution>> sols;
+    std::vector<std::unique_ptr<IdealGasReactor>> reactors;
+    ReactorNet net;
+    for (size_t i = 0; i < 4; i++) {
+        sols.push_back(sol->clone());
+        sols[i]->thermo()->setState_TPX(1000 + 50 * i, OneAtm * (1 + 0.1 * i),
+                                        "H2:2, O2:1, AR:4, H:0.01, OH:0.01");
+        reactors.emplace_back(new IdealGasReactor());
+        reactors[i]->insert(sols[i]);
+        net.addReactor(*reactors[i]);
+    }
+    sol->thermo()->setState_TPX(300, OneAtm, "H2:2, O2:1, AR:4");
+    Reservoir inlet, outlet;
+    inlet.insert(sol);
+    outlet.insert(sol);
+
+    // inlet -> r0 -> r1 -> r2 -> r3 -> outlet, with a wall between r0 and r3
+    MassFlowController mfc0, mfc1;
+    mfc0.install(inlet, *reactors[0]);
+    mfc0.setMassFlowRate(0.01);
+    mfc1.install(*reactors[0], *reactors[1]);
+    mfc1.setMassFlowRate(0.02);
+    Valve valve;
+    valve.install(*reactors[1], *reactors[2]);
+    valve.setValveCoeff(1e-5);
+    PressureController pc;
+    pc.install(*reactors[2], *reactors[3]);
+    pc.setMaster(&valve);
+    pc.setPressureCoeff(1e-5);
+    Valve exhaust;
+    exhaust.install(*reactors[3], outlet);
+    exhaust.setValveCoeff(1e-5);
+    Wall wall;
+    wall.install(*reactors[0], *reactors[3]);
+    wall.setHeatTransferCoeff(100);
+    wall.setExpansionRateCoeff(1e-6);
+
+    net.initialize();
+    size_t nv = net.neq();
+    vector_fp y(nv), ydot(nv), ydot2(nv);
+    net.getState(y.data());
+    Array2D dense(nv, nv);
+    net.evalJacobian(0.0, y.data(), ydot.data(), nullptr, &dense);
+    Eigen::SparseMatrix<double> jac;
+    net.evalSparseJacobian(0.0, y.data(), ydot2.data(), nullptr, jac);
+
+    // Reactors r0 and r1 are coupled to all others; r2 and r3 are coupled to
+    // each other and to r0 and r1.
+    EXPECT_EQ(net.nJacobianGroups(), 4u);
+    for (size_t i = 0; i < nv; i++) {
+        EXPECT_DOUBLE_EQ(ydot2[i], ydot[i]);
+        for (size_t j = 0; j < nv; j++) {
+            EXPECT_NEAR(jac.coeff(i, j), dense(i, j),
+                        1e-6 * std::max(std::abs(dense(i, j)), 1.0));
+        }
+    }
+
+    // A chain of reactors only requires three groups
+    std::vector<std::unique_ptr<IdealGasReactor>> chain;
+    std::vector<std::unique_ptr<MassFlowController>> mfcs;
+    ReactorNet chainNet;
+    for (size_t i = 0; i < 8; i++) {
+        sols.push_back(sol->clone());
+        chain.emplace_back(new IdealGasReactor());
+        chain[i]->insert(sols.back());
+        chainNet.addReactor(*chain[i]);
+        if (i) {
+            mfcs.emplace_back(new MassFlowController());
+            mfcs.back()->install(*chain[i-1], *chain[i]);
+            mfcs.back()->setMassFlowRate(0.01);
+        }
+    }
+    EXPECT_EQ(chainNet.nJacobianGroups(), 3u);
+
+    // The coupled preconditioner uses the same Jacobian
+    auto precon = std::make_shared<AdaptivePreconditioner>();
+    precon->setThreshold(0.0);
+    net.setPreconditioner(precon);
+    net.setCoupledPreconditioner(true);
+    net.initialize();
+    precon->initialize(nv);
+    net.preconditionerSetup(0.0, y.data(), 1e-6);
+    Eigen::SparseMatrix<double> pjac = precon->jacobian();
+    EXPECT_EQ(pjac.nonZeros(), jac.nonZeros());
+    for (size_t i = 0; i < nv; i++) {
+        for (size_t j = 0; j < nv; j++) {
+            EXPECT_DOUBLE_EQ(pjac.coeff(i, j), jac.coeff(i, j));
+        }
+    }
+}
+
+TEST(ReactorNet, parallel_eval)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    sol->thermo()->setState_TPX(300, OneAtm, "CH4:1, O2:2, N2:7.52");
+    Reservoir inlet;
+    inlet.insert(sol);
+    std::vector<std::shared_ptr<Solution>> sols;
+    std::vector<std::unique_ptr<IdealGasReactor>> reactors;
+    std::vector<std::unique_ptr<MassFlowController>> mfcs;
+    ReactorNet net;
+    for (size_t i = 0; i < 6; i++) {
+        sols.push_back(sol->clone());
+        sols[i]->thermo()->setState_TPX(1200 + 100 * i, OneAtm,
+                                        "CH4:1, O2:2, N2:7.52, OH:0.01");
+        reactors.emplace_back(new IdealGasReactor());
+        reactors[i]->insert(sols[i]);
+        net.addReactor(*reactors[i]);
+        mfcs.emplace_back(new MassFlowController());
+        mfcs.back()->install(i ? static_cast<ReactorBase&>(*reactors[i-1]) : inlet,
+                             *reactors[i]);
+        mfcs.back()->setMassFlowRate(0.01);
+    }
+    net.initialize();
+    size_t nv = net.neq();
+    vector_fp y(nv), ydot1(nv), ydot2(nv);
+    net.getState(y.data());
+    net.eval(0.0, y.data(), ydot1.data(), nullptr);
+
+    net.setNumThreads(3);
+    EXPECT_EQ(net.numThreads(), 3u);
+    net.initialize();
+    for (size_t n = 0; n < 10; n++) {
+        net.eval(0.0, y.data(), ydot2.data(), nullptr);
+        for (size_t i = 0; i < nv; i++) {
+            EXPECT_DOUBLE_EQ(ydot2[i], ydot1[i]);
+        }
+    }
+
+    // Reactors sharing a phase cannot be evaluated concurrently
+    IdealGasReactor shared;
+    shared.insert(sols[0]);
+    net.addReactor(shared);
+    net.setNumThreads(2);
+    EXPECT_THROW(net.initialize(), CanteraError);
+}
+
+TEST(ReactorNet, adjoint_ignition_delay)
+{
+    auto ignition = [](size_t irxn, double mult, vector_fp* grad) {
+        auto sol = newSolution("h2o2.yaml", "", "none");
+        sol->thermo()->setState_TPX(1000, OneAtm, "H2:2, O2:1, N2:4");
+        if (irxn != npos) {
+            sol->kinetics()->setMultiplier(irxn, mult);
+        }
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setTolerances(1e-8, 1e-14);
+        net.setSensitivityTolerances(1e-6, 1e-8);
+        double tau = net.solveAdjoint(1e-3, "ignition", "temperature", 0, 1400);
+        if (grad) {
+            *grad = net.adjointSensitivities(0);
+            EXPECT_EQ(grad->size(), sol->kinetics()->nReactions());
+            // network is left at the ignition time
+            EXPECT_NEAR(net.time(), tau, 1e-12);
+            EXPECT_NEAR(reactor.temperature(), 1400, 1e-3);
+        }
+        return tau;
+    };
+
+    vector_fp grad;
+    double tau = ignition(npos, 1.0, &grad);
+    EXPECT_NEAR(tau, 3.2e-4, 0.2e-4);
+    double eps = 1e-2;
+    for (size_t i : {2, 5, 10}) {
+        double dtau = ignition(i, 1 + eps, nullptr) - ignition(i, 1 - eps, nullptr);
+        double dtau_dlnk = dtau / (log(1 + eps) - log(1 - eps));
+        EXPECT_NEAR(grad[i], dtau_dlnk, 0.05 * std::abs(dtau_dlnk));
+    }
+
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    sol->thermo()->setState_TPX(1000, OneAtm, "H2:2, O2:1, N2:4");
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    EXPECT_THROW(net.solveAdjoint(1e-3, "maximum", "temperature"), CanteraError);
+    EXPECT_THROW(net.adjointSensitivities(0), CanteraError);
+    EXPECT_THROW(net.solveAdjoint(1e-5, "ignition", "temperature", 0, 1400),
+                 CanteraError);
+}
+
+TEST(ZeroDim, thermo_evaluations_per_rhs)
+{
+    // Count the evaluations of the species thermo needed by each evaluation of
+    // the governing equations, where the energy of the reactor changes between
+    // calls as it would during integration
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto& spthermo = sol->thermo()->speciesThermo();
+    for (bool constPressure : {false, true}) {
+        sol->thermo()->setState_TPX(1200, OneAtm, "CH4:1, O2:2, N2:7.52");
+        std::unique_ptr<Reactor> r;
+        if (constPressure) {
+            r.reset(new ConstPressureReactor());
+        } else {
+            r.reset(new Reactor());
+        }
+        r->insert(sol);
+        ReactorNet net;
+        net.addReactor(*r);
+        net.initialize();
+        size_t nv = net.neq();
+        vector_fp y(nv), ydot(nv);
+        net.getState(y.data());
+        size_t ie = r->componentIndex(constPressure ? "enthalpy" : "int_energy");
+        double E0 = y[ie];
+        int nEval = 200;
+        spthermo.resetUpdateCount();
+        for (int i = 0; i < nEval; i++) {
+            y[ie] = E0 * (1 + 1e-3 * sin(0.1 * i));
+            net.eval(0.0, y.data(), ydot.data(), nullptr);
+            double E = constPressure ? sol->thermo()->enthalpy_mass()
+                                     : sol->thermo()->intEnergy_mass();
+            EXPECT_NEAR(E * r->mass(), y[ie], 1e-8 * std::abs(E0));
+        }
+        double perCall = spthermo.nUpdates() / double(nEval);
+        EXPECT_LE(perCall, 2.5) << (constPressure ? "ConstPressureReactor" : "Reactor");
+    }
+}